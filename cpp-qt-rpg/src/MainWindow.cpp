@@ -13,36 +13,68 @@
 #include "views/DialogueView.h"
 #include "views/StoryEventDialog.h"
 #include "views/LoreBookPage.h"
+#include "views/PageRegistry.h"
 #include "models/DialogueData.h"
 #include "game/Game.h"
+#include "game/ContentWarmup.h"
+#include "game/ContentWatcher.h"
+#include "game/ContentDatabase.h"
 #include "components/SkillSelectionDialog.h"
 #include "components/CombatItemDialog.h"
 #include "components/CombatResultDialog.h"
 #include "components/QuestCompletionDialog.h"
+#include "components/DialogQueue.h"
 #include "components/MenuOverlay.h"
-#include "components/ParticleSystem.h"
+#include "components/QuestListModel.h"
 #include "models/Player.h"
 #include "models/Monster.h"
 #include "models/Skill.h"
 #include "models/Item.h"
 #include "components/AnimationManager.h"
+#include "components/PerformanceOverlay.h"
+#include "diagnostics/Profiler.h"
+#include "diagnostics/AllocationTracker.h"
 #include "theme/Theme.h"
 #include <QStackedWidget>
 #include <QWidget>
 #include <QMessageBox>
 #include <QKeyEvent>
 #include <QResizeEvent>
+#include <QApplication>
+#include <QStandardPaths>
+#include <QDir>
+#include <QDateTime>
+#include <QDebug>
+#include <QTimer>
+
+namespace {
+
+// Rarely visited pages are deleted after this long off screen and rebuilt on the next visit
+const int PAGE_IDLE_TIMEOUT_MS = 3 * 60 * 1000;
+
+} // namespace
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
+    , m_performanceOverlay(nullptr)
+    , m_contentWatcher(nullptr)
+    , m_traceInputFilter(nullptr)
     , m_combatState(Idle)
 {
+    PYRPG_PROFILE_SCOPE("MainWindow::MainWindow");
     setWindowTitle("Pyrpg-Qt");
     resize(800, 600);
 
     stackedWidget = new QStackedWidget(this);
     setCentralWidget(stackedWidget);
 
+    // Page switches show up as instant events in captured traces
+    connect(stackedWidget, &QStackedWidget::currentChanged, this, [this](int index) {
+        if (QWidget *page = stackedWidget->widget(index)) {
+            PYRPG_TRACE_INSTANT(page->metaObject()->className(), "page");
+        }
+    });
+
     // Main Menu
     m_mainMenu = new MainMenu();
     connect(m_mainMenu, &MainMenu::newGameRequested, this, &MainWindow::handleMainMenuNewGame);
@@ -50,15 +82,6 @@ MainWindow::MainWindow(QWidget *parent)
     connect(m_mainMenu, &MainMenu::exitRequested, this, &MainWindow::handleMainMenuExit);
     stackedWidget->addWidget(m_mainMenu);
 
-    // New Game View
-    m_newGameView = new NewGameView();
-    connect(m_newGameView, &NewGameView::characterCreated, this, &MainWindow::handleCharacterCreation);
-    stackedWidget->addWidget(m_newGameView);
-
-    // Character Customization Page
-    m_characterCustomizationPage = new CharacterCustomizationPage();
-    stackedWidget->addWidget(m_characterCustomizationPage);
-
     // Combat Page (now serves as main game hub)
     m_combatPage = new CombatPage();
     connect(m_combatPage, &CombatPage::exploreClicked, this, &MainWindow::handleExploreClicked);
@@ -71,67 +94,22 @@ MainWindow::MainWindow(QWidget *parent)
     connect(m_combatPage, &CombatPage::menuClicked, this, &MainWindow::handleMenuButtonClicked);
     stackedWidget->addWidget(m_combatPage);
 
-    // Inventory Page
-    m_inventoryPage = new InventoryPage();
-    connect(m_inventoryPage, &InventoryPage::backRequested, this, &MainWindow::handleInventoryBack);
-    stackedWidget->addWidget(m_inventoryPage);
-
-    // Monster Stats Page
-    m_monsterStatsPage = new MonsterStatsPage();
-    connect(m_monsterStatsPage, &MonsterStatsPage::backRequested, this, &MainWindow::handleMonsterStatsBack);
-    stackedWidget->addWidget(m_monsterStatsPage);
-
-    // Save Load Page
-    m_saveLoadPage = new SaveLoadPage();
-    connect(m_saveLoadPage, &SaveLoadPage::quickSaveRequested, this, &MainWindow::handleQuickSave);
-    connect(m_saveLoadPage, &SaveLoadPage::quickLoadRequested, this, &MainWindow::handleQuickLoad);
-    connect(m_saveLoadPage, &SaveLoadPage::saveToSlotRequested, this, &MainWindow::handleSaveToSlot);
-    connect(m_saveLoadPage, &SaveLoadPage::loadFromSlotRequested, this, &MainWindow::handleLoadFromSlot);
-    connect(m_saveLoadPage, &SaveLoadPage::deleteSlotRequested, this, &MainWindow::handleDeleteSlot);
-    connect(m_saveLoadPage, &SaveLoadPage::backRequested, this, &MainWindow::handleSaveLoadBack);
-    stackedWidget->addWidget(m_saveLoadPage);
-
-    // Shop Page
-    m_shopPage = new ShopPage();
-    connect(m_shopPage, &ShopPage::leaveRequested, this, &MainWindow::handleShopLeave);
-    connect(m_shopPage, &ShopPage::itemPurchased, this, &MainWindow::onItemPurchased);
-    connect(m_shopPage, &ShopPage::itemSold, this, &MainWindow::onItemSold);
-    connect(m_shopPage, &ShopPage::loreUnlockedFromPurchase, this, &MainWindow::handleLoreUnlockedFromPurchase);
-    stackedWidget->addWidget(m_shopPage);
-
-    // Stats Page
-    m_statsPage = new StatsPage();
-    connect(m_statsPage, &StatsPage::backRequested, this, &MainWindow::handleStatsBack);
-    stackedWidget->addWidget(m_statsPage);
-
-    // Quest Log Page
-    m_questLogPage = new QuestLogPage();
-    connect(m_questLogPage, &QuestLogPage::backRequested, this, &MainWindow::handleQuestLogBack);
-    connect(m_questLogPage, &QuestLogPage::questAccepted, this, &MainWindow::handleQuestAccepted);
-    stackedWidget->addWidget(m_questLogPage);
+    // Quest model lives here so the quest log page can be evicted without
+    // taking the combat tracker's model with it
+    m_questModel = new QuestListModel(this);
+    m_combatPage->setQuestModel(m_questModel);
 
-    // Dialogue View (Phase 3)
-    m_dialogueView = new DialogueView(this);
-    connect(m_dialogueView, &DialogueView::choiceSelected,
-            this, &MainWindow::handleDialogueChoiceSelected);
-    connect(m_dialogueView, &DialogueView::dialogueClosed,
-            this, &MainWindow::handleDialogueEnded);
-    stackedWidget->addWidget(m_dialogueView);
-
-    // Lore Book Page (Phase 3)
-    m_loreBookPage = new LoreBookPage();
-    connect(m_loreBookPage, &LoreBookPage::backRequested,
-            this, &MainWindow::handleLoreBookBack);
-    stackedWidget->addWidget(m_loreBookPage);
+    // Remaining pages are built on first navigation
+    m_pages = new PageRegistry(stackedWidget, this);
+    registerPages();
+    m_pages->setIdleTimeout(PAGE_IDLE_TIMEOUT_MS);
 
     // Set the initial view
     stackedWidget->setCurrentWidget(m_mainMenu);
 
-    // Initialize victory screen (lazy creation)
-    m_victoryScreen = nullptr;
-
     m_game = new Game(this);  // Parent to MainWindow to prevent memory leak
     connect(m_game, &Game::combatEnded, this, &MainWindow::handleCombatEnded);
+    connect(m_game, &Game::playerChanged, this, &MainWindow::handlePlayerChanged);
 
     // Connect boss and victory signals
     connect(m_game, &Game::bossEncountered, this, &MainWindow::handleBossEncountered);
@@ -152,10 +130,160 @@ MainWindow::MainWindow(QWidget *parent)
 
     m_animationManager = new AnimationManager(m_combatPage, this);
     connect(m_animationManager, &AnimationManager::animationFinished, this, &MainWindow::onAnimationFinished);
+
+    // Result, quest and story dialogs are shown in-window, one after another
+    m_dialogQueue = DialogQueue::forWindow(this);
+
+    // Performance overlay (debug; F3 cycles timings, memory, hidden)
+    m_performanceOverlay = new PerformanceOverlay(this);
+
+    // Build catalogs and decode sprites in the background once the main menu is on screen
+    m_contentWarmup = new ContentWarmup(this);
+    connect(m_contentWarmup, &ContentWarmup::finished, this, &MainWindow::startContentWatcher);
+    QTimer::singleShot(0, this, &MainWindow::startContentWarmup);
+}
+
+void MainWindow::startContentWarmup()
+{
+    QList<ContentWarmup::SpriteRequest> sprites;
+    const QSize combatSize(CombatPage::SPRITE_SIZE, CombatPage::SPRITE_SIZE);
+    const QSize previewSize(NewGameView::PREVIEW_SPRITE_SIZE, NewGameView::PREVIEW_SPRITE_SIZE);
+    for (const QString &heroClass : {"warrior", "mage", "rogue"}) {
+        QString assetPath = QString(":/assets/%1.png").arg(heroClass);
+        sprites.append({assetPath, previewSize});
+        sprites.append({assetPath, combatSize});
+    }
+    // Monster sprites come from the content, which the worker loads first
+    m_contentWarmup->start(sprites, devicePixelRatioF(), combatSize);
+}
+
+void MainWindow::startContentWatcher()
+{
+    // After the warm-up, so a reload never races the worker reading the content
+    QString directory = ContentDatabase::instance().overrideDirectory();
+    if (directory.isEmpty() || m_contentWatcher) {
+        return;
+    }
+    m_contentWatcher = new ContentWatcher(directory, this);
+    connect(m_contentWatcher, &ContentWatcher::contentChanged, this, &MainWindow::handleContentChanged);
+    qInfo() << "Watching" << directory << "for content changes";
+}
+
+void MainWindow::handleContentChanged()
+{
+    PYRPG_TRACE_SCOPE("MainWindow::handleContentChanged", "slot");
+    QStringList errors;
+    if (!m_game->reloadContent(&errors)) {
+        // The details are in the log; the first error says which file to fix. Plain
+        // text: the log only treats messages with tags as rich text.
+        m_combatPage->addLogEntry(QString("Content reload rejected: %1").arg(errors.value(0)), "error");
+        return;
+    }
+    m_combatPage->addLogEntry("Content reloaded", "info");
+}
+
+void MainWindow::handlePlayerChanged(Player *player)
+{
+    // Item rows are keyed by pointer, so they must not outlive the player they came from
+    if (InventoryPage *inventoryPage = m_pages->existingPage<InventoryPage>(InventoryPageId)) {
+        inventoryPage->setPlayer(player);
+    }
+    m_menuOverlay->setPlayer(player);
+}
+
+void MainWindow::registerPages()
+{
+    m_pages->registerPage(NewGamePageId, [this]() -> QWidget* {
+        NewGameView *page = new NewGameView();
+        connect(page, &NewGameView::characterCreated, this, &MainWindow::handleCharacterCreation);
+        return page;
+    }, true);
+
+    m_pages->registerPage(CharacterCustomizationPageId, []() -> QWidget* {
+        return new CharacterCustomizationPage();
+    }, true);
+
+    // Inventory and shop are visited constantly, so they stay once built
+    m_pages->registerPage(InventoryPageId, [this]() -> QWidget* {
+        InventoryPage *page = new InventoryPage();
+        connect(page, &InventoryPage::backRequested, this, &MainWindow::handleInventoryBack);
+        return page;
+    });
+
+    m_pages->registerPage(MonsterStatsPageId, [this]() -> QWidget* {
+        MonsterStatsPage *page = new MonsterStatsPage();
+        connect(page, &MonsterStatsPage::backRequested, this, &MainWindow::handleMonsterStatsBack);
+        return page;
+    }, true);
+
+    m_pages->registerPage(SaveLoadPageId, [this]() -> QWidget* {
+        SaveLoadPage *page = new SaveLoadPage();
+        connect(page, &SaveLoadPage::quickSaveRequested, this, &MainWindow::handleQuickSave);
+        connect(page, &SaveLoadPage::quickLoadRequested, this, &MainWindow::handleQuickLoad);
+        connect(page, &SaveLoadPage::saveToSlotRequested, this, &MainWindow::handleSaveToSlot);
+        connect(page, &SaveLoadPage::loadFromSlotRequested, this, &MainWindow::handleLoadFromSlot);
+        connect(page, &SaveLoadPage::deleteSlotRequested, this, &MainWindow::handleDeleteSlot);
+        connect(page, &SaveLoadPage::backRequested, this, &MainWindow::handleSaveLoadBack);
+        return page;
+    }, true);
+
+    m_pages->registerPage(ShopPageId, [this]() -> QWidget* {
+        ShopPage *page = new ShopPage();
+        connect(page, &ShopPage::leaveRequested, this, &MainWindow::handleShopLeave);
+        connect(page, &ShopPage::itemPurchased, this, &MainWindow::onItemPurchased);
+        connect(page, &ShopPage::itemSold, this, &MainWindow::onItemSold);
+        connect(page, &ShopPage::loreUnlockedFromPurchase, this, &MainWindow::handleLoreUnlockedFromPurchase);
+        return page;
+    });
+
+    m_pages->registerPage(StatsPageId, [this]() -> QWidget* {
+        StatsPage *page = new StatsPage();
+        connect(page, &StatsPage::backRequested, this, &MainWindow::handleStatsBack);
+        return page;
+    }, true);
+
+    m_pages->registerPage(QuestLogPageId, [this]() -> QWidget* {
+        QuestLogPage *page = new QuestLogPage(m_questModel);
+        connect(page, &QuestLogPage::backRequested, this, &MainWindow::handleQuestLogBack);
+        connect(page, &QuestLogPage::questAccepted, this, &MainWindow::handleQuestAccepted);
+        return page;
+    }, true);
+
+    // Dialogue View (Phase 3)
+    m_pages->registerPage(DialoguePageId, [this]() -> QWidget* {
+        DialogueView *page = new DialogueView();
+        connect(page, &DialogueView::choiceSelected,
+                this, &MainWindow::handleDialogueChoiceSelected);
+        connect(page, &DialogueView::dialogueClosed,
+                this, &MainWindow::handleDialogueEnded);
+        return page;
+    }, true);
+
+    // Lore Book Page (Phase 3)
+    m_pages->registerPage(LoreBookPageId, [this]() -> QWidget* {
+        LoreBookPage *page = new LoreBookPage();
+        connect(page, &LoreBookPage::backRequested,
+                this, &MainWindow::handleLoreBookBack);
+        page->setSearchFunction([this](const QString &query) {
+            return m_game->searchContent(query);
+        });
+        return page;
+    }, true);
+}
+
+void MainWindow::attachQuestModel()
+{
+    QuestManager *questManager = m_game->getQuestManager();
+    if (QuestLogPage *questLogPage = m_pages->existingPage<QuestLogPage>(QuestLogPageId)) {
+        questLogPage->updateQuests(questManager, m_game->getPlayer());
+    } else if (m_questModel->questManager() != questManager) {
+        m_questModel->setQuestManager(questManager, m_game->getPlayer());
+    }
 }
 
 void MainWindow::handleCharacterCreation(const QString &name, const QString &characterClass)
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleCharacterCreation", "slot");
     // Create new game and initialize all managers
     m_game->newGame(name, characterClass);
 
@@ -187,6 +315,8 @@ void MainWindow::handleCharacterCreation(const QString &name, const QString &cha
     // This ensures story event dialogs display properly when first quest is auto-accepted
     if (m_game->getQuestManager()) {
         m_game->getQuestManager()->loadQuests();
+        // Attach the quest model (shared with the combat page tracker) once quests exist
+        attachQuestModel();
     }
 
     // Start in non-combat mode on the main game hub (CombatPage)
@@ -232,6 +362,7 @@ void MainWindow::handleQuitClicked()
 
 void MainWindow::handleAttackClicked()
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleAttackClicked", "slot");
     m_combatState = PlayerAttacking;
     m_combatPage->setCombatActive(false);
     m_animationManager->playPlayerAttackAnimation();
@@ -239,10 +370,14 @@ void MainWindow::handleAttackClicked()
 
 void MainWindow::handleSkillClicked()
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleSkillClicked", "slot");
     // Open skill selection dialog
-    SkillSelectionDialog dialog(m_game->getPlayer(), this);
-    if (dialog.exec() == QDialog::Accepted) {
-        Skill *selectedSkill = dialog.getSelectedSkill();
+    SkillSelectionDialog *dialog = new SkillSelectionDialog(m_game->getPlayer(), this);
+    m_dialogQueue->enqueue(dialog, [this, dialog](int result) {
+        if (result != QDialog::Accepted || !m_game->isInCombat()) {
+            return;
+        }
+        Skill *selectedSkill = dialog->getSelectedSkill();
         if (selectedSkill) {
             int oldLevel = m_game->getPlayer()->level;
             QString log = m_game->playerUseSkill(selectedSkill);
@@ -260,70 +395,71 @@ void MainWindow::handleSkillClicked()
                 }
             }
         }
-    }
+    });
 }
 
 void MainWindow::handleItemClicked()
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleItemClicked", "slot");
     // Open combat item dialog
-    CombatItemDialog dialog(m_game->getPlayer(), this);
-    if (dialog.exec() == QDialog::Accepted) {
-        Item *selectedItem = dialog.getSelectedItem();
+    CombatItemDialog *dialog = new CombatItemDialog(m_game->getPlayer(), this);
+    m_dialogQueue->enqueue(dialog, [this, dialog](int result) {
+        if (result != QDialog::Accepted || !m_game->isInCombat()) {
+            return;
+        }
+        Item *selectedItem = dialog->getSelectedItem();
         if (selectedItem) {
             QString log = m_game->playerUseItem(selectedItem);
             m_combatPage->updateCombatState(m_game->getPlayer(), m_game->getCurrentMonster(), log);
 
             // Trigger particle effects based on item type
-            if (m_combatPage && m_combatPage->getParticleSystem()) {
-                QLabel* heroSprite = m_combatPage->getHeroSpriteLabel();
-                if (heroSprite) {
-                    QPoint heroPos = heroSprite->geometry().center();
-
-                    if (selectedItem->effect == "heal") {
-                        // Healing particle burst
-                        m_combatPage->getParticleSystem()->healingBurst(heroPos);
-                    } else if (selectedItem->effect == "restore_mana") {
-                        // Mana restoration particle burst (blue)
-                        m_combatPage->getParticleSystem()->createBurst(heroPos, 10, "spark", "#3498db", false);
-                    }
-                }
+            CombatCanvas *canvas = m_combatPage->getCombatCanvas();
+            if (selectedItem->effect == "heal") {
+                // Healing particle burst
+                canvas->burst(CombatCanvas::Hero, 10, "heart", "#27ae60");
+            } else if (selectedItem->effect == "restore_mana") {
+                // Mana restoration particle burst (blue)
+                canvas->burst(CombatCanvas::Hero, 10, "spark", "#3498db");
             }
 
             // Item use doesn't end player's turn, no monster attack
         }
-    }
+    });
 }
 
 void MainWindow::handleStatsClicked()
 {
     // Show player stats, not monster stats
-    m_statsPage->updateStats(m_game->getPlayer());
-    stackedWidget->setCurrentWidget(m_statsPage);
+    m_pages->page<StatsPage>(StatsPageId)->updateStats(m_game->getPlayer());
+    m_pages->show(StatsPageId);
 }
 
 void MainWindow::handleOpenInventory()
 {
     if (m_game && m_game->getPlayer()) {
-        m_inventoryPage->updateInventory(m_game->getPlayer());
-        stackedWidget->setCurrentWidget(m_inventoryPage);
-        m_inventoryPage->setFocus();
+        InventoryPage *inventoryPage = m_pages->page<InventoryPage>(InventoryPageId);
+        inventoryPage->updateInventory(m_game->getPlayer());
+        stackedWidget->setCurrentWidget(inventoryPage);
+        inventoryPage->setFocus();
     }
 }
 
 void MainWindow::handleOpenShop()
 {
     if (m_game && m_game->getPlayer()) {
-        m_shopPage->updateShop(m_game->getPlayer());
-        stackedWidget->setCurrentWidget(m_shopPage);
-        m_shopPage->setFocus();
+        ShopPage *shopPage = m_pages->page<ShopPage>(ShopPageId);
+        shopPage->updateShop(m_game->getPlayer());
+        stackedWidget->setCurrentWidget(shopPage);
+        shopPage->setFocus();
     }
 }
 
 void MainWindow::handleOpenSaveLoad()
 {
-    m_saveLoadPage->refreshSaveSlots();
-    stackedWidget->setCurrentWidget(m_saveLoadPage);
-    m_saveLoadPage->setFocus();
+    SaveLoadPage *saveLoadPage = m_pages->page<SaveLoadPage>(SaveLoadPageId);
+    saveLoadPage->refreshSaveSlots();
+    stackedWidget->setCurrentWidget(saveLoadPage);
+    saveLoadPage->setFocus();
 }
 
 void MainWindow::handleCombatEnd(int oldLevel)
@@ -336,6 +472,7 @@ void MainWindow::handleCombatEnd(int oldLevel)
 
 void MainWindow::handleCombatEnded(bool playerWon)
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleCombatEnded", "slot");
     // Defensive null check for combat page
     if (!m_combatPage) {
         return;
@@ -345,24 +482,16 @@ void MainWindow::handleCombatEnded(bool playerWon)
     m_combatPage->setCombatActive(false);
 
     // Trigger particle effects for victory or defeat
-    if (m_combatPage->getParticleSystem()) {
-        QPoint centerPos = m_combatPage->rect().center();
-        if (playerWon) {
-            // Victory explosion effect
-            m_combatPage->getParticleSystem()->victoryExplosion(centerPos);
-        } else {
-            // Defeat effect (red particles)
-            m_combatPage->getParticleSystem()->createBurst(centerPos, 12, "spark", "#8b0000", false);
-        }
-    }
+    m_animationManager->playCombatEndAnimation(playerWon);
 
     // For now, don't check leveling - rewards are already given
     bool leveledUp = false;
 
     // Show combat result dialog
+    CombatResultDialog *resultDialog = nullptr;
     if (playerWon) {
         Monster *monster = m_game->getCurrentMonster();
-        CombatResultDialog resultDialog(
+        resultDialog = new CombatResultDialog(
             true,
             monster ? monster->expReward : 0,
             monster ? monster->goldReward : 0,
@@ -370,16 +499,16 @@ void MainWindow::handleCombatEnded(bool playerWon)
             leveledUp,
             this
         );
-        resultDialog.exec();
     } else {
         // Defeat
-        CombatResultDialog resultDialog(false, 0, 0, "", false, this);
-        resultDialog.exec();
+        resultDialog = new CombatResultDialog(false, 0, 0, "", false, this);
     }
 
-    // Return to non-combat mode on the main game hub
-    m_combatPage->setCombatMode(false);
-    stackedWidget->setCurrentWidget(m_combatPage);
+    // Return to non-combat mode on the main game hub once the result is dismissed
+    m_dialogQueue->enqueue(resultDialog, [this](int) {
+        m_combatPage->setCombatMode(false);
+        stackedWidget->setCurrentWidget(m_combatPage);
+    });
 }
 
 void MainWindow::handleRunClicked()
@@ -390,6 +519,7 @@ void MainWindow::handleRunClicked()
 
 void MainWindow::handleQuickSave()
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleQuickSave", "slot");
     // For quick save, use a default file path, e.g., quicksave.dat
     QString filePath = "quicksave.dat";
     if (m_game->saveGame(filePath)) {
@@ -399,6 +529,7 @@ void MainWindow::handleQuickSave()
 
 void MainWindow::handleQuickLoad()
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleQuickLoad", "slot");
     QString filePath = "quicksave.dat";
     if (m_game->loadGame(filePath)) {
         m_combatPage->setCombatMode(false);
@@ -443,6 +574,7 @@ void MainWindow::handleLoadFromFile(const QString &filePath)
         // Load quests after all connections are established
         if (m_game->getQuestManager()) {
             m_game->getQuestManager()->loadQuests();
+            attachQuestModel();
         }
 
         m_combatPage->setCombatMode(false);
@@ -452,13 +584,16 @@ void MainWindow::handleLoadFromFile(const QString &filePath)
 
 void MainWindow::handleNewSave()
 {
-    stackedWidget->setCurrentWidget(m_newGameView);
+    m_pages->show(NewGamePageId);
 }
 
 void MainWindow::handleSaveToSlot(int slotNumber)
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleSaveToSlot", "slot");
     if (m_game->saveToSlot(slotNumber)) {
-        m_saveLoadPage->refreshSaveSlots();
+        if (SaveLoadPage *saveLoadPage = m_pages->existingPage<SaveLoadPage>(SaveLoadPageId)) {
+            saveLoadPage->refreshSaveSlots();
+        }
         QMessageBox::information(this, "Success", "Game saved successfully!");
     } else {
         QMessageBox::warning(this, "Save Failed", "Failed to save game to slot " + QString::number(slotNumber));
@@ -467,6 +602,7 @@ void MainWindow::handleSaveToSlot(int slotNumber)
 
 void MainWindow::handleLoadFromSlot(int slotNumber)
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleLoadFromSlot", "slot");
     if (m_game->loadFromSlot(slotNumber)) {
         // Connect QuestManager signals after loading
         if (m_game->getQuestManager()) {
@@ -495,6 +631,7 @@ void MainWindow::handleLoadFromSlot(int slotNumber)
         // Load quests after all connections are established
         if (m_game->getQuestManager()) {
             m_game->getQuestManager()->loadQuests();
+            attachQuestModel();
         }
 
         m_combatPage->setCombatMode(false);
@@ -507,7 +644,9 @@ void MainWindow::handleLoadFromSlot(int slotNumber)
 void MainWindow::handleDeleteSlot(int slotNumber)
 {
     if (m_game->deleteSlot(slotNumber)) {
-        m_saveLoadPage->refreshSaveSlots();
+        if (SaveLoadPage *saveLoadPage = m_pages->existingPage<SaveLoadPage>(SaveLoadPageId)) {
+            saveLoadPage->refreshSaveSlots();
+        }
         QMessageBox::information(this, "Success", "Save slot deleted successfully!");
     } else {
         QMessageBox::warning(this, "Delete Failed", "Failed to delete save slot " + QString::number(slotNumber));
@@ -516,13 +655,13 @@ void MainWindow::handleDeleteSlot(int slotNumber)
 
 void MainWindow::handleMainMenuNewGame()
 {
-    stackedWidget->setCurrentWidget(m_newGameView);
+    m_pages->show(NewGamePageId);
 }
 
 void MainWindow::handleMainMenuLoadGame()
 {
-    m_saveLoadPage->refreshSaveSlots();
-    stackedWidget->setCurrentWidget(m_saveLoadPage);
+    m_pages->page<SaveLoadPage>(SaveLoadPageId)->refreshSaveSlots();
+    m_pages->show(SaveLoadPageId);
 }
 
 void MainWindow::handleMainMenuExit()
@@ -596,6 +735,27 @@ void MainWindow::keyPressEvent(QKeyEvent *event)
 {
     QWidget *currentWidget = stackedWidget->currentWidget();
 
+    // Ctrl+F3 writes the allocation report (see AllocationTracker.h)
+    if (event->key() == Qt::Key_F3 && (event->modifiers() & Qt::ControlModifier)) {
+        dumpAllocationReport();
+        event->accept();
+        return;
+    }
+
+    // Performance overlay is available everywhere
+    if (event->key() == Qt::Key_F3 && m_performanceOverlay) {
+        m_performanceOverlay->toggle();
+        event->accept();
+        return;
+    }
+
+    // Start/stop a trace capture (written as Chrome trace JSON when stopped)
+    if (event->key() == Qt::Key_F4) {
+        toggleTraceCapture();
+        event->accept();
+        return;
+    }
+
     // Only handle ESC if we're on the adventure page or combat page (in-game)
     if (event->key() == Qt::Key_Escape && m_menuOverlay) {
 
@@ -649,6 +809,56 @@ void MainWindow::keyPressEvent(QKeyEvent *event)
     QMainWindow::keyPressEvent(event);
 }
 
+void MainWindow::toggleTraceCapture()
+{
+    if (!Profiler::isEnabled()) {
+        qWarning() << "Tracing is unavailable: built without PYRPG_PROFILING";
+        return;
+    }
+
+    Tracer &tracer = Tracer::instance();
+    if (!tracer.isCapturing()) {
+        if (!m_traceInputFilter) {
+            m_traceInputFilter = new TraceInputFilter(this);
+        }
+        qApp->installEventFilter(m_traceInputFilter);
+        tracer.setEnabled(true);
+        qInfo() << "Trace capture started (press F4 again to stop)";
+        return;
+    }
+
+    tracer.setEnabled(false);
+    qApp->removeEventFilter(m_traceInputFilter);
+
+    QString traceDir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/traces";
+    QDir().mkpath(traceDir);
+    QString tracePath = QString("%1/trace-%2.json")
+        .arg(traceDir, QDateTime::currentDateTime().toString("yyyyMMdd-HHmmss"));
+    if (tracer.writeChromeTrace(tracePath)) {
+        qInfo() << "Trace written to" << tracePath;
+    } else {
+        qWarning() << "Failed to write trace to" << tracePath;
+    }
+}
+
+void MainWindow::dumpAllocationReport()
+{
+    if (!AllocationTracker::isEnabled()) {
+        qWarning() << "Allocation report unavailable: built without PYRPG_ALLOCATION_TRACKING";
+        return;
+    }
+
+    QString dataDir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    QDir().mkpath(dataDir);
+    QString reportPath = QString("%1/memory-%2.txt")
+        .arg(dataDir, QDateTime::currentDateTime().toString("yyyyMMdd-HHmmss"));
+    if (AllocationTracker::instance().writeReport(reportPath)) {
+        qInfo() << "Allocation report written to" << reportPath;
+    } else {
+        qWarning() << "Failed to write allocation report to" << reportPath;
+    }
+}
+
 void MainWindow::resizeEvent(QResizeEvent *event)
 {
     QMainWindow::resizeEvent(event);
@@ -657,10 +867,14 @@ void MainWindow::resizeEvent(QResizeEvent *event)
     if (m_menuOverlay) {
         m_menuOverlay->setGeometry(0, 0, width(), height());
     }
+    if (m_performanceOverlay) {
+        m_performanceOverlay->updatePosition();
+    }
 }
 
 void MainWindow::onAnimationFinished()
 {
+    PYRPG_TRACE_SCOPE("MainWindow::onAnimationFinished", "slot");
     Player* player = m_game->getPlayer();
     if (!player) return;  // Guard clause to prevent null pointer dereference
 
@@ -676,7 +890,7 @@ void MainWindow::onAnimationFinished()
                 handleCombatEnd(oldLevel);
             } else {
                 m_combatState = PlayerDamage;
-                m_animationManager->playDamageAnimation(m_combatPage->getEnemySpriteLabel());
+                m_animationManager->playDamageAnimation(CombatCanvas::Enemy);
             }
             break;
         }
@@ -703,8 +917,8 @@ void MainWindow::onAnimationFinished()
 void MainWindow::handleOpenQuestLog()
 {
     if (m_game->getPlayer() && m_game->getQuestManager()) {
-        m_questLogPage->updateQuests(m_game->getQuestManager(), m_game->getPlayer());
-        stackedWidget->setCurrentWidget(m_questLogPage);
+        m_pages->page<QuestLogPage>(QuestLogPageId)->updateQuests(m_game->getQuestManager(), m_game->getPlayer());
+        m_pages->show(QuestLogPageId);
     }
 }
 
@@ -715,15 +929,16 @@ void MainWindow::handleQuestLogBack()
 
 void MainWindow::handleQuestAccepted(const QString &questId)
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleQuestAccepted", "slot");
     if (m_game->getQuestManager()) {
-        m_game->getQuestManager()->acceptQuest(questId);
-        // Refresh the quest log to show updated status
-        m_questLogPage->updateQuests(m_game->getQuestManager(), m_game->getPlayer());
+        // The quest model follows questAccepted, so the log and tracker update themselves
+        m_game->getQuestManager()->acceptQuest(ContentId(questId));
     }
 }
 
-void MainWindow::handleQuestCompleted(const QString &questId, int expReward, int goldReward)
+void MainWindow::handleQuestCompleted(ContentId questId, int expReward, int goldReward)
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleQuestCompleted", "slot");
     // Get quest details
     Quest* quest = nullptr;
     if (m_game->getQuestManager()) {
@@ -731,21 +946,23 @@ void MainWindow::handleQuestCompleted(const QString &questId, int expReward, int
     }
 
     if (quest) {
-        // Show completion dialog
-        QuestCompletionDialog dialog(quest->title, expReward, goldReward, quest->rewards.itemNames, this);
-        dialog.exec();
-
-        // Update the combat page display to reflect new stats
-        if (m_game->getPlayer()) {
-            m_combatPage->updateCombatState(m_game->getPlayer(), m_game->getCurrentMonster(), "");
-        }
+        // Show completion dialog, after any dialog already up
+        QuestCompletionDialog *dialog = new QuestCompletionDialog(quest->title, expReward, goldReward,
+                                                                  quest->rewards.itemNames, this);
+        m_dialogQueue->enqueue(dialog, [this](int) {
+            // Update the combat page display to reflect new stats
+            if (m_game->getPlayer()) {
+                m_combatPage->updateCombatState(m_game->getPlayer(), m_game->getCurrentMonster(), "");
+            }
+        });
     }
 }
 
 // Phase 3: Narrative system handlers
 
-void MainWindow::handleDialogueNodeChanged(const QString &nodeId, const QString &speaker, const QString &text)
+void MainWindow::handleDialogueNodeChanged(ContentId nodeId, const QString &speaker, const QString &text)
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleDialogueNodeChanged", "slot");
     DialogueNode* node = m_game->getDialogueManager()->getCurrentNode();
     if (!node) return;
 
@@ -756,7 +973,8 @@ void MainWindow::handleDialogueNodeChanged(const QString &nodeId, const QString
     }
 
     // Display dialogue
-    m_dialogueView->displayNode(speaker, text, choiceTexts);
+    DialogueView *dialogueView = m_pages->page<DialogueView>(DialoguePageId);
+    dialogueView->displayNode(speaker, text, choiceTexts);
 
     // Check requirements and disable invalid choices
     for (int i = 0; i < node->choices.size(); ++i) {
@@ -767,11 +985,11 @@ void MainWindow::handleDialogueNodeChanged(const QString &nodeId, const QString
             enabled = false;
         }
 
-        m_dialogueView->setChoiceEnabled(i, enabled);
+        dialogueView->setChoiceEnabled(i, enabled);
     }
 
     // Switch to dialogue view
-    stackedWidget->setCurrentWidget(m_dialogueView);
+    stackedWidget->setCurrentWidget(dialogueView);
 }
 
 void MainWindow::handleDialogueChoiceSelected(int choiceIndex)
@@ -787,6 +1005,7 @@ void MainWindow::handleDialogueEnded()
 
 void MainWindow::handleDialogueEffectTriggered(const QString &effectType, const QString &target, int value)
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleDialogueEffectTriggered", "slot");
     // Log dialogue effects to combat log
     if (effectType == "GiveGold") {
         m_combatPage->addLogEntry(QString("Received %1 gold!").arg(value), "success");
@@ -801,17 +1020,15 @@ void MainWindow::handleDialogueEffectTriggered(const QString &effectType, const
 
 void MainWindow::handleStoryEventTriggered(const StoryEvent &event)
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleStoryEventTriggered", "slot");
     qDebug() << "MainWindow::handleStoryEventTriggered() called with event:" << event.eventId;
-    qDebug() << "Event title:" << event.title;
-    // Show modal story event dialog
-    StoryEventDialog dialog(event, this);
-    qDebug() << "About to show dialog (this will block)...";
-    dialog.exec();  // Blocks until player dismisses
-    qDebug() << "Dialog closed";
+    // Queued behind any result or quest dialog that is still up
+    m_dialogQueue->enqueue(new StoryEventDialog(event, this));
 }
 
-void MainWindow::handleLoreUnlocked(const QString &entryId, const QString &title)
+void MainWindow::handleLoreUnlocked(ContentId entryId, const QString &title)
 {
+    PYRPG_TRACE_SCOPE("MainWindow::handleLoreUnlocked", "slot");
     // Show notification in combat log with PRIMARY color highlighting (Phase 5)
     QString message = QString("<span style='color:%1'>New Codex Entry:</span> %2")
         .arg(Theme::PRIMARY.name())
@@ -824,25 +1041,28 @@ void MainWindow::handleLoreUnlockedFromPurchase(const QString &loreId)
     // Get lore entry and display notification (Phase 5)
     if (!m_game || !m_game->getCodexManager()) return;
 
-    LoreEntry* entry = m_game->getCodexManager()->getEntry(loreId);
+    ContentId entryId(loreId);
+    LoreEntry* entry = m_game->getCodexManager()->getEntry(entryId);
     if (entry) {
-        handleLoreUnlocked(loreId, entry->title);
+        handleLoreUnlocked(entryId, entry->title);
     }
 }
 
 void MainWindow::onItemPurchased(Item *item)
 {
+    PYRPG_TRACE_SCOPE("MainWindow::onItemPurchased", "slot");
     // Update inventory if open
-    if (stackedWidget->currentWidget() == m_inventoryPage) {
-        m_inventoryPage->updateInventory(m_game->getPlayer());
+    if (m_pages->isCurrent(InventoryPageId)) {
+        m_pages->page<InventoryPage>(InventoryPageId)->updateInventory(m_game->getPlayer());
     }
 }
 
 void MainWindow::onItemSold(Item *item, int goldReceived)
 {
+    PYRPG_TRACE_SCOPE("MainWindow::onItemSold", "slot");
     // Update inventory if open
-    if (stackedWidget->currentWidget() == m_inventoryPage) {
-        m_inventoryPage->updateInventory(m_game->getPlayer());
+    if (m_pages->isCurrent(InventoryPageId)) {
+        m_pages->page<InventoryPage>(InventoryPageId)->updateInventory(m_game->getPlayer());
     }
 }
 
@@ -850,8 +1070,8 @@ void MainWindow::handleOpenLoreBook()
 {
     if (!m_game || !m_game->getCodexManager()) return;
 
-    m_loreBookPage->updateLore(m_game->getCodexManager());
-    stackedWidget->setCurrentWidget(m_loreBookPage);
+    m_pages->page<LoreBookPage>(LoreBookPageId)->updateLore(m_game->getCodexManager());
+    m_pages->show(LoreBookPageId);
 }
 
 void MainWindow::handleLoreBookBack()
@@ -863,7 +1083,7 @@ void MainWindow::handleOpenDialogue(const QString &dialogueId)
 {
     if (!m_game || !m_game->getDialogueManager()) return;
 
-    m_game->getDialogueManager()->startDialogue(dialogueId);
+    m_game->getDialogueManager()->startDialogue(ContentId(dialogueId));
 }
 
 // Final Boss and Victory Handlers (Phase 4)
@@ -878,12 +1098,13 @@ void MainWindow::handleFinalBossRequest()
     }
 
     // Show Point of No Return dialog
-    PointOfNoReturnDialog dialog(this);
-    if (dialog.exec() == QDialog::Accepted) {
-        // Player accepted - start final boss combat
-        m_game->startFinalBossCombat();
-        stackedWidget->setCurrentWidget(m_combatPage);
-    }
+    m_dialogQueue->enqueue(new PointOfNoReturnDialog(this), [this](int result) {
+        if (result == QDialog::Accepted) {
+            // Player accepted - start final boss combat
+            m_game->startFinalBossCombat();
+            stackedWidget->setCurrentWidget(m_combatPage);
+        }
+    });
 }
 
 void MainWindow::handleBossEncountered(const QString &bossName)
@@ -898,6 +1119,7 @@ void MainWindow::handleBossPhaseChanged(int newPhase)
     // Show phase transition message in CombatPage
     // Update UI with phase indicator
     qDebug() << "Boss phase changed to:" << newPhase;
+    m_animationManager->playPhaseChangeAnimation();
 }
 
 void MainWindow::handleFinalBossDefeated()
@@ -918,14 +1140,11 @@ void MainWindow::handleGameCompleted(int finalLevel, int playtime)
     int gold = player->gold;
     int quests = player->getCompletedQuests().size();
 
-    // Create and show victory screen
-    if (!m_victoryScreen) {
-        m_victoryScreen = new VictoryScreen(finalLevel, playtime, kills, deaths, gold, quests, this);
-        connect(m_victoryScreen, &VictoryScreen::continuePlaying, this, &MainWindow::handleVictoryContinue);
-        connect(m_victoryScreen, &VictoryScreen::returnToMainMenu, this, &MainWindow::handleVictoryMainMenu);
-    }
-
-    m_victoryScreen->exec();
+    // Create and show victory screen; built per completion so the statistics are current
+    VictoryScreen *victoryScreen = new VictoryScreen(finalLevel, playtime, kills, deaths, gold, quests, this);
+    connect(victoryScreen, &VictoryScreen::continuePlaying, this, &MainWindow::handleVictoryContinue);
+    connect(victoryScreen, &VictoryScreen::returnToMainMenu, this, &MainWindow::handleVictoryMainMenu);
+    m_dialogQueue->enqueue(victoryScreen);
 }
 
 void MainWindow::handleVictoryContinue()
@@ -3,11 +3,13 @@
 
 #include <QMainWindow>
 #include "models/StoryEvent.h"
+#include "game/ContentId.h"
 #include "views/VictoryScreen.h"
 #include "components/PointOfNoReturnDialog.h"
 
 class QStackedWidget;
 class Item;
+class Player;
 class MainMenu;
 class NewGameView;
 class CharacterCustomizationPage;
@@ -25,6 +27,12 @@ class LoreBookPage;
 class Game;
 class MenuOverlay;
 class AnimationManager;
+class PerformanceOverlay;
+class PageRegistry;
+class ContentWarmup;
+class ContentWatcher;
+class DialogQueue;
+class QuestListModel;
 
 class MainWindow : public QMainWindow
 {
@@ -68,19 +76,19 @@ private slots:
     void handleOpenQuestLog();
     void handleQuestLogBack();
     void handleQuestAccepted(const QString &questId);
-    void handleQuestCompleted(const QString &questId, int expReward, int goldReward);
+    void handleQuestCompleted(ContentId questId, int expReward, int goldReward);
     void handleCombatEnd(int oldLevel);
     void handleCombatEnded(bool playerWon);
     void handleMenuButtonClicked();
     void onAnimationFinished();
 
     // Narrative system handlers (Phase 3)
-    void handleDialogueNodeChanged(const QString &nodeId, const QString &speaker, const QString &text);
+    void handleDialogueNodeChanged(ContentId nodeId, const QString &speaker, const QString &text);
     void handleDialogueChoiceSelected(int choiceIndex);
     void handleDialogueEnded();
     void handleDialogueEffectTriggered(const QString &effectType, const QString &target, int value);
     void handleStoryEventTriggered(const StoryEvent &event);
-    void handleLoreUnlocked(const QString &entryId, const QString &title);
+    void handleLoreUnlocked(ContentId entryId, const QString &title);
     void handleLoreUnlockedFromPurchase(const QString &loreId);
     void handleOpenLoreBook();
     void handleLoreBookBack();
@@ -95,30 +103,52 @@ private slots:
     void handleVictoryContinue();
     void handleVictoryMainMenu();
 
+    // Content hot reload
+    void handleContentChanged();
+
+    void handlePlayerChanged(Player *player);
+
 protected:
     void keyPressEvent(QKeyEvent *event) override;
     void resizeEvent(QResizeEvent *event) override;
 
 private:
+    void toggleTraceCapture();
+    void dumpAllocationReport();
+
+    // Pages other than the main menu and the combat hub are built on first navigation
+    enum PageId {
+        NewGamePageId,
+        CharacterCustomizationPageId,
+        InventoryPageId,
+        MonsterStatsPageId,
+        SaveLoadPageId,
+        ShopPageId,
+        StatsPageId,
+        QuestLogPageId,
+        DialoguePageId,
+        LoreBookPageId
+    };
+    void registerPages();
+    void attachQuestModel();  // Points the shared quest model at the current game's manager
+    void startContentWarmup();
+    void startContentWatcher();  // Only when a content override directory is configured
+
     enum CombatState { Idle, PlayerAttacking, PlayerDamage, MonsterTurn, CombatEnded };
 
     QStackedWidget *stackedWidget;
     MainMenu *m_mainMenu;
-    NewGameView *m_newGameView;
-    CharacterCustomizationPage *m_characterCustomizationPage;
     CombatPage *m_combatPage;
-    InventoryPage *m_inventoryPage;
-    MonsterStatsPage *m_monsterStatsPage;
-    SaveLoadPage *m_saveLoadPage;
-    ShopPage *m_shopPage;
-    StatsPage *m_statsPage;
-    QuestLogPage *m_questLogPage;
-    DialogueView *m_dialogueView;
-    LoreBookPage *m_loreBookPage;
-    VictoryScreen *m_victoryScreen;
+    PageRegistry *m_pages;
+    QuestListModel *m_questModel;  // Outlives the quest log page; shared with the combat tracker
     Game *m_game;
     MenuOverlay *m_menuOverlay;
     AnimationManager *m_animationManager;
+    PerformanceOverlay *m_performanceOverlay;
+    ContentWarmup *m_contentWarmup;
+    ContentWatcher *m_contentWatcher;
+    DialogQueue *m_dialogQueue;
+    QObject *m_traceInputFilter;
     CombatState m_combatState;
 };
 
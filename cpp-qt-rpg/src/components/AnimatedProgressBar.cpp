@@ -1,10 +1,10 @@
 #include "AnimatedProgressBar.h"
+#include "AnimationSpeed.h"
 
 AnimatedProgressBar::AnimatedProgressBar(QWidget *parent)
     : QProgressBar(parent),
       m_animation(new QPropertyAnimation(this, "value", this))
 {
-    m_animation->setDuration(500); // 500ms animation
     m_animation->setEasingCurve(QEasingCurve::OutCubic);
 }
 
@@ -14,7 +14,13 @@ void AnimatedProgressBar::setValueAnimation(int value)
         m_animation->stop();
     }
 
+    if (AnimationSpeed::instance().isInstant()) {
+        QProgressBar::setValue(value);
+        return;
+    }
+
+    m_animation->setDuration(AnimationSpeed::instance().scaled(ANIMATION_MS));
     m_animation->setStartValue(this->value());
     m_animation->setEndValue(value);
     m_animation->start();
-}
\ No newline at end of file
+}
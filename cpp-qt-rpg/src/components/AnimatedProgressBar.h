@@ -17,6 +17,8 @@ public slots:
     void setValueAnimation(int value);
 
 private:
+    static const int ANIMATION_MS = 500;
+
     QPropertyAnimation *m_animation;
 };
 
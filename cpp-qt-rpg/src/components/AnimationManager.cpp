@@ -1,12 +1,23 @@
 #include "AnimationManager.h"
 #include "../views/CombatPage.h"
-#include "ParticleSystem.h"
-#include <QPropertyAnimation>
-#include <QSequentialAnimationGroup>
-#include <QPauseAnimation>
-#include <QLabel>
 #include <QEasingCurve>
-#include <QTimer>
+#include <cmath>
+
+namespace {
+
+const int LUNGE_MS = 300;
+const int LUNGE_HOLD_MS = 100;
+const int SHAKE_MS = 240;
+const int SHAKE_AMPLITUDE = 8;
+const int PHASE_FLASH_MS = 600;
+
+// Damped back-and-forth offset for a hit, 0 at both ends
+qreal shakeOffset(qreal progress, qreal amplitude)
+{
+    return amplitude * (1.0 - progress) * std::sin(progress * 6.0 * M_PI);
+}
+
+} // namespace
 
 AnimationManager::AnimationManager(CombatPage *combatPage, QObject *parent)
     : QObject(parent), m_combatPage(combatPage)
@@ -15,64 +26,69 @@ AnimationManager::AnimationManager(CombatPage *combatPage, QObject *parent)
 
 void AnimationManager::playPlayerAttackAnimation()
 {
-    QLabel* heroSprite = m_combatPage->getHeroSpriteLabel();
-    QLabel* enemySprite = m_combatPage->getEnemySpriteLabel();
-    ParticleSystem* particles = m_combatPage->getParticleSystem();
-
-    if (!heroSprite || !enemySprite) {
-        emit animationFinished();
-        return;
-    }
-
-    // Raise hero sprite to ensure it renders on top of sibling widgets during animation
-    heroSprite->raise();
-
-    QPoint startPos = heroSprite->pos();
-    QPoint endPos = enemySprite->pos();
+    CombatCanvas *canvas = m_combatPage->getCombatCanvas();
+    const qint64 start = canvas->now();
 
-    QSequentialAnimationGroup *group = new QSequentialAnimationGroup(this);
+    // Lunge to the enemy, hold, come back
+    canvas->addTrack(start, LUNGE_MS, QEasingCurve::InOutQuad, [canvas](qreal progress) {
+        canvas->setLunge(CombatCanvas::Hero, progress);
+    });
 
-    // Animation to move to the enemy
-    QPropertyAnimation *attackAnimation = new QPropertyAnimation(heroSprite, "pos");
-    attackAnimation->setDuration(300);
-    attackAnimation->setStartValue(startPos);
-    attackAnimation->setEndValue(endPos);
-    attackAnimation->setEasingCurve(QEasingCurve::InOutQuad);
+    // Particle effect at impact, when the hero reaches the enemy
+    canvas->addCue(start + ParticleConstants::ATTACK_IMPACT_DELAY_MS, [canvas]() {
+        canvas->burst(CombatCanvas::Enemy, 10, "spark", "#e74c3c");
+    });
 
-    // Trigger particle effect at impact (midpoint of attack)
-    if (particles) {
-        QTimer::singleShot(ParticleConstants::ATTACK_IMPACT_DELAY_MS, [particles, enemySprite]() {
-            QPoint impactPos = enemySprite->geometry().center();
-            particles->createBurst(impactPos, 10, "spark", "#e74c3c", false);
-        });
-    }
+    canvas->addTrack(start + LUNGE_MS + LUNGE_HOLD_MS, LUNGE_MS, QEasingCurve::InOutQuad, [canvas](qreal progress) {
+        canvas->setLunge(CombatCanvas::Hero, 1.0 - progress);
+    }, [this]() {
+        emit animationFinished();
+    });
+}
 
-    // Animation to return to the original position
-    QPropertyAnimation *returnAnimation = new QPropertyAnimation(heroSprite, "pos");
-    returnAnimation->setDuration(300);
-    returnAnimation->setStartValue(endPos);
-    returnAnimation->setEndValue(startPos);
-    returnAnimation->setEasingCurve(QEasingCurve::InOutQuad);
+void AnimationManager::playDamageAnimation(CombatCanvas::Combatant target)
+{
+    CombatCanvas *canvas = m_combatPage->getCombatCanvas();
 
-    group->addAnimation(attackAnimation);
-    group->addPause(100);
-    group->addAnimation(returnAnimation);
+    // Damage indicator particles at the target, which shakes off the hit
+    canvas->burst(target, 8, "spark", "#e74c3c");
+    canvas->addTrack(canvas->now(), SHAKE_MS, QEasingCurve::Linear, [canvas, target](qreal progress) {
+        canvas->setShake(target, shakeOffset(progress, SHAKE_AMPLITUDE));
+    }, [this]() {
+        emit animationFinished();
+    });
+}
 
-    connect(group, &QSequentialAnimationGroup::finished, this, &AnimationManager::animationFinished);
-    connect(group, &QSequentialAnimationGroup::finished, group, &QSequentialAnimationGroup::deleteLater);
+void AnimationManager::playPhaseChangeAnimation()
+{
+    CombatCanvas *canvas = m_combatPage->getCombatCanvas();
+    const qint64 start = canvas->now();
 
-    group->start();
+    // The arena flashes red while the boss shudders
+    canvas->addTrack(start, PHASE_FLASH_MS, QEasingCurve::Linear, [canvas](qreal progress) {
+        canvas->setFlash(1.0 - std::abs(2.0 * progress - 1.0));
+    });
+    canvas->addTrack(start, PHASE_FLASH_MS, QEasingCurve::Linear, [canvas](qreal progress) {
+        canvas->setShake(CombatCanvas::Enemy, shakeOffset(progress, 2 * SHAKE_AMPLITUDE));
+    });
+    canvas->addCue(start + PHASE_FLASH_MS / 2, [canvas]() {
+        canvas->burst(CombatCanvas::Enemy, 16, "star", "#c678dd");
+    });
 }
 
-void AnimationManager::playDamageAnimation(QLabel* target)
+void AnimationManager::playCombatEndAnimation(bool playerWon)
 {
-    ParticleSystem* particles = m_combatPage->getParticleSystem();
+    CombatCanvas *canvas = m_combatPage->getCombatCanvas();
+    QPointF centerPos = canvas->rect().center();
 
-    if (particles && target) {
-        // Trigger damage indicator particles at target location
-        QPoint damagePos = target->geometry().center();
-        particles->createBurst(damagePos, 8, "spark", "#e74c3c", false);
+    if (playerWon) {
+        // Victory explosion: stars, then a second burst of sparks
+        canvas->burstAt(centerPos, 8, "star", "#e5c07b");
+        canvas->addCue(canvas->now() + ParticleConstants::VICTORY_SECOND_BURST_DELAY_MS, [canvas, centerPos]() {
+            canvas->burstAt(centerPos, 6, "spark", "#98c379");
+        });
+    } else {
+        // Defeat effect (red particles)
+        canvas->burstAt(centerPos, 12, "spark", "#8b0000");
     }
-
-    emit animationFinished();
 }
@@ -2,10 +2,11 @@
 #define ANIMATIONMANAGER_H
 
 #include <QObject>
+#include "CombatCanvas.h"
 
 class CombatPage;
-class QLabel;
 
+// Schedules combat animations as tracks on the combat canvas's timeline
 class AnimationManager : public QObject
 {
     Q_OBJECT
@@ -13,7 +14,9 @@ public:
     explicit AnimationManager(CombatPage *combatPage, QObject *parent = nullptr);
 
     void playPlayerAttackAnimation();
-    void playDamageAnimation(QLabel* target);
+    void playDamageAnimation(CombatCanvas::Combatant target);
+    void playPhaseChangeAnimation();
+    void playCombatEndAnimation(bool playerWon);
 
 signals:
     void animationFinished();
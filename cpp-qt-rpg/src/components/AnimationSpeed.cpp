@@ -0,0 +1,105 @@
+#include "AnimationSpeed.h"
+#include <QSettings>
+#include <QDebug>
+
+namespace {
+
+const char *SETTINGS_KEY = "ui/animationSpeed";
+const qint64 INSTANT_ELAPSED_MS = 60 * 1000;  // Longer than any animation
+
+int speedFactor(AnimationSpeed::Speed speed)
+{
+    switch (speed) {
+        case AnimationSpeed::Double: return 2;
+        case AnimationSpeed::Quadruple: return 4;
+        default: return 1;
+    }
+}
+
+} // namespace
+
+AnimationSpeed &AnimationSpeed::instance()
+{
+    static AnimationSpeed speed;
+    return speed;
+}
+
+AnimationSpeed::AnimationSpeed()
+    : m_speed(Normal)
+{
+    QSettings settings;
+    QString saved = settings.value(SETTINGS_KEY, key(Normal)).toString();
+    if (!fromKey(saved, &m_speed)) {
+        qWarning() << "Ignoring invalid" << SETTINGS_KEY << "setting" << saved;
+    }
+
+    if (qEnvironmentVariableIsSet("PYRPG_ANIMATION_SPEED")) {
+        QString value = qEnvironmentVariable("PYRPG_ANIMATION_SPEED");
+        if (!fromKey(value, &m_speed)) {
+            qWarning() << "Ignoring invalid PYRPG_ANIMATION_SPEED value" << value;
+        }
+    }
+}
+
+void AnimationSpeed::setSpeed(Speed speed)
+{
+    if (speed == m_speed) {
+        return;
+    }
+    m_speed = speed;
+    emit speedChanged(speed);
+}
+
+void AnimationSpeed::saveSpeed(Speed speed)
+{
+    QSettings settings;
+    settings.setValue(SETTINGS_KEY, key(speed));
+    setSpeed(speed);
+}
+
+int AnimationSpeed::scaled(int ms) const
+{
+    if (isInstant()) {
+        return 0;
+    }
+    return ms / speedFactor(m_speed);
+}
+
+qint64 AnimationSpeed::scaledElapsed(qint64 elapsedMs) const
+{
+    if (isInstant()) {
+        return INSTANT_ELAPSED_MS;
+    }
+    return elapsedMs * speedFactor(m_speed);
+}
+
+QString AnimationSpeed::label(Speed speed)
+{
+    switch (speed) {
+        case Double: return "2x";
+        case Quadruple: return "4x";
+        case Instant: return "Instant";
+        default: return "Normal";
+    }
+}
+
+QString AnimationSpeed::key(Speed speed)
+{
+    switch (speed) {
+        case Double: return "2x";
+        case Quadruple: return "4x";
+        case Instant: return "instant";
+        default: return "normal";
+    }
+}
+
+bool AnimationSpeed::fromKey(const QString &key, Speed *speed)
+{
+    for (Speed candidate : {Normal, Double, Quadruple, Instant}) {
+        if (key.compare(AnimationSpeed::key(candidate), Qt::CaseInsensitive) == 0) {
+            *speed = candidate;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,65 @@
+#ifndef ANIMATIONSPEED_H
+#define ANIMATIONSPEED_H
+
+#include <QObject>
+#include <QTimer>
+#include <utility>
+
+// How fast cosmetic animations play. Every animation delay and duration in the
+// game goes through scaled(), and frame clocks advance by scaledElapsed().
+//
+// Instant completes animations synchronously: combat timelines run to their end
+// as soon as tracks are added, property animations jump to their end value,
+// delayed effects run right away and particles are skipped. The speed is a
+// player setting (menu overlay); PYRPG_ANIMATION_SPEED=normal|2x|4x|instant
+// overrides it for one run, which is how the UI tests skip cosmetic delays.
+//
+// GUI thread only.
+class AnimationSpeed : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Speed { Normal, Double, Quadruple, Instant };
+    Q_ENUM(Speed)
+
+    static AnimationSpeed &instance();
+
+    Speed speed() const { return m_speed; }
+    bool isInstant() const { return m_speed == Instant; }
+    // For this session only; saveSpeed() also remembers it in the settings
+    void setSpeed(Speed speed);
+    void saveSpeed(Speed speed);
+
+    // A duration or delay at the current speed; 0 when instant
+    int scaled(int ms) const;
+    // Game time that passes in elapsedMs of wall time. When instant, long enough
+    // to finish anything still in flight on the next frame.
+    qint64 scaledElapsed(qint64 elapsedMs) const;
+
+    // Runs functor after a scaled delay, or before returning when instant
+    template <typename Functor>
+    void runAfter(int ms, const QObject *context, Functor &&functor) const
+    {
+        if (isInstant()) {
+            functor();
+        } else {
+            QTimer::singleShot(scaled(ms), context, std::forward<Functor>(functor));
+        }
+    }
+
+    static QString label(Speed speed);
+    // Settings and environment spelling: "normal", "2x", "4x", "instant"
+    static QString key(Speed speed);
+    static bool fromKey(const QString &key, Speed *speed);
+
+signals:
+    void speedChanged(AnimationSpeed::Speed speed);
+
+private:
+    AnimationSpeed();
+
+    Speed m_speed;
+};
+
+#endif // ANIMATIONSPEED_H
@@ -0,0 +1,399 @@
+#include "CombatCanvas.h"
+#include "SpriteCache.h"
+#include "AnimationSpeed.h"
+#include "../diagnostics/Profiler.h"
+#include "../theme/Theme.h"
+#include <QPainter>
+#include <QPaintEvent>
+#include <QTimer>
+#include <QFont>
+#include <QFontMetrics>
+
+namespace {
+
+const int BAR_HEIGHT = 18;
+const int NAME_HEIGHT = 24;
+const int MIDDLE_WIDTH = 48;             // Gap between the two sprite columns
+const int BAR_SLIDE_MS = 400;
+const int FLOATING_TEXT_DURATION_MS = 900;
+
+const QColor HERO_HEALTH_COLOR("#dc3545");
+const QColor HERO_MANA_COLOR("#3b82f6");
+const QColor ENEMY_HEALTH_COLOR("#ef4444");
+
+} // namespace
+
+CombatCanvas::CombatCanvas(QWidget *parent)
+    : QWidget(parent)
+    , m_inCombat(false)
+    , m_flash(0.0)
+    , m_finishing(false)
+    , m_frameTimer(new QTimer(this))
+{
+    m_frameTimer->setTimerType(Qt::PreciseTimer);
+    m_frameTimer->setInterval(ParticleConstants::FRAME_INTERVAL_MS);
+    connect(m_frameTimer, &QTimer::timeout, this, &CombatCanvas::advanceFrame);
+}
+
+void CombatCanvas::setSprite(Fighter &fighter, const QString &spritePath)
+{
+    // Sprite only changes with the class or enemy type; cached pixmaps avoid decoding/scaling per turn
+    if (spritePath == fighter.spritePath) {
+        return;
+    }
+    fighter.spritePath = spritePath;
+    fighter.sprite = SpriteCache::instance().pixmap(spritePath, QSize(SPRITE_SIZE, SPRITE_SIZE), devicePixelRatioF());
+}
+
+void CombatCanvas::setHero(const QString &spritePath, int health, int maxHealth, int mana, int maxMana)
+{
+    Fighter &hero = m_fighters[Hero];
+    setSprite(hero, spritePath);
+
+    int oldHealth = hero.health;
+    int oldMana = hero.mana;
+    hero.health = health;
+    hero.maxHealth = maxHealth;
+    hero.mana = mana;
+    hero.maxMana = maxMana;
+
+    if (!hero.present) {
+        hero.present = true;
+        hero.shownHealth = health;
+        hero.shownMana = mana;
+    } else {
+        if (health != oldHealth) {
+            if (m_inCombat) {
+                showFloatingText(Hero, QString::asprintf("%+d", health - oldHealth),
+                                 health < oldHealth ? Theme::DESTRUCTIVE : Theme::SUCCESS);
+            }
+            slideBar(&hero.shownHealth, health);
+        }
+        if (mana != oldMana) {
+            slideBar(&hero.shownMana, mana);
+        }
+    }
+    update();
+}
+
+void CombatCanvas::setEnemy(const QString &spritePath, const QString &title, int health, int maxHealth)
+{
+    Fighter &enemy = m_fighters[Enemy];
+    // A different monster starts from its own values instead of sliding from the last one's
+    bool newEnemy = !enemy.present || spritePath != enemy.spritePath || title != enemy.title;
+    setSprite(enemy, spritePath);
+
+    int oldHealth = enemy.health;
+    enemy.title = title;
+    enemy.health = health;
+    enemy.maxHealth = maxHealth;
+
+    if (newEnemy) {
+        enemy.present = true;
+        enemy.shownHealth = health;
+    } else if (health != oldHealth) {
+        showFloatingText(Enemy, QString::asprintf("%+d", health - oldHealth),
+                         health < oldHealth ? Theme::WARNING : Theme::SUCCESS);
+        slideBar(&enemy.shownHealth, health);
+    }
+    update();
+}
+
+void CombatCanvas::setCombatMode(bool inCombat)
+{
+    if (m_inCombat == inCombat) {
+        return;
+    }
+    m_inCombat = inCombat;
+    if (inCombat) {
+        // The next setEnemy() is a new encounter, even against the same kind of monster
+        m_fighters[Enemy].present = false;
+    }
+    updateGeometry();
+    update();
+}
+
+void CombatCanvas::slideBar(qreal *shown, int target)
+{
+    const qreal from = *shown;
+    addTrack(now(), BAR_SLIDE_MS, QEasingCurve::OutCubic, [shown, from, target](qreal progress) {
+        *shown = from + (target - from) * progress;
+    });
+}
+
+void CombatCanvas::addTrack(qint64 startMs, int durationMs, const QEasingCurve &easing,
+                            const CombatTimeline::Apply &apply, const CombatTimeline::Callback &onFinished)
+{
+    m_timeline.addTrack(startMs, durationMs, easing, apply, onFinished);
+    ensureRunning();
+}
+
+void CombatCanvas::addCue(qint64 atMs, const CombatTimeline::Callback &callback)
+{
+    m_timeline.addCue(atMs, callback);
+    ensureRunning();
+}
+
+void CombatCanvas::setLunge(Combatant who, qreal amount)
+{
+    m_fighters[who].lunge = amount;
+}
+
+void CombatCanvas::setShake(Combatant who, qreal offset)
+{
+    m_fighters[who].shake = offset;
+}
+
+void CombatCanvas::setFlash(qreal strength)
+{
+    m_flash = qBound(0.0, strength, 1.0);
+}
+
+void CombatCanvas::burst(Combatant at, int particleCount, const QString &particleType, const QString &color)
+{
+    burstAt(anchor(at), particleCount, particleType, color);
+}
+
+void CombatCanvas::burstAt(const QPointF &pos, int particleCount, const QString &particleType, const QString &color)
+{
+    PYRPG_PROFILE_SCOPE("CombatCanvas::burst");
+    if (AnimationSpeed::instance().isInstant()) {
+        return;
+    }
+    if (m_particles.spawnBurst(pos, particleCount, particleType, color, font(), devicePixelRatioF()) > 0) {
+        ensureRunning();
+    }
+}
+
+void CombatCanvas::showFloatingText(Combatant over, const QString &text, const QColor &color)
+{
+    if (AnimationSpeed::instance().isInstant()) {
+        return;
+    }
+    m_floatingTexts.append({over, text, color, 0.0f});
+    ensureRunning();
+}
+
+bool CombatCanvas::isAnimating() const
+{
+    return !m_timeline.isIdle() || !m_particles.isEmpty() || !m_floatingTexts.isEmpty();
+}
+
+void CombatCanvas::ensureRunning()
+{
+    if (AnimationSpeed::instance().isInstant()) {
+        // Tracks that callbacks add while finishing are picked up by the same loop
+        if (!m_finishing) {
+            m_finishing = true;
+            m_timeline.finish();
+            m_finishing = false;
+            update();
+        }
+        return;
+    }
+    if (!m_frameTimer->isActive()) {
+        m_frameClock.start();
+        m_frameTimer->start();
+    }
+}
+
+void CombatCanvas::advanceFrame()
+{
+    PYRPG_PROFILE_SCOPE("CombatCanvas::advanceFrame");
+    const qint64 elapsedMs = AnimationSpeed::instance().scaledElapsed(m_frameClock.restart());
+
+    m_timeline.advance(elapsedMs);
+    m_particles.advance(static_cast<float>(elapsedMs));
+
+    int i = 0;
+    while (i < m_floatingTexts.size()) {
+        m_floatingTexts[i].ageMs += elapsedMs;
+        if (m_floatingTexts[i].ageMs >= FLOATING_TEXT_DURATION_MS) {
+            m_floatingTexts.removeAt(i);
+        } else {
+            ++i;
+        }
+    }
+
+    // One repaint of the arena per frame, however many things moved
+    update();
+    if (!isAnimating()) {
+        m_frameTimer->stop();
+    }
+}
+
+QRectF CombatCanvas::restingSpriteRect(Combatant who) const
+{
+    const int margin = Theme::SPACING_MD;
+    QRectF content = QRectF(rect()).adjusted(margin, margin, -margin, -margin);
+    const qreal columnWidth = (content.width() - MIDDLE_WIDTH) / 2;
+    const qreal blockHeight = SPRITE_SIZE + Theme::SPACING_XS + NAME_HEIGHT
+                            + 2 * (Theme::SPACING_XS + BAR_HEIGHT);
+    const qreal top = content.top() + qMax(0.0, (content.height() - blockHeight) / 2);
+    const qreal columnLeft = who == Hero ? content.left() : content.right() - columnWidth;
+    return QRectF(columnLeft + (columnWidth - SPRITE_SIZE) / 2, top, SPRITE_SIZE, SPRITE_SIZE);
+}
+
+QRectF CombatCanvas::spriteRect(Combatant who) const
+{
+    QRectF resting = restingSpriteRect(who);
+    Combatant opponent = who == Hero ? Enemy : Hero;
+    qreal travel = restingSpriteRect(opponent).left() - resting.left();
+    const Fighter &fighter = m_fighters[who];
+    return resting.translated(fighter.lunge * travel + fighter.shake, 0);
+}
+
+QPointF CombatCanvas::anchor(Combatant who) const
+{
+    return restingSpriteRect(who).center();
+}
+
+void CombatCanvas::paintBar(QPainter &painter, const QRectF &rect, qreal value, int maximum,
+                            const QColor &fill, const QString &suffix) const
+{
+    painter.setPen(QPen(Theme::BORDER, Theme::BORDER_WIDTH_MEDIUM));
+    painter.setBrush(Theme::MUTED);
+    painter.drawRoundedRect(rect, Theme::BORDER_RADIUS_SM, Theme::BORDER_RADIUS_SM);
+
+    if (maximum > 0 && value > 0) {
+        QRectF filled = rect.adjusted(1, 1, -1, -1);
+        filled.setWidth(filled.width() * qMin(1.0, value / maximum));
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(fill);
+        painter.drawRoundedRect(filled, Theme::BORDER_RADIUS_SM, Theme::BORDER_RADIUS_SM);
+    }
+
+    painter.setPen(Theme::FOREGROUND);
+    painter.drawText(rect, Qt::AlignCenter, QString("%1 / %2 %3").arg(qRound(value)).arg(maximum).arg(suffix));
+}
+
+void CombatCanvas::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event);
+    PYRPG_PROFILE_SCOPE("CombatCanvas::paint");
+
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    // Arena frame
+    painter.setPen(QPen(Theme::BORDER, Theme::BORDER_WIDTH_MEDIUM));
+    painter.setBrush(Theme::CARD);
+    painter.drawRoundedRect(QRectF(rect()).adjusted(1, 1, -1, -1), Theme::BORDER_RADIUS_MD, Theme::BORDER_RADIUS_MD);
+
+    QFont barFont = font();
+    barFont.setPixelSize(Theme::FONT_SIZE_SM);
+    barFont.setBold(true);
+
+    const Fighter &hero = m_fighters[Hero];
+    const Fighter &enemy = m_fighters[Enemy];
+    const int margin = Theme::SPACING_MD;
+
+    if (!m_inCombat) {
+        // Hub: just the hero's health and mana across the arena
+        QRectF bar(margin, margin, width() - 2 * margin, BAR_HEIGHT);
+        painter.setFont(barFont);
+        paintBar(painter, bar, hero.shownHealth, hero.maxHealth, HERO_HEALTH_COLOR, "HP");
+        paintBar(painter, bar.translated(0, BAR_HEIGHT + Theme::SPACING_XS), hero.shownMana, hero.maxMana,
+                 HERO_MANA_COLOR, "MP");
+    } else {
+        const QRectF heroRest = restingSpriteRect(Hero);
+        const QRectF enemyRest = restingSpriteRect(Enemy);
+
+        // Crossed swords between the fighters
+        QFont glyphFont = font();
+        glyphFont.setPixelSize(Theme::FONT_SIZE_XXL);
+        painter.setFont(glyphFont);
+        painter.setPen(Theme::FOREGROUND);
+        painter.drawText(QRectF(heroRest.right(), heroRest.top(), enemyRest.left() - heroRest.right(), SPRITE_SIZE),
+                         Qt::AlignCenter, "⚔️");
+
+        // Enemy first, so a lunging hero passes in front of it
+        QFont fallbackFont = font();
+        fallbackFont.setPixelSize(Theme::FONT_SIZE_XL);
+        const Combatant order[] = {Enemy, Hero};
+        for (Combatant who : order) {
+            const Fighter &fighter = m_fighters[who];
+            if (!fighter.present) {
+                continue;
+            }
+            QRectF target = spriteRect(who);
+            if (!fighter.sprite.isNull()) {
+                QSizeF size = fighter.sprite.deviceIndependentSize();
+                QPointF topLeft = target.center() - QPointF(size.width() / 2, size.height() / 2);
+                painter.drawPixmap(topLeft, fighter.sprite);
+            } else {
+                painter.setFont(fallbackFont);
+                painter.setPen(Theme::FOREGROUND);
+                painter.drawText(target, Qt::AlignCenter, who == Hero ? "🛡️ HERO" : "👹 ENEMY");
+            }
+        }
+
+        // Monster name under the enemy, then the bars under each fighter
+        const qreal columnWidth = (width() - 2 * margin - MIDDLE_WIDTH) / 2.0;
+        const qreal nameTop = heroRest.bottom() + Theme::SPACING_XS;
+        const qreal barTop = nameTop + NAME_HEIGHT + Theme::SPACING_XS;
+        QRectF heroColumn(margin, barTop, columnWidth, BAR_HEIGHT);
+        QRectF enemyColumn(width() - margin - columnWidth, barTop, columnWidth, BAR_HEIGHT);
+
+        if (enemy.present) {
+            QFont nameFont = font();
+            nameFont.setPixelSize(Theme::FONT_SIZE_LG);
+            nameFont.setBold(true);
+            painter.setFont(nameFont);
+            painter.setPen(Theme::FOREGROUND);
+            QRectF nameRect(enemyColumn.left(), nameTop, columnWidth, NAME_HEIGHT);
+            painter.drawText(nameRect, Qt::AlignCenter,
+                             painter.fontMetrics().elidedText(enemy.title, Qt::ElideRight, int(columnWidth)));
+        }
+
+        painter.setFont(barFont);
+        paintBar(painter, heroColumn, hero.shownHealth, hero.maxHealth, HERO_HEALTH_COLOR, "HP");
+        paintBar(painter, heroColumn.translated(0, BAR_HEIGHT + Theme::SPACING_XS), hero.shownMana, hero.maxMana,
+                 HERO_MANA_COLOR, "MP");
+        if (enemy.present) {
+            paintBar(painter, enemyColumn, enemy.shownHealth, enemy.maxHealth, ENEMY_HEALTH_COLOR, "HP");
+        }
+    }
+
+    m_particles.paint(painter);
+
+    // Damage numbers rise from the top of the sprite and fade out
+    if (!m_floatingTexts.isEmpty()) {
+        QFont textFont = font();
+        textFont.setPixelSize(Theme::FONT_SIZE_XL);
+        textFont.setBold(true);
+        painter.setFont(textFont);
+        for (const FloatingText &text : m_floatingTexts) {
+            float progress = text.ageMs / FLOATING_TEXT_DURATION_MS;
+            QRectF sprite = restingSpriteRect(text.over);
+            QRectF textRect(sprite.left() - SPRITE_SIZE / 2, sprite.top() - ParticleConstants::TEXT_FLOAT_DISTANCE * progress,
+                            sprite.width() + SPRITE_SIZE, NAME_HEIGHT);
+            painter.setOpacity(progress < 0.5f ? 1.0 : 2.0 * (1.0 - progress));
+            painter.setPen(text.color);
+            painter.drawText(textRect, Qt::AlignCenter, text.text);
+        }
+        painter.setOpacity(1.0);
+    }
+
+    if (m_flash > 0.0) {
+        QColor tint = Theme::DESTRUCTIVE;
+        tint.setAlphaF(0.4 * m_flash);
+        painter.fillRect(rect(), tint);
+    }
+}
+
+QSize CombatCanvas::sizeHint() const
+{
+    return minimumSizeHint() + QSize(0, Theme::SPACING_LG);
+}
+
+QSize CombatCanvas::minimumSizeHint() const
+{
+    const int margin = Theme::SPACING_MD;
+    const int width = 2 * SPRITE_SIZE + MIDDLE_WIDTH + 2 * margin;
+    if (!m_inCombat) {
+        return QSize(width, 2 * margin + 2 * BAR_HEIGHT + Theme::SPACING_XS);
+    }
+    return QSize(width, 2 * margin + SPRITE_SIZE + Theme::SPACING_XS + NAME_HEIGHT
+                        + 2 * (Theme::SPACING_XS + BAR_HEIGHT));
+}
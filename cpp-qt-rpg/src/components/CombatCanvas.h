@@ -0,0 +1,119 @@
+#ifndef COMBATCANVAS_H
+#define COMBATCANVAS_H
+
+#include <QWidget>
+#include <QPixmap>
+#include <QElapsedTimer>
+#include <QVector>
+#include "CombatTimeline.h"
+#include "ParticleField.h"
+
+class QTimer;
+
+// The combat arena, painted in one paintEvent: both sprites, the monster name,
+// health and mana bars, floating damage numbers and particles.
+//
+// Nothing in the arena is a child widget, so an animation frame never moves a
+// widget or touches a layout; it advances the timeline, particles and floating
+// text by the elapsed time and repaints this one widget. The frame timer only
+// runs while something is moving. Element positions are derived from the
+// widget's current size at paint time, so the arena scales with the window.
+//
+// Elapsed time is scaled by AnimationSpeed. At instant speed, tracks run to
+// completion as they are added, and particles and floating text are skipped.
+class CombatCanvas : public QWidget
+{
+    Q_OBJECT
+
+public:
+    enum Combatant { Hero, Enemy };
+
+    static const int SPRITE_SIZE = 100;  // Logical pixels; matches the pre-scaled sprite variants
+
+    explicit CombatCanvas(QWidget *parent = nullptr);
+
+    // Bars slide to new values; in combat, health changes also float up as numbers
+    void setHero(const QString &spritePath, int health, int maxHealth, int mana, int maxMana);
+    void setEnemy(const QString &spritePath, const QString &title, int health, int maxHealth);
+    // Out of combat only the hero's bars are shown
+    void setCombatMode(bool inCombat);
+    bool isInCombat() const { return m_inCombat; }
+
+    // Tracks added here start the frame clock if it is idle
+    qint64 now() const { return m_timeline.now(); }
+    void addTrack(qint64 startMs, int durationMs, const QEasingCurve &easing,
+                  const CombatTimeline::Apply &apply,
+                  const CombatTimeline::Callback &onFinished = CombatTimeline::Callback());
+    void addCue(qint64 atMs, const CombatTimeline::Callback &callback);
+
+    // Animated poses, driven by timeline tracks
+    void setLunge(Combatant who, qreal amount);  // 0 at rest, 1 at the opponent
+    void setShake(Combatant who, qreal offset);  // Horizontal offset in pixels
+    void setFlash(qreal strength);               // Whole-arena tint, 0 to 1
+
+    void burst(Combatant at, int particleCount, const QString &particleType, const QString &color);
+    void burstAt(const QPointF &pos, int particleCount, const QString &particleType, const QString &color);
+    void showFloatingText(Combatant over, const QString &text, const QColor &color);
+
+    // Centre of the combatant's sprite at rest
+    QPointF anchor(Combatant who) const;
+
+    bool isAnimating() const;
+    int activeParticleCount() const { return m_particles.count(); }
+    int floatingTextCount() const { return m_floatingTexts.size(); }
+    qreal displayedHealth(Combatant who) const { return m_fighters[who].shownHealth; }
+
+    QSize sizeHint() const override;
+    QSize minimumSizeHint() const override;
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
+private slots:
+    void advanceFrame();
+
+private:
+    struct Fighter {
+        QString spritePath;
+        QPixmap sprite;
+        QString title;
+        int health = 0;
+        int maxHealth = 0;
+        int mana = 0;
+        int maxMana = 0;
+        qreal shownHealth = 0;
+        qreal shownMana = 0;
+        qreal lunge = 0;
+        qreal shake = 0;
+        bool present = false;
+    };
+
+    struct FloatingText {
+        Combatant over;
+        QString text;
+        QColor color;
+        float ageMs;
+    };
+
+    void setSprite(Fighter &fighter, const QString &spritePath);
+    void slideBar(qreal *shown, int target);
+    void ensureRunning();
+    QRectF spriteRect(Combatant who) const;  // Including lunge and shake
+    QRectF restingSpriteRect(Combatant who) const;
+    void paintBar(QPainter &painter, const QRectF &rect, qreal value, int maximum,
+                  const QColor &fill, const QString &suffix) const;
+
+    Fighter m_fighters[2];
+    bool m_inCombat;
+    qreal m_flash;
+    bool m_finishing;  // Inside m_timeline.finish() at instant speed
+
+    CombatTimeline m_timeline;
+    ParticleField m_particles;
+    QVector<FloatingText> m_floatingTexts;
+
+    QTimer *m_frameTimer;
+    QElapsedTimer m_frameClock;
+};
+
+#endif // COMBATCANVAS_H
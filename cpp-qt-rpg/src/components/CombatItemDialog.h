@@ -3,6 +3,7 @@
 
 #include <QDialog>
 #include <QList>
+#include "../diagnostics/AllocationTracker.h"
 
 class QListWidget;
 class QListWidgetItem;
@@ -16,6 +17,7 @@ class CombatItemDialog : public QDialog
     Q_OBJECT
 
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.dialogs")
     explicit CombatItemDialog(Player *player, QWidget *parent = nullptr);
     Item* getSelectedItem() const;
 
@@ -1,11 +1,11 @@
 #include "CombatResultDialog.h"
 #include "ParticleSystem.h"
+#include "AnimationSpeed.h"
 #include "../theme/Theme.h"
 #include <QVBoxLayout>
 #include <QLabel>
 #include <QPushButton>
 #include <QFont>
-#include <QTimer>
 
 CombatResultDialog::CombatResultDialog(bool victory, int expGained, int goldGained,
                                        const QString &lootMessage, bool leveledUp,
@@ -23,7 +23,7 @@ CombatResultDialog::CombatResultDialog(bool victory, int expGained, int goldGain
     m_particleSystem->raise();
 
     // Trigger particle effects after a short delay
-    QTimer::singleShot(ParticleConstants::COMBAT_RESULT_DELAY_MS, [this, victory, leveledUp]() {
+    AnimationSpeed::instance().runAfter(ParticleConstants::COMBAT_RESULT_DELAY_MS, this, [this, victory, leveledUp]() {
         if (m_particleSystem) {
             QPoint centerPos = rect().center();
 
@@ -33,7 +33,7 @@ CombatResultDialog::CombatResultDialog(bool victory, int expGained, int goldGain
 
                 if (leveledUp) {
                     // Additional level up particles
-                    QTimer::singleShot(ParticleConstants::LEVEL_UP_DELAY_MS, [this, centerPos]() {
+                    AnimationSpeed::instance().runAfter(ParticleConstants::LEVEL_UP_DELAY_MS, this, [this, centerPos]() {
                         m_particleSystem->levelUpBurst(centerPos);
                     });
                 }
@@ -2,6 +2,7 @@
 #define COMBATRESULTDIALOG_H
 
 #include <QDialog>
+#include "../diagnostics/AllocationTracker.h"
 
 class QLabel;
 class QPushButton;
@@ -12,6 +13,7 @@ class CombatResultDialog : public QDialog
     Q_OBJECT
 
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.dialogs")
     explicit CombatResultDialog(bool victory, int expGained, int goldGained,
                                 const QString &lootMessage, bool leveledUp,
                                 QWidget *parent = nullptr);
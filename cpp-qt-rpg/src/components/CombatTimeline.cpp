@@ -0,0 +1,61 @@
+#include "CombatTimeline.h"
+#include <limits>
+
+void CombatTimeline::addTrack(qint64 startMs, int durationMs, const QEasingCurve &easing,
+                              const Apply &apply, const Callback &onFinished)
+{
+    m_tracks.append({startMs, qMax(0, durationMs), easing, apply, onFinished});
+}
+
+void CombatTimeline::addCue(qint64 atMs, const Callback &callback)
+{
+    m_tracks.append({atMs, 0, QEasingCurve(), Apply(), callback});
+}
+
+void CombatTimeline::advance(qint64 elapsedMs)
+{
+    m_now += elapsedMs;
+
+    // Callbacks may add tracks, so run this frame's tracks from a detached list
+    QList<Track> running;
+    running.swap(m_tracks);
+
+    QList<Callback> finished;
+    for (Track &track : running) {
+        if (track.startMs > m_now) {
+            m_tracks.append(std::move(track));
+            continue;
+        }
+
+        qreal progress = track.durationMs > 0
+            ? qMin(qreal(1.0), qreal(m_now - track.startMs) / track.durationMs)
+            : 1.0;
+        if (track.apply) {
+            track.apply(track.easing.valueForProgress(progress));
+        }
+        if (progress >= 1.0) {
+            if (track.onFinished) {
+                finished.append(track.onFinished);
+            }
+        } else {
+            m_tracks.append(std::move(track));
+        }
+    }
+
+    // Completions run last, once every track has been applied for this frame
+    for (const Callback &callback : std::as_const(finished)) {
+        callback();
+    }
+}
+
+void CombatTimeline::finish()
+{
+    // Step from one start or end to the next, so cues and completions keep their order
+    while (!m_tracks.isEmpty()) {
+        qint64 next = std::numeric_limits<qint64>::max();
+        for (const Track &track : std::as_const(m_tracks)) {
+            next = qMin(next, track.startMs > m_now ? track.startMs : track.startMs + track.durationMs);
+        }
+        advance(qMax(qint64(0), next - m_now));
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef COMBATTIMELINE_H
+#define COMBATTIMELINE_H
+
+#include <QList>
+#include <QEasingCurve>
+#include <functional>
+
+// Tracks and cues placed on a single clock that its owner advances once per frame.
+//
+// A track eases a value from 0 to 1 over [start, start + duration) and hands
+// it to its apply function on every frame it overlaps; a cue is a callback at
+// one point in time. Attack lunges, hit shakes, bar slides and impact bursts
+// all run off the same clock, so they stay in step with each other and with
+// the frame that paints them. Callbacks may add further tracks.
+class CombatTimeline
+{
+public:
+    using Apply = std::function<void(qreal progress)>;
+    using Callback = std::function<void()>;
+
+    // Milliseconds since the timeline was created, as advanced by the owner
+    qint64 now() const { return m_now; }
+
+    // onFinished runs after the final apply(1.0)
+    void addTrack(qint64 startMs, int durationMs, const QEasingCurve &easing,
+                  const Apply &apply, const Callback &onFinished = Callback());
+    void addCue(qint64 atMs, const Callback &callback);
+
+    void advance(qint64 elapsedMs);
+    // Advances through every track, including ones callbacks add, until idle
+    void finish();
+    bool isIdle() const { return m_tracks.isEmpty(); }
+    int trackCount() const { return m_tracks.size(); }
+    void clear() { m_tracks.clear(); }
+
+private:
+    struct Track {
+        qint64 startMs;
+        int durationMs;
+        QEasingCurve easing;
+        Apply apply;
+        Callback onFinished;
+    };
+
+    QList<Track> m_tracks;
+    qint64 m_now = 0;
+};
+
+#endif // COMBATTIMELINE_H
@@ -0,0 +1,138 @@
+#include "DialogQueue.h"
+#include "../diagnostics/Profiler.h"
+#include <QDialog>
+#include <QApplication>
+#include <QPainter>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QResizeEvent>
+
+DialogQueue::DialogQueue(QWidget *window)
+    : QWidget(window)
+{
+    setGeometry(window->rect());
+    window->installEventFilter(this);  // Follow the window's size
+    hide();
+}
+
+DialogQueue *DialogQueue::forWindow(QWidget *widget)
+{
+    QWidget *window = widget->window();
+    DialogQueue *queue = window->findChild<DialogQueue *>(QString(), Qt::FindDirectChildrenOnly);
+    if (!queue) {
+        queue = new DialogQueue(window);
+    }
+    return queue;
+}
+
+void DialogQueue::enqueue(QDialog *dialog, const FinishedHandler &onFinished)
+{
+    if (!dialog) {
+        return;
+    }
+
+    // Embedded as a plain child widget; done() still hides it and emits finished()
+    dialog->setParent(this, Qt::Widget);
+    dialog->setAutoFillBackground(true);
+    connect(dialog, &QDialog::finished, this, [this, dialog](int result) {
+        if (dialog == m_current) {
+            handleFinished(result);
+        }
+    });
+
+    m_pending.enqueue({dialog, onFinished});
+    if (!m_current) {
+        presentNext();
+    }
+}
+
+void DialogQueue::presentNext()
+{
+    while (!m_pending.isEmpty()) {
+        Entry entry = m_pending.dequeue();
+        if (!entry.dialog) {
+            continue;  // Deleted while waiting
+        }
+
+        PYRPG_TRACE_INSTANT(entry.dialog->metaObject()->className(), "dialog");
+        m_current = entry.dialog;
+        m_currentHandler = entry.onFinished;
+        if (!isVisible()) {
+            m_previousFocusWidget = QApplication::focusWidget();
+            show();
+        }
+        raise();
+        // Keep a size the dialog set for itself, else its hint; centerCurrent() fits it to the window
+        m_preferredSize = m_current->testAttribute(Qt::WA_Resized) ? m_current->size() : m_current->sizeHint();
+        centerCurrent();
+        m_current->show();
+        m_current->setFocus();
+        return;
+    }
+
+    hide();
+    if (m_previousFocusWidget) {
+        m_previousFocusWidget->setFocus();
+    }
+    emit drained();
+}
+
+void DialogQueue::handleFinished(int result)
+{
+    QDialog *dialog = m_current;
+    FinishedHandler handler = m_currentHandler;
+    m_currentHandler = FinishedHandler();
+
+    // m_current stays set while the handler runs, so dialogs it enqueues wait
+    // behind those already pending instead of jumping the queue
+    if (handler) {
+        handler(result);
+    }
+    m_current = nullptr;
+    dialog->deleteLater();
+    presentNext();
+}
+
+void DialogQueue::centerCurrent()
+{
+    if (!m_current) {
+        return;
+    }
+    m_current->resize(m_preferredSize.boundedTo(size()));
+    m_current->move((width() - m_current->width()) / 2, (height() - m_current->height()) / 2);
+}
+
+bool DialogQueue::eventFilter(QObject *watched, QEvent *event)
+{
+    if (watched == parentWidget() && event->type() == QEvent::Resize) {
+        setGeometry(parentWidget()->rect());
+    }
+    return QWidget::eventFilter(watched, event);
+}
+
+void DialogQueue::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    painter.fillRect(rect(), QColor(0, 0, 0, 160));
+}
+
+void DialogQueue::resizeEvent(QResizeEvent *event)
+{
+    QWidget::resizeEvent(event);
+    centerCurrent();
+}
+
+void DialogQueue::keyPressEvent(QKeyEvent *event)
+{
+    // Keys the dialog ignores stop here; the window's shortcuts must not act
+    // on the page beneath
+    event->accept();
+}
+
+void DialogQueue::mousePressEvent(QMouseEvent *event)
+{
+    // Clicking the backdrop does not dismiss: results must be acknowledged
+    event->accept();
+}
@@ -0,0 +1,66 @@
+#ifndef DIALOGQUEUE_H
+#define DIALOGQUEUE_H
+
+#include <QWidget>
+#include <QQueue>
+#include <QPointer>
+#include <functional>
+
+class QDialog;
+
+// Shows dialogs inside the window, one at a time, without exec().
+//
+// A dialog handed to enqueue() is embedded as a child of a dimmed overlay that
+// covers the window, and the handler runs when the dialog finishes. Dialogs
+// enqueued while another is up wait their turn, so follow-ups (combat result,
+// then quest completion, then a story event) appear in the order they were
+// raised. No nested event loop runs, so timers, animations and autosave keep
+// going while a dialog is shown; input to the page beneath is blocked by the
+// overlay instead.
+class DialogQueue : public QWidget
+{
+    Q_OBJECT
+
+public:
+    using FinishedHandler = std::function<void(int result)>;
+
+    explicit DialogQueue(QWidget *window);
+
+    // The queue of widget's window, created on first use
+    static DialogQueue *forWindow(QWidget *widget);
+
+    // Takes ownership of the dialog; it is deleted after the handler has run
+    void enqueue(QDialog *dialog, const FinishedHandler &onFinished = FinishedHandler());
+
+    QDialog *currentDialog() const { return m_current; }
+    int pendingCount() const { return m_pending.size(); }
+    bool isActive() const { return m_current != nullptr; }
+
+signals:
+    void drained();  // The last dialog finished and the overlay hid
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void keyPressEvent(QKeyEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+
+private:
+    struct Entry {
+        QPointer<QDialog> dialog;
+        FinishedHandler onFinished;
+    };
+
+    void presentNext();
+    void handleFinished(int result);
+    void centerCurrent();
+
+    QQueue<Entry> m_pending;
+    QPointer<QDialog> m_current;
+    FinishedHandler m_currentHandler;
+    QSize m_preferredSize;
+    QPointer<QWidget> m_previousFocusWidget;
+};
+
+#endif // DIALOGQUEUE_H
@@ -0,0 +1,105 @@
+#include "InventoryItemDelegate.h"
+#include "InventoryModel.h"
+#include "../theme/Theme.h"
+#include <QPainter>
+#include <QPainterPath>
+#include <QMouseEvent>
+
+InventoryItemDelegate::InventoryItemDelegate(QObject *parent)
+    : QStyledItemDelegate(parent)
+{
+}
+
+QSize InventoryItemDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    Q_UNUSED(option);
+    Q_UNUSED(index);
+    // Uniform so the view can lay out rows without asking each one
+    return QSize(CARD_WIDTH, CARD_HEIGHT);
+}
+
+QRect InventoryItemDelegate::buttonRect(const QRect &cardRect)
+{
+    QRect inner = cardRect.adjusted(Theme::SPACING_SM + 2, 0, -(Theme::SPACING_SM + 2), -(Theme::SPACING_SM + 2));
+    return QRect(inner.left(), inner.bottom() - 30 + 1, inner.width(), 30);
+}
+
+void InventoryItemDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+
+    const bool hovered = option.state & QStyle::State_MouseOver;
+    const bool selected = option.state & QStyle::State_Selected;
+
+    // Card background; gutter between cards comes from the view's spacing
+    QRectF card = QRectF(option.rect).adjusted(1, 1, -1, -1);
+    QPainterPath cardPath;
+    cardPath.addRoundedRect(card, Theme::BORDER_RADIUS_LG, Theme::BORDER_RADIUS_LG);
+    painter->fillPath(cardPath, Theme::CARD);
+    QColor borderColor = selected ? Theme::ACCENT : (hovered ? Theme::PRIMARY : Theme::BORDER);
+    painter->setPen(QPen(borderColor, Theme::BORDER_WIDTH_MEDIUM));
+    painter->drawPath(cardPath);
+
+    QRect content = option.rect.adjusted(Theme::SPACING_SM + 2, Theme::SPACING_SM + 2, -(Theme::SPACING_SM + 2), 0);
+    QFont font = option.font;
+
+    // Item name
+    font.setBold(true);
+    font.setPixelSize(13);
+    painter->setFont(font);
+    painter->setPen(Theme::CARD_FOREGROUND);
+    QFontMetrics nameMetrics(font);
+    QRect nameRect(content.left(), content.top(), content.width(), nameMetrics.height() * 2);
+    QRect usedName;
+    painter->drawText(nameRect, Qt::AlignLeft | Qt::AlignTop | Qt::TextWordWrap,
+                      index.data(Qt::DisplayRole).toString(), &usedName);
+
+    // Item type
+    font.setBold(false);
+    font.setPixelSize(11);
+    painter->setFont(font);
+    painter->setPen(Theme::MUTED_FOREGROUND);
+    QFontMetrics typeMetrics(font);
+    int y = usedName.bottom() + 2;
+    painter->drawText(QRect(content.left(), y, content.width(), typeMetrics.height()),
+                      Qt::AlignLeft | Qt::AlignVCenter, index.data(InventoryModel::ItemTypeRole).toString());
+    y += typeMetrics.height() + 2;
+
+    // Stats
+    QString statsText = index.data(InventoryModel::StatsTextRole).toString();
+    if (!statsText.isEmpty()) {
+        font.setPixelSize(10);
+        painter->setFont(font);
+        painter->setPen(Theme::ACCENT);
+        QFontMetrics statsMetrics(font);
+        painter->drawText(QRect(content.left(), y, content.width(), statsMetrics.height()),
+                          Qt::AlignLeft | Qt::AlignVCenter,
+                          statsMetrics.elidedText(statsText, Qt::ElideRight, content.width()));
+    }
+
+    // Action button
+    QRect button = buttonRect(option.rect);
+    QPainterPath buttonPath;
+    buttonPath.addRoundedRect(QRectF(button), Theme::BORDER_RADIUS_SM, Theme::BORDER_RADIUS_SM);
+    painter->fillPath(buttonPath, hovered ? Theme::PRIMARY.lighter(110) : Theme::PRIMARY);
+    font.setPixelSize(11);
+    painter->setFont(font);
+    painter->setPen(Theme::PRIMARY_FOREGROUND);
+    painter->drawText(button, Qt::AlignCenter, index.data(InventoryModel::ActionTextRole).toString());
+
+    painter->restore();
+}
+
+bool InventoryItemDelegate::editorEvent(QEvent *event, QAbstractItemModel *model,
+                                        const QStyleOptionViewItem &option, const QModelIndex &index)
+{
+    if (event->type() == QEvent::MouseButtonRelease) {
+        QMouseEvent *mouseEvent = static_cast<QMouseEvent*>(event);
+        if (mouseEvent->button() == Qt::LeftButton && buttonRect(option.rect).contains(mouseEvent->position().toPoint())) {
+            emit actionTriggered(index);
+            return true;
+        }
+    }
+    return QStyledItemDelegate::editorEvent(event, model, option, index);
+}
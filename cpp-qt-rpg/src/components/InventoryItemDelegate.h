@@ -0,0 +1,35 @@
+#ifndef INVENTORYITEMDELEGATE_H
+#define INVENTORYITEMDELEGATE_H
+
+#include <QStyledItemDelegate>
+
+// Paints inventory cards for InventoryModel rows.
+//
+// Cards are painted rather than built from child widgets, so a QListView only
+// pays for the rows it is showing. The Use/Equip button is painted too; clicks
+// on it are reported through actionTriggered.
+class InventoryItemDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    static const int CARD_WIDTH = 160;
+    static const int CARD_HEIGHT = 130;
+
+    explicit InventoryItemDelegate(QObject *parent = nullptr);
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+    QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+    // Action button rectangle for a card painted in cardRect
+    static QRect buttonRect(const QRect &cardRect);
+
+signals:
+    void actionTriggered(const QModelIndex &index);
+
+protected:
+    bool editorEvent(QEvent *event, QAbstractItemModel *model,
+                     const QStyleOptionViewItem &option, const QModelIndex &index) override;
+};
+
+#endif // INVENTORYITEMDELEGATE_H
@@ -0,0 +1,182 @@
+#include "InventoryModel.h"
+#include "../diagnostics/Profiler.h"
+#include "../models/Player.h"
+#include "../models/Item.h"
+#include <QSet>
+
+InventoryModel::InventoryModel(QObject *parent)
+    : QAbstractListModel(parent), m_player(nullptr)
+{
+}
+
+void InventoryModel::setPlayer(Player *player)
+{
+    beginResetModel();
+    m_player = player;
+    m_items = currentInventory();
+    updateFingerprints(false);
+    endResetModel();
+}
+
+size_t InventoryModel::fingerprint(const Item *item)
+{
+    return qHashMulti(0, item->name, item->description, item->itemType, item->rarity,
+                      item->attackBonus, item->defenseBonus, item->power);
+}
+
+void InventoryModel::updateFingerprints(bool emitChanges)
+{
+    QHash<const Item*, size_t> fingerprints;
+    fingerprints.reserve(m_items.size());
+
+    // Rows new since the last update are not reported; their insert covered them
+    int firstChanged = -1;
+    for (int row = 0; row <= m_items.size(); ++row) {
+        bool changed = false;
+        if (row < m_items.size()) {
+            const Item *item = m_items[row];
+            size_t print = fingerprint(item);
+            auto previous = m_fingerprints.constFind(item);
+            changed = previous != m_fingerprints.constEnd() && previous.value() != print;
+            fingerprints.insert(item, print);
+        }
+        if (changed && firstChanged < 0) {
+            firstChanged = row;
+        } else if (!changed && firstChanged >= 0) {
+            if (emitChanges) {
+                emit dataChanged(index(firstChanged), index(row - 1));
+            }
+            firstChanged = -1;
+        }
+    }
+    m_fingerprints = fingerprints;
+}
+
+QList<Item*> InventoryModel::currentInventory() const
+{
+    QList<Item*> items;
+    if (!m_player) return items;
+
+    items.reserve(m_player->inventory.size());
+    for (Item *item : m_player->inventory) {
+        if (item) items.append(item);
+    }
+    return items;
+}
+
+void InventoryModel::sync()
+{
+    PYRPG_PROFILE_SCOPE("InventoryModel::sync");
+    const QList<Item*> target = currentInventory();
+
+    const QSet<Item*> targetSet(target.cbegin(), target.cend());
+    const QSet<Item*> currentSet(m_items.cbegin(), m_items.cend());
+
+    // Remove rows that left the inventory, one contiguous run at a time (back to front)
+    int row = m_items.size() - 1;
+    while (row >= 0) {
+        if (targetSet.contains(m_items[row])) {
+            --row;
+            continue;
+        }
+        int last = row;
+        while (row > 0 && !targetSet.contains(m_items[row - 1])) {
+            --row;
+        }
+        beginRemoveRows(QModelIndex(), row, last);
+        m_items.remove(row, last - row + 1);
+        endRemoveRows();
+        --row;
+    }
+
+    // Insert new items where they appear in the inventory
+    row = 0;
+    while (row < target.size()) {
+        if (currentSet.contains(target[row])) {
+            ++row;
+            continue;
+        }
+        int first = row;
+        while (row < target.size() && !currentSet.contains(target[row])) {
+            ++row;
+        }
+        if (first > m_items.size()) break;  // Order diverged; reset below
+        beginInsertRows(QModelIndex(), first, row - 1);
+        for (int i = first; i < row; ++i) {
+            m_items.insert(i, target[i]);
+        }
+        endInsertRows();
+    }
+
+    // Surviving items were reordered: nothing row-level describes that cheaply
+    if (m_items != target) {
+        beginResetModel();
+        m_items = target;
+        updateFingerprints(false);
+        endResetModel();
+        return;
+    }
+
+    // Items edited in place (e.g. an upgrade) keep their row
+    updateFingerprints(true);
+}
+
+Item *InventoryModel::itemAt(int row) const
+{
+    return (row >= 0 && row < m_items.size()) ? m_items[row] : nullptr;
+}
+
+int InventoryModel::rowOf(const Item *item) const
+{
+    return m_items.indexOf(const_cast<Item*>(item));
+}
+
+int InventoryModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_items.size();
+}
+
+QString InventoryModel::statsText(const Item *item)
+{
+    QString statsText;
+    if (item->attackBonus > 0) statsText += QString("+%1 ATK ").arg(item->attackBonus);
+    if (item->defenseBonus > 0) statsText += QString("+%1 DEF ").arg(item->defenseBonus);
+    if (item->power > 0 && item->itemType == "consumable") statsText += QString("Restores %1").arg(item->power);
+    return statsText.trimmed();
+}
+
+QVariant InventoryModel::data(const QModelIndex &index, int role) const
+{
+    Item *item = itemAt(index.row());
+    if (!index.isValid() || !item) return QVariant();
+
+    switch (role) {
+        case Qt::DisplayRole:
+            return item->name;
+        case Qt::ToolTipRole:
+            return item->description;
+        case ItemRole:
+            return QVariant::fromValue(static_cast<void*>(item));
+        case ItemTypeRole:
+            return item->itemType;
+        case StatsTextRole:
+            return statsText(item);
+        case ActionTextRole:
+            return item->itemType == "consumable" ? QStringLiteral("Use") : QStringLiteral("Equip");
+        case RarityRole:
+            return item->rarity;
+        default:
+            return QVariant();
+    }
+}
+
+QHash<int, QByteArray> InventoryModel::roleNames() const
+{
+    QHash<int, QByteArray> roles = QAbstractListModel::roleNames();
+    roles.insert(ItemRole, "item");
+    roles.insert(ItemTypeRole, "itemType");
+    roles.insert(StatsTextRole, "statsText");
+    roles.insert(ActionTextRole, "actionText");
+    roles.insert(RarityRole, "rarity");
+    return roles;
+}
@@ -0,0 +1,61 @@
+#ifndef INVENTORYMODEL_H
+#define INVENTORYMODEL_H
+
+#include <QAbstractListModel>
+#include <QHash>
+#include <QList>
+
+class Player;
+class Item;
+
+// List model over a player's inventory for QListView.
+//
+// The model keeps its own row snapshot of Player::inventory. After the player's
+// inventory changes, sync() diffs the snapshot against it and emits row-level
+// remove/insert signals (falling back to a reset only if items were reordered),
+// and dataChanged for items whose shown fields changed, so views repaint just
+// the affected cards. Rows are matched by Item pointer, which is only meaningful
+// for one Player: call setPlayer whenever the player is replaced, even if the new
+// one happens to have the same address.
+class InventoryModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    enum Roles {
+        ItemRole = Qt::UserRole + 1,  // Item*
+        ItemTypeRole,
+        StatsTextRole,
+        ActionTextRole,
+        RarityRole
+    };
+
+    explicit InventoryModel(QObject *parent = nullptr);
+
+    // Always resets the model
+    void setPlayer(Player *player);
+    Player *player() const { return m_player; }
+
+    // Re-reads the player's inventory, emitting minimal row changes
+    void sync();
+
+    Item *itemAt(int row) const;
+    int rowOf(const Item *item) const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    static QString statsText(const Item *item);
+
+private:
+    Player *m_player;
+    QList<Item*> m_items;
+    QHash<const Item*, size_t> m_fingerprints;  // Of the shown fields, per row item
+
+    QList<Item*> currentInventory() const;
+    static size_t fingerprint(const Item *item);
+    void updateFingerprints(bool emitChanges);
+};
+
+#endif // INVENTORYMODEL_H
@@ -1,5 +1,7 @@
 #include "ItemCard.h"
+#include "SpriteCache.h"
 #include "../theme/Theme.h"
+#include "../theme/StyleSheet.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QLabel>
@@ -10,11 +12,7 @@
 #include <QMimeData>
 #include <QDrag>
 #include <QGridLayout>
-
-// Helper function to get color name from QColor for stylesheet
-QString colorName(const QColor &color) {
-    return color.name(QColor::HexRgb);
-}
+#include <QHash>
 
 ItemCard::ItemCard(Item *item, const QString &actionText, bool showPrice, QWidget *parent)
     : QFrame(parent),
@@ -33,41 +31,10 @@ void ItemCard::setupUi()
     setMinimumSize(180, 200);
     setMaximumSize(200, 220);
 
-    // Styling based on rarity using Theme constants
-    QMap<QString, QColor> rarityStyles;
-    rarityStyles["common_color"] = Theme::MUTED_FOREGROUND;
-    rarityStyles["common_border"] = Theme::BORDER;
-    rarityStyles["uncommon_color"] = Theme::ACCENT;
-    rarityStyles["uncommon_border"] = Theme::ACCENT;
-    rarityStyles["rare_color"] = Theme::PRIMARY;
-    rarityStyles["rare_border"] = Theme::PRIMARY;
-    rarityStyles["epic_color"] = Theme::SECONDARY;
-    rarityStyles["epic_border"] = Theme::SECONDARY;
-    rarityStyles["legendary_color"] = Theme::MUTED; // Using MUTED for gold-like color
-    rarityStyles["legendary_border"] = Theme::MUTED;
-
+    // Rarity selects the border and text colors in the application stylesheet
+    static const QStringList knownRarities = {"common", "uncommon", "rare", "epic", "legendary"};
     QString rarity = m_item->rarity.toLower();
-    QColor borderColor = rarityStyles.value(rarity + "_border", rarityStyles["common_border"]);
-    QColor textColor = rarityStyles.value(rarity + "_color", rarityStyles["common_color"]);
-
-    setStyleSheet(QString(R"(
-        ItemCard {
-            background-color: %1;
-            border: %2px solid %3;
-            border-radius: %4px;
-            padding: %5px;
-        }
-        ItemCard:hover {
-            background-color: %6;
-            border-color: %7;
-        }
-    )").arg(colorName(Theme::CARD))
-      .arg(Theme::BORDER_WIDTH_MEDIUM)
-      .arg(colorName(borderColor))
-      .arg(Theme::BORDER_RADIUS_MD)
-      .arg(Theme::SPACING_SM)
-      .arg(colorName(Theme::MUTED))
-      .arg(colorName(textColor)));
+    setProperty("rarity", knownRarities.contains(rarity) ? rarity : QString("common"));
 
     QVBoxLayout *layout = new QVBoxLayout(this);
     layout->setSpacing(Theme::SPACING_XS);
@@ -79,48 +46,21 @@ void ItemCard::setupUi()
 
     // Item name
     QLabel *nameLabel = new QLabel(m_item->name);
-    nameLabel->setStyleSheet(QString(R"(
-        font-size: %1px;
-        font-weight: %2;
-        color: %3;
-        background: transparent;
-        border: none;
-    )").arg(Theme::FONT_SIZE_MD - 1) // 13px
-      .arg(Theme::FONT_WEIGHT_BOLD)
-      .arg(colorName(textColor)));
+    Theme::setRole(nameLabel, "itemCardName");
     nameLabel->setAlignment(Qt::AlignCenter);
     nameLabel->setWordWrap(true);
     layout->addWidget(nameLabel);
 
     // Item stats/description
     QLabel *statsLabel = new QLabel(getStatsText());
-    statsLabel->setStyleSheet(QString(R"(
-        font-size: %1px;
-        color: %2;
-        background: transparent;
-        border: none;
-    )").arg(Theme::FONT_SIZE_XS + 1) // 11px
-      .arg(colorName(Theme::MUTED_FOREGROUND)));
+    Theme::setRole(statsLabel, "itemCardStats");
     statsLabel->setAlignment(Qt::AlignCenter);
     statsLabel->setWordWrap(true);
     layout->addWidget(statsLabel);
 
     // Rarity badge
     QLabel *rarityLabel = new QLabel(m_item->rarity.toUpper());
-    rarityLabel->setStyleSheet(QString(R"(
-        font-size: %1px;
-        color: %2;
-        background-color: rgba(0, 0, 0, 0.4);
-        padding: %3px %4px;
-        border-radius: %5px;
-        border: none;
-        font-weight: %6;
-    )").arg(Theme::FONT_SIZE_XS) // 10px
-      .arg(colorName(textColor))
-      .arg(Theme::SPACING_XS)
-      .arg(Theme::SPACING_SM)
-      .arg(Theme::BORDER_RADIUS_SM)
-      .arg(Theme::FONT_WEIGHT_MEDIUM));
+    Theme::setRole(rarityLabel, "itemCardRarity");
     rarityLabel->setAlignment(Qt::AlignCenter);
     layout->addWidget(rarityLabel);
 
@@ -129,55 +69,14 @@ void ItemCard::setupUi()
     // Price/Value
     if (m_showPrice) {
         QLabel *priceLabel = new QLabel(QString("💰 %1 gold").arg(m_item->value));
-        priceLabel->setStyleSheet(QString(R"(
-            font-size: %1px;
-            font-weight: %2;
-            color: %3;
-            background: transparent;
-            border: none;
-        )").arg(Theme::FONT_SIZE_SM)
-          .arg(Theme::FONT_WEIGHT_SEMIBOLD)
-          .arg(colorName(Theme::ACCENT)));
+        Theme::setRole(priceLabel, "itemCardPrice");
         priceLabel->setAlignment(Qt::AlignCenter);
         layout->addWidget(priceLabel);
     }
 
     // Action button
     m_actionBtn = new QPushButton(m_actionText);
-    m_actionBtn->setStyleSheet(QString(R"(
-        QPushButton {
-            background-color: %1;
-            color: %2;
-            border: 1px solid %2;
-            border-radius: %3px;
-            padding: %4px %5px;
-            font-size: %6px;
-            font-weight: %7;
-        }
-        QPushButton:hover {
-            background-color: %8;
-            color: %9;
-        }
-        QPushButton:pressed {
-            background-color: %10;
-        }
-        QPushButton:disabled {
-            background-color: %10;
-            color: %11;
-            border-color: %12;
-        }
-    )").arg(colorName(Theme::CARD))
-      .arg(colorName(Theme::PRIMARY))
-      .arg(Theme::BORDER_RADIUS_SM)
-      .arg(Theme::SPACING_XS)
-      .arg(Theme::SPACING_SM)
-      .arg(Theme::FONT_SIZE_XS + 1) // 11px
-      .arg(Theme::FONT_WEIGHT_MEDIUM)
-      .arg(colorName(Theme::SECONDARY))
-      .arg(colorName(Theme::SECONDARY_FOREGROUND))
-      .arg(colorName(Theme::MUTED))
-      .arg(colorName(Theme::MUTED_FOREGROUND))
-      .arg(colorName(Theme::BORDER)));
+    Theme::setRole(m_actionBtn, "itemCardAction");
 
     connect(m_actionBtn, &QPushButton::clicked, this, [this]() {
         emit actionClicked(m_item, m_actionText.toLower());
@@ -209,7 +108,6 @@ QLabel *ItemCard::getItemIconLabel() const
     if (m_item->itemType == "weapon") {
         pixmap = getWeaponPixmap(m_item->name);
         if (!pixmap.isNull()) {
-            pixmap = pixmap.scaled(32, 32, Qt::KeepAspectRatio, Qt::SmoothTransformation);
             label->setPixmap(pixmap);
             return label;
         }
@@ -225,32 +123,25 @@ QLabel *ItemCard::getItemIconLabel() const
     }
 
     label->setText(iconText);
-    label->setStyleSheet("font-size: 32px; background: transparent; border: none;");
+    Theme::setRole(label, "itemCardIcon");
     return label;
 }
 
 QPixmap ItemCard::getWeaponPixmap(const QString &weaponName) const
 {
-    // Map weapon names to icon files (using Qt Resource paths, assuming task 5.3 is done later)
-    QMap<QString, QString> weaponIcons = {
+    // Map weapon names to icon files (Qt Resource paths)
+    static const QHash<QString, QString> weaponIcons = {
         {"Iron Sword", ":/assets/iron_sword.png"},
         {"Steel Sword", ":/assets/steel_sword.png"},
         {"Magic Sword", ":/assets/magic_sword.png"}
     };
 
     QString path = weaponIcons.value(weaponName);
-    if (!path.isEmpty()) {
-        QPixmap pixmap(path);
-        if (pixmap.isNull()) {
-            // Fallback for development before resource file is set up
-            // The path to the assets directory from the executable is complex.
-            // For now, we will rely on the resource system path (:/assets/...) 
-            // and assume the user will complete task 5.3 (Asset Management) soon.
-            // If the pixmap is null, it will fall back to the emoji icon.
-        }
-        return pixmap;
+    if (path.isEmpty()) {
+        return QPixmap(); // Null pixmap: caller falls back to the emoji icon
     }
-    return QPixmap(); // Return null pixmap
+    // Shared, pre-scaled icon; null if the asset is missing
+    return SpriteCache::instance().pixmap(path, QSize(WEAPON_ICON_SIZE, WEAPON_ICON_SIZE), devicePixelRatioF());
 }
 
 QString ItemCard::getStatsText() const
@@ -8,6 +8,7 @@
 #include <QDropEvent>
 #include <QMap>
 #include "../../src/models/Item.h"
+#include "../diagnostics/AllocationTracker.h"
 
 class QPushButton;
 class QLabel;
@@ -21,6 +22,7 @@ signals:
     void actionClicked(Item *item, const QString &action);
 
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.cards")
     explicit ItemCard(Item *item, const QString &actionText = "Select", bool showPrice = false, QWidget *parent = nullptr);
 
 private:
@@ -30,6 +32,7 @@ private:
     QString getTooltipText() const;
     QString getEffectDescription() const;
     QLabel *getItemIconLabel() const;
+    // Weapon icon scaled to WEAPON_ICON_SIZE; null if the weapon has no icon
     QPixmap getWeaponPixmap(const QString &weaponName) const;
 
 protected:
@@ -38,6 +41,8 @@ protected:
     void dropEvent(QDropEvent *event) override;
 
 private:
+    static const int WEAPON_ICON_SIZE = 32;
+
     Item *m_item;
     QString m_actionText;
     bool m_showPrice;
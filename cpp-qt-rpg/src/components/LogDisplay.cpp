@@ -1,11 +1,16 @@
 #include "LogDisplay.h"
 #include "../theme/Theme.h"
-#include <QLabel>
-#include <QVBoxLayout>
-#include <QScrollArea>
-#include <QSizePolicy>
+#include <QPainter>
+#include <QPaintEvent>
+#include <QResizeEvent>
 #include <QScrollBar>
-#include <QDebug>
+#include <QTextDocument>
+#include <QtMath>
+#include <algorithm>
+
+namespace {
+const int BORDER_STRIPE_WIDTH = 3;
+}
 
 // --- LogEntry Implementation ---
 
@@ -21,168 +26,164 @@ QColor LogEntry::getBorderColor() const
     if (messageType == "warning") return QColor("#ffc107");
     if (messageType == "error") return Theme::DESTRUCTIVE;
     if (messageType == "combat") return Theme::PRIMARY;
+    if (messageType == "quest" || messageType == "lore") return Theme::ACCENT;
     return Theme::MUTED_FOREGROUND;
 }
 
 // --- LogDisplay Implementation ---
 
-LogDisplay::~LogDisplay()
+LogDisplay::LogDisplay(int maxEntries, QWidget *parent)
+    : QAbstractScrollArea(parent),
+      m_entries(std::max(1, maxEntries)),
+      m_writeIndex(0),
+      m_count(0),
+      m_contentHeight(0),
+      m_layoutWidth(0)
 {
-    qDeleteAll(m_logEntries);
-    m_logEntries.clear();
+    setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+    setMinimumHeight(150);
+    setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+    verticalScrollBar()->setSingleStep(Theme::SPACING_LG);
+
+    QFont entryFont = font();
+    entryFont.setPixelSize(Theme::FONT_SIZE_MD);
+    setFont(entryFont);
+
+    // Border and scroll bar come from the LogDisplay rules in the application stylesheet
 }
 
-LogDisplay::LogDisplay(int maxEntries, QWidget *parent)
-    : QWidget(parent),
-      m_maxEntries(maxEntries)
+void LogDisplay::addEntry(const QString &message, const QString &messageType)
 {
-    initUi();
+    bool atBottom = verticalScrollBar()->value() >= verticalScrollBar()->maximum();
+
+    // Overwrite the oldest slot once the ring is full
+    LogEntry &slot = m_entries[int(m_writeIndex % quint64(m_entries.size()))];
+    if (m_count == m_entries.size()) {
+        m_contentHeight -= slot.height + Theme::SPACING_XS;
+    } else {
+        ++m_count;
+    }
+    ++m_writeIndex;
+
+    slot = LogEntry(message, messageType);
+    layoutEntry(slot);
+    m_contentHeight += slot.height + Theme::SPACING_XS;
+
+    updateScrollRange(atBottom);
+    viewport()->update();
 }
 
-void LogDisplay::initUi()
+void LogDisplay::clearEntries()
 {
-    QVBoxLayout *layout = new QVBoxLayout(this);
-    layout->setContentsMargins(0, 0, 0, 0);
-    layout->setSpacing(0);
-
-    // Scroll area for log entries
-    m_scrollArea = new QScrollArea();
-    m_scrollArea->setWidgetResizable(true);
-    m_scrollArea->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-    m_scrollArea->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
-    m_scrollArea->setMinimumHeight(150);
-    m_scrollArea->setMaximumHeight(400);
-    m_scrollArea->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
-
-    // Container for log entries
-    m_entriesContainer = new QWidget();
-    m_entriesLayout = new QVBoxLayout(m_entriesContainer);
-    m_entriesLayout->setContentsMargins(Theme::SPACING_SM, Theme::SPACING_SM, Theme::SPACING_SM, Theme::SPACING_SM);
-    m_entriesLayout->setSpacing(Theme::SPACING_SM);
-    m_entriesLayout->setAlignment(Qt::AlignTop);
-    m_entriesLayout->addStretch(); // Push entries to top
-
-    m_scrollArea->setWidget(m_entriesContainer);
-    layout->addWidget(m_scrollArea);
-
-    // Apply theme-consistent styling
-    m_scrollArea->setStyleSheet(QString(R"(
-        QScrollArea {
-            border: %1px solid %2;
-            border-radius: %3px;
-            background-color: %4;
-        }
-        QScrollBar:vertical {
-            width: %5px;
-            background: %4;
-        }
-        QScrollBar::handle:vertical {
-            background: %2;
-            border-radius: 5px;
-        }
-        QScrollBar::handle:vertical:hover {
-            background: %6;
-        }
-    )").arg(Theme::BORDER_WIDTH_MEDIUM)
-      .arg(Theme::BORDER.name())
-      .arg(Theme::BORDER_RADIUS_MD)
-      .arg(Theme::CARD.name())
-      .arg(Theme::SCROLLBAR_WIDTH)
-      .arg(Theme::MUTED_FOREGROUND.name()));
+    for (LogEntry &entry : m_entries) {
+        entry = LogEntry();
+    }
+    m_writeIndex = 0;
+    m_count = 0;
+    m_contentHeight = 0;
+    updateScrollRange(true);
+    viewport()->update();
 }
 
-void LogDisplay::addEntry(const QString &message, const QString &messageType)
+int LogDisplay::getEntryCount() const
 {
-    // Create entry and add to collection
-    LogEntry *entry = new LogEntry(message, messageType);
-    m_logEntries.append(entry);
-
-    // Maintain max entries limit
-    if (m_logEntries.size() > m_maxEntries) {
-        // Remove oldest entry
-        LogEntry *oldEntry = m_logEntries.takeFirst();
-        if (oldEntry->_widget) {
-            oldEntry->_widget->setParent(nullptr);
-            oldEntry->_widget->deleteLater();
-        }
-        delete oldEntry;
+    return m_count;
+}
+
+QStringList LogDisplay::messages() const
+{
+    QStringList result;
+    result.reserve(m_count);
+    for (int i = 0; i < m_count; ++i) {
+        result.append(m_entries[slotOf(i)].message);
     }
+    return result;
+}
 
-    // Create and add visual widget for this entry
-    addEntryWidget(entry);
+int LogDisplay::slotOf(int index) const
+{
+    quint64 oldest = m_writeIndex - quint64(m_count);
+    return int((oldest + quint64(index)) % quint64(m_entries.size()));
+}
 
-    // Scroll to bottom to show newest entries
-    scrollToBottom();
+int LogDisplay::textWidth() const
+{
+    return std::max(1, viewport()->width() - 2 * Theme::SPACING_SM - BORDER_STRIPE_WIDTH - Theme::SPACING_SM);
 }
 
-void LogDisplay::addEntryWidget(LogEntry *entry)
+void LogDisplay::layoutEntry(LogEntry &entry) const
 {
-    // Create label for this entry
-    QLabel *entryLabel = new QLabel();
-    entryLabel->setTextFormat(Qt::RichText);
-    entryLabel->setWordWrap(true);
-    entryLabel->setAlignment(Qt::AlignTop | Qt::AlignLeft);
-
-    // Format the entry with CSS styling
-    QString borderColor = entry->getBorderColor().name();
-    QString formattedText = QString(R"(
-        <div style='
-            border-left: 3px solid %1;
-            padding-left: 8px;
-            margin: 4px 0;
-            color: %2;
-            font-size: %3px;
-            line-height: 1.5;
-            background-color: transparent;
-        '>
-            %4
-        </div>
-    )").arg(borderColor)
-      .arg(Theme::FOREGROUND.name())
-      .arg(Theme::FONT_SIZE_MD)
-      .arg(entry->message);
-
-    entryLabel->setText(formattedText);
-
-    // Store reference to widget for cleanup
-    entry->_widget = entryLabel;
-
-    // Add to layout (insert before the stretch, which is the last item)
-    m_entriesLayout->insertWidget(m_entriesLayout->count() - 1, entryLabel);
+    // Plain text keeps its line breaks; rich text is laid out as before
+    if (Qt::mightBeRichText(entry.message)) {
+        entry.text.setTextFormat(Qt::RichText);
+        entry.text.setText(entry.message);
+    } else {
+        QString text = entry.message;
+        text.replace(QLatin1Char('\n'), QChar::LineSeparator);
+        entry.text.setTextFormat(Qt::PlainText);
+        entry.text.setText(text);
+    }
+    entry.text.setTextWidth(textWidth());
+    entry.text.prepare(QTransform(), font());
+    entry.height = std::max(fontMetrics().height(), qCeil(entry.text.size().height()));
 }
 
-void LogDisplay::scrollToBottom()
+void LogDisplay::updateScrollRange(bool stickToBottom)
 {
-    QScrollBar *scrollbar = m_scrollArea->verticalScrollBar();
-    scrollbar->setValue(scrollbar->maximum());
+    QScrollBar *scrollbar = verticalScrollBar();
+    int visibleHeight = viewport()->height() - 2 * Theme::SPACING_SM;
+    scrollbar->setPageStep(std::max(1, visibleHeight));
+    scrollbar->setRange(0, std::max(0, m_contentHeight - visibleHeight));
+    if (stickToBottom) {
+        scrollbar->setValue(scrollbar->maximum());
+    }
 }
 
-void LogDisplay::clearEntries()
+void LogDisplay::paintEvent(QPaintEvent *event)
 {
-    // Remove all entry widgets and delete LogEntry objects
-    // Iterate backwards to safely remove items from the layout
-    for (int i = m_entriesLayout->count() - 1; i >= 0; --i) {
-        QLayoutItem *item = m_entriesLayout->itemAt(i);
-        if (item->widget()) {
-            item->widget()->setParent(nullptr);
-            item->widget()->deleteLater();
-        }
-        // Do not delete the stretch item
-        if (!item->spacerItem()) {
-            m_entriesLayout->removeItem(item);
+    QPainter painter(viewport());
+    painter.setClipRect(event->rect());
+    painter.setPen(Theme::FOREGROUND);
+
+    int top = event->rect().top();
+    int bottom = event->rect().bottom();
+    int textX = Theme::SPACING_SM + BORDER_STRIPE_WIDTH + Theme::SPACING_SM;
+    int y = Theme::SPACING_SM - verticalScrollBar()->value();
+
+    // Heights are cached, so skipping entries above the viewport is just additions
+    for (int i = 0; i < m_count && y <= bottom; ++i) {
+        const LogEntry &entry = m_entries[slotOf(i)];
+        if (y + entry.height >= top) {
+            painter.fillRect(Theme::SPACING_SM, y, BORDER_STRIPE_WIDTH, entry.height, entry.getBorderColor());
+            painter.drawStaticText(textX, y, entry.text);
         }
+        y += entry.height + Theme::SPACING_XS;
     }
+}
 
-    qDeleteAll(m_logEntries);
-    m_logEntries.clear();
-
-    // Ensure the stretch item is the last item
-    if (m_entriesLayout->count() == 0) {
-        m_entriesLayout->addStretch();
+void LogDisplay::resizeEvent(QResizeEvent *event)
+{
+    QAbstractScrollArea::resizeEvent(event);
+
+    bool atBottom = verticalScrollBar()->value() >= verticalScrollBar()->maximum();
+
+    // Wrapping depends on width, so only a width change invalidates the cached layouts
+    if (textWidth() != m_layoutWidth) {
+        m_layoutWidth = textWidth();
+        m_contentHeight = 0;
+        for (int i = 0; i < m_count; ++i) {
+            LogEntry &entry = m_entries[slotOf(i)];
+            layoutEntry(entry);
+            m_contentHeight += entry.height + Theme::SPACING_XS;
+        }
     }
+    updateScrollRange(atBottom);
 }
 
-int LogDisplay::getEntryCount() const
+void LogDisplay::scrollContentsBy(int dx, int dy)
 {
-    return m_logEntries.size();
+    Q_UNUSED(dx);
+    Q_UNUSED(dy);
+    viewport()->update();
 }
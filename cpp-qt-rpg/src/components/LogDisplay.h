@@ -1,52 +1,61 @@
 #ifndef LOGDISPLAY_H
 #define LOGDISPLAY_H
 
-#include <QWidget>
-#include <QList>
+#include <QAbstractScrollArea>
+#include <QVector>
+#include <QStringList>
+#include <QStaticText>
 #include <QColor>
+#include "../diagnostics/AllocationTracker.h"
 
-class QLabel;
-class QVBoxLayout;
-class QScrollArea;
-
-// Helper class for a single log entry
+// A single log entry; the text layout is cached for the display's current width
 class LogEntry
 {
 public:
+    LogEntry() = default;
     LogEntry(const QString &message, const QString &messageType = "info");
-    ~LogEntry() { /* _widget is deleted by LogDisplay */ }
 
     QString message;
-    QString messageType; // "info", "success", "warning", "error", "combat"
+    QString messageType; // "info", "success", "warning", "error", "combat", "quest", "lore"
     QColor getBorderColor() const;
 
-    // Used to hold the visual widget reference for cleanup
-    QLabel *_widget = nullptr;
+    QStaticText text;
+    int height = 0;
 };
 
-class LogDisplay : public QWidget
+// Scrolling log painted directly onto the viewport. Entries live in a fixed-capacity
+// ring, so appends never touch older entries and memory stays bounded.
+class LogDisplay : public QAbstractScrollArea
 {
     Q_OBJECT
 
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.components")
     explicit LogDisplay(int maxEntries = 20, QWidget *parent = nullptr);
-    ~LogDisplay();
 
     void addEntry(const QString &message, const QString &messageType = "info");
     void clearEntries();
     int getEntryCount() const;
+    int capacity() const { return m_entries.size(); }
+    // Oldest first
+    QStringList messages() const;
 
-private:
-    void initUi();
-    void addEntryWidget(LogEntry *entry);
-    void scrollToBottom();
-
-    QList<LogEntry*> m_logEntries;
-    int m_maxEntries;
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void scrollContentsBy(int dx, int dy) override;
 
-    QScrollArea *m_scrollArea;
-    QWidget *m_entriesContainer;
-    QVBoxLayout *m_entriesLayout;
+private:
+    int slotOf(int index) const;  // Ring slot of the index-th retained entry, oldest first
+    void layoutEntry(LogEntry &entry) const;
+    int textWidth() const;
+    void updateScrollRange(bool stickToBottom);
+
+    QVector<LogEntry> m_entries;
+    quint64 m_writeIndex;
+    int m_count;
+    int m_contentHeight;
+    int m_layoutWidth;
 };
 
 #endif // LOGDISPLAY_H
@@ -1,14 +1,18 @@
 #include "MenuOverlay.h"
+#include "AnimationSpeed.h"
+#include "../diagnostics/Profiler.h"
 #include "../views/InventoryPage.h"
 #include "../views/StatsPage.h"
 #include "../views/ShopPage.h"
 #include "../views/SaveLoadPage.h"
 #include "../models/Player.h"
 #include "../theme/Theme.h"
+#include "../theme/StyleSheet.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QTabWidget>
 #include <QPushButton>
+#include <QComboBox>
 #include <QPropertyAnimation>
 #include <QPainter>
 #include <QKeyEvent>
@@ -19,6 +23,10 @@
 
 MenuOverlay::MenuOverlay(QWidget *parent)
     : QWidget(parent)
+    , m_inventoryPage(nullptr)
+    , m_statsPage(nullptr)
+    , m_shopPage(nullptr)
+    , m_saveLoadPage(nullptr)
     , m_opacity(0.0)
     , m_currentPlayer(nullptr)
     , m_previousFocusWidget(nullptr)
@@ -31,19 +39,12 @@ MenuOverlay::MenuOverlay(QWidget *parent)
     setupUi();
 
     m_animation = new QPropertyAnimation(this, "opacity");
-    m_animation->setDuration(200);
 
     // Set up permanent connection for animation finished signal
     connect(m_animation, &QPropertyAnimation::finished, this, [this]() {
         // Only hide and emit signal if we were animating to 0 (hiding)
         if (m_animation->endValue().toReal() == 0.0) {
-            hide();
-            // Restore focus to previous widget
-            if (m_previousFocusWidget) {
-                m_previousFocusWidget->setFocus();
-                m_previousFocusWidget = nullptr;
-            }
-            emit overlayHidden();
+            finishHide();
         }
     });
 
@@ -57,17 +58,8 @@ void MenuOverlay::setupUi()
 
     // Content widget (the actual menu dialog)
     m_contentWidget = new QWidget();
+    // Styled by object name in the application stylesheet, as are the buttons below
     m_contentWidget->setObjectName("menuOverlayContent");
-    m_contentWidget->setStyleSheet(QString(
-        "QWidget#menuOverlayContent { "
-        "background-color: %1; "
-        "border: %2px solid %3; "
-        "border-radius: %4px; "
-        "}"
-    ).arg(Theme::CARD.name())
-     .arg(Theme::BORDER_WIDTH_MEDIUM)
-     .arg(Theme::ACCENT.name())
-     .arg(Theme::BORDER_RADIUS_XL));
 
     QVBoxLayout *contentLayout = new QVBoxLayout(m_contentWidget);
     contentLayout->setContentsMargins(Theme::SPACING_LG, Theme::SPACING_LG, Theme::SPACING_LG, Theme::SPACING_LG);
@@ -81,27 +73,11 @@ void MenuOverlay::setupUi()
     titleFont.setPointSize(Theme::FONT_SIZE_XL);
     titleFont.setWeight(static_cast<QFont::Weight>(Theme::FONT_WEIGHT_SEMIBOLD));
     titleLabel->setFont(titleFont);
-    titleLabel->setStyleSheet(QString("color: %1;").arg(Theme::ACCENT.name()));
+    Theme::setRole(titleLabel, "overlayTitle");
 
     m_closeButton = new QPushButton("✕");
     m_closeButton->setObjectName("closeButton");
     m_closeButton->setFixedSize(32, 32);
-    m_closeButton->setStyleSheet(QString(
-        "QPushButton#closeButton { "
-        "background-color: %1; "
-        "color: %2; "
-        "border: 1px solid %3; "
-        "border-radius: 16px; "
-        "font-size: 16px; "
-        "font-weight: bold; "
-        "} "
-        "QPushButton#closeButton:hover { "
-        "background-color: %4; "
-        "}"
-    ).arg(Theme::MUTED.name())
-     .arg(Theme::FOREGROUND.name())
-     .arg(Theme::BORDER.name())
-     .arg(Theme::DESTRUCTIVE.name()));
     connect(m_closeButton, &QPushButton::clicked, this, &MenuOverlay::hideOverlay);
 
     headerLayout->addWidget(titleLabel);
@@ -112,69 +88,20 @@ void MenuOverlay::setupUi()
     // Tab widget
     m_tabWidget = new QTabWidget();
     m_tabWidget->setMinimumSize(600, 400);
-    m_tabWidget->setStyleSheet(QString(
-        "QTabWidget::pane { "
-        "border: 1px solid %1; "
-        "border-radius: %2px; "
-        "background-color: %3; "
-        "} "
-        "QTabBar::tab { "
-        "background-color: %4; "
-        "color: %5; "
-        "padding: 10px 20px; "
-        "margin-right: 2px; "
-        "border: 1px solid %6; "
-        "border-bottom: none; "
-        "border-top-left-radius: 4px; "
-        "border-top-right-radius: 4px; "
-        "} "
-        "QTabBar::tab:selected { "
-        "background-color: %7; "
-        "color: %8; "
-        "border-color: %9; "
-        "} "
-        "QTabBar::tab:hover { "
-        "background-color: %10; "
-        "}"
-    ).arg(Theme::BORDER.name())
-     .arg(Theme::BORDER_RADIUS_MD)
-     .arg(Theme::CARD.name())
-     .arg(Theme::SECONDARY.name())
-     .arg(Theme::MUTED_FOREGROUND.name())
-     .arg(Theme::BORDER.name())
-     .arg(Theme::ACCENT.name())
-     .arg(Theme::ACCENT_FOREGROUND.name())
-     .arg(Theme::ACCENT.name())
-     .arg(Theme::MUTED.name()));
-
-    // Create the pages
-    m_inventoryPage = new InventoryPage();
-    m_statsPage = new StatsPage();
-    m_shopPage = new ShopPage();
-    m_saveLoadPage = new SaveLoadPage();
-
-    // Connect back signals to close the overlay
-    connect(m_inventoryPage, &InventoryPage::backRequested, this, &MenuOverlay::hideOverlay);
-    connect(m_statsPage, &StatsPage::backRequested, this, &MenuOverlay::hideOverlay);
-    connect(m_shopPage, &ShopPage::leaveRequested, this, &MenuOverlay::hideOverlay);
-    connect(m_saveLoadPage, &SaveLoadPage::backRequested, this, &MenuOverlay::hideOverlay);
-
-    // Connect item change signals to refresh content
-    connect(m_inventoryPage, &InventoryPage::itemEquipped, this, &MenuOverlay::handleItemChanged);
-    connect(m_shopPage, &ShopPage::itemPurchased, this, &MenuOverlay::handleItemChanged);
-
-    // Connect SaveLoadPage signals
-    connect(m_saveLoadPage, &SaveLoadPage::quickSaveRequested, this, &MenuOverlay::saveRequested);
-    connect(m_saveLoadPage, &SaveLoadPage::quickLoadRequested, this, &MenuOverlay::loadRequested);
-    connect(m_saveLoadPage, &SaveLoadPage::saveToSlotRequested, this, &MenuOverlay::saveToSlotRequested);
-    connect(m_saveLoadPage, &SaveLoadPage::loadFromSlotRequested, this, &MenuOverlay::loadFromSlotRequested);
-    connect(m_saveLoadPage, &SaveLoadPage::deleteSlotRequested, this, &MenuOverlay::deleteSlotRequested);
-
-    // Add tabs
-    m_tabWidget->addTab(m_inventoryPage, "🎒 Inventory");
-    m_tabWidget->addTab(m_statsPage, "📊 Stats");
-    m_tabWidget->addTab(m_shopPage, "🏪 Shop");
-    m_tabWidget->addTab(m_saveLoadPage, "💾 Save/Load");
+    m_tabWidget->setObjectName("menuOverlayTabs");
+
+    // Tabs start as empty hosts; each page is built the first time its tab is shown
+    for (const char *label : {"🎒 Inventory", "📊 Stats", "🏪 Shop", "💾 Save/Load"}) {
+        QWidget *host = new QWidget();
+        QVBoxLayout *hostLayout = new QVBoxLayout(host);
+        hostLayout->setContentsMargins(0, 0, 0, 0);
+        m_tabWidget->addTab(host, QString::fromUtf8(label));
+    }
+    connect(m_tabWidget, &QTabWidget::currentChanged, this, [this](int index) {
+        if (isVisible()) {
+            ensureTabPage(index);
+        }
+    });
 
     contentLayout->addWidget(m_tabWidget);
 
@@ -185,85 +112,49 @@ void MenuOverlay::setupUi()
     m_saveButton = new QPushButton("💾 Save Game");
     m_saveButton->setObjectName("saveButton");
     m_saveButton->setMinimumHeight(40);
-    m_saveButton->setStyleSheet(QString(
-        "QPushButton#saveButton { "
-        "background-color: %1; "
-        "color: %2; "
-        "border: 1px solid %3; "
-        "border-radius: %4px; "
-        "padding: 8px 16px; "
-        "font-size: %5px; "
-        "font-weight: %6; "
-        "} "
-        "QPushButton#saveButton:hover { "
-        "background-color: %7; "
-        "}"
-    ).arg(Theme::ACCENT.name())
-     .arg(Theme::ACCENT_FOREGROUND.name())
-     .arg(Theme::ACCENT.name())
-     .arg(Theme::BORDER_RADIUS_MD)
-     .arg(Theme::FONT_SIZE_MD)
-     .arg(Theme::FONT_WEIGHT_MEDIUM)
-     .arg(Theme::ACCENT.lighter(110).name()));
     connect(m_saveButton, &QPushButton::clicked, this, &MenuOverlay::handleSaveClicked);
 
     m_loadButton = new QPushButton("📂 Load Game");
     m_loadButton->setObjectName("loadButton");
     m_loadButton->setMinimumHeight(40);
-    m_loadButton->setStyleSheet(QString(
-        "QPushButton#loadButton { "
-        "background-color: %1; "
-        "color: %2; "
-        "border: 1px solid %3; "
-        "border-radius: %4px; "
-        "padding: 8px 16px; "
-        "font-size: %5px; "
-        "font-weight: %6; "
-        "} "
-        "QPushButton#loadButton:hover { "
-        "background-color: %7; "
-        "}"
-    ).arg(Theme::SECONDARY.name())
-     .arg(Theme::FOREGROUND.name())
-     .arg(Theme::BORDER.name())
-     .arg(Theme::BORDER_RADIUS_MD)
-     .arg(Theme::FONT_SIZE_MD)
-     .arg(Theme::FONT_WEIGHT_MEDIUM)
-     .arg(Theme::MUTED.name()));
     connect(m_loadButton, &QPushButton::clicked, this, &MenuOverlay::handleLoadClicked);
 
     saveLoadLayout->addWidget(m_saveButton);
     saveLoadLayout->addWidget(m_loadButton);
     contentLayout->addLayout(saveLoadLayout);
+
+    // Animation speed setting
+    QHBoxLayout *speedLayout = new QHBoxLayout();
+    speedLayout->setSpacing(Theme::SPACING_MD);
+    QLabel *speedLabel = new QLabel("🎞️ Animation Speed");
+    m_speedSelector = new QComboBox();
+    m_speedSelector->setObjectName("animationSpeedSelector");
+    for (AnimationSpeed::Speed speed : {AnimationSpeed::Normal, AnimationSpeed::Double,
+                                        AnimationSpeed::Quadruple, AnimationSpeed::Instant}) {
+        m_speedSelector->addItem(AnimationSpeed::label(speed), speed);
+    }
+    m_speedSelector->setCurrentIndex(m_speedSelector->findData(AnimationSpeed::instance().speed()));
+    connect(m_speedSelector, QOverload<int>::of(&QComboBox::activated), this, [this](int index) {
+        AnimationSpeed::instance().saveSpeed(static_cast<AnimationSpeed::Speed>(m_speedSelector->itemData(index).toInt()));
+    });
+    connect(&AnimationSpeed::instance(), &AnimationSpeed::speedChanged, this, [this](AnimationSpeed::Speed speed) {
+        m_speedSelector->setCurrentIndex(m_speedSelector->findData(speed));
+    });
+    speedLayout->addWidget(speedLabel);
+    speedLayout->addStretch();
+    speedLayout->addWidget(m_speedSelector);
+    contentLayout->addLayout(speedLayout);
+
     // Add quit button
     QPushButton *quitButton = new QPushButton("🚪 Quit Game");
     quitButton->setObjectName("quitButton");
     quitButton->setMinimumHeight(40);
-    quitButton->setStyleSheet(QString(
-        "QPushButton#quitButton { "
-        "background-color: %1; "
-        "color: %2; "
-        "border: 1px solid %3; "
-        "border-radius: 8px; "
-        "font-size: 14px; "
-        "font-weight: bold; "
-        "padding: 10px; "
-        "} "
-        "QPushButton#quitButton:hover { "
-        "background-color: %4; "
-        "}"
-    ).arg(Theme::DESTRUCTIVE.name())
-     .arg(Theme::DESTRUCTIVE_FOREGROUND.name())
-     .arg(Theme::DESTRUCTIVE.darker(110).name())
-     .arg(Theme::DESTRUCTIVE.lighter(110).name()));
     connect(quitButton, &QPushButton::clicked, this, &MenuOverlay::handleQuitClicked);
     contentLayout->addWidget(quitButton);
 
     // Add hint text
     QLabel *hintLabel = new QLabel("Press ESC to close");
-    hintLabel->setStyleSheet(QString("color: %1; font-size: %2px;")
-                                .arg(Theme::MUTED_FOREGROUND.name())
-                                .arg(Theme::FONT_SIZE_SM));
+    Theme::setRole(hintLabel, "hint");
     hintLabel->setAlignment(Qt::AlignCenter);
     contentLayout->addWidget(hintLabel);
 
@@ -278,6 +169,13 @@ void MenuOverlay::showOverlay()
     // Store the currently focused widget so we can restore it later
     m_previousFocusWidget = QApplication::focusWidget();
 
+    ensureTabPage(m_tabWidget->currentIndex());
+
+    // Snapshot the page while this overlay is still hidden, so the grab leaves it out
+    if (!isVisible()) {
+        captureBackdrop();
+    }
+
     show();
     raise();
     setFocus();
@@ -296,13 +194,94 @@ void MenuOverlay::hideOverlay()
 }
 
 void MenuOverlay::updateContent(Player *player)
+{
+    PYRPG_PROFILE_SCOPE("MenuOverlay::updateContent");
+    m_currentPlayer = player;
+    if (!player) {
+        return;
+    }
+    // Tabs that were never opened are filled in when they are built
+    for (int index = 0; index < m_tabWidget->count(); ++index) {
+        refreshTabPage(index);
+    }
+}
+
+void MenuOverlay::setPlayer(Player *player)
 {
     m_currentPlayer = player;
-    if (player) {
-        m_inventoryPage->updateInventory(player);
-        m_statsPage->updateStats(player);
-        m_shopPage->updateShop(player);
-        m_saveLoadPage->refreshSaveSlots();
+    if (m_inventoryPage) {
+        m_inventoryPage->setPlayer(player);
+    }
+}
+
+void MenuOverlay::ensureTabPage(int index)
+{
+    if (index < 0 || index >= m_tabWidget->count()) {
+        return;
+    }
+
+    QWidget *page = nullptr;
+    switch (index) {
+        case InventoryTab:
+            if (m_inventoryPage) return;
+            m_inventoryPage = new InventoryPage();
+            connect(m_inventoryPage, &InventoryPage::backRequested, this, &MenuOverlay::hideOverlay);
+            connect(m_inventoryPage, &InventoryPage::itemEquipped, this, &MenuOverlay::handleItemChanged);
+            page = m_inventoryPage;
+            break;
+        case StatsTab:
+            if (m_statsPage) return;
+            m_statsPage = new StatsPage();
+            connect(m_statsPage, &StatsPage::backRequested, this, &MenuOverlay::hideOverlay);
+            page = m_statsPage;
+            break;
+        case ShopTab:
+            if (m_shopPage) return;
+            m_shopPage = new ShopPage();
+            connect(m_shopPage, &ShopPage::leaveRequested, this, &MenuOverlay::hideOverlay);
+            connect(m_shopPage, &ShopPage::itemPurchased, this, &MenuOverlay::handleItemChanged);
+            page = m_shopPage;
+            break;
+        case SaveLoadTab:
+            if (m_saveLoadPage) return;
+            m_saveLoadPage = new SaveLoadPage();
+            connect(m_saveLoadPage, &SaveLoadPage::backRequested, this, &MenuOverlay::hideOverlay);
+            connect(m_saveLoadPage, &SaveLoadPage::quickSaveRequested, this, &MenuOverlay::saveRequested);
+            connect(m_saveLoadPage, &SaveLoadPage::quickLoadRequested, this, &MenuOverlay::loadRequested);
+            connect(m_saveLoadPage, &SaveLoadPage::saveToSlotRequested, this, &MenuOverlay::saveToSlotRequested);
+            connect(m_saveLoadPage, &SaveLoadPage::loadFromSlotRequested, this, &MenuOverlay::loadFromSlotRequested);
+            connect(m_saveLoadPage, &SaveLoadPage::deleteSlotRequested, this, &MenuOverlay::deleteSlotRequested);
+            page = m_saveLoadPage;
+            break;
+        default:
+            return;
+    }
+
+    PYRPG_PROFILE_SCOPE("MenuOverlay::ensureTabPage");
+    m_tabWidget->widget(index)->layout()->addWidget(page);
+    refreshTabPage(index);
+}
+
+void MenuOverlay::refreshTabPage(int index)
+{
+    if (!m_currentPlayer) {
+        return;
+    }
+    switch (index) {
+        case InventoryTab:
+            if (m_inventoryPage) m_inventoryPage->updateInventory(m_currentPlayer);
+            break;
+        case StatsTab:
+            if (m_statsPage) m_statsPage->updateStats(m_currentPlayer);
+            break;
+        case ShopTab:
+            if (m_shopPage) m_shopPage->updateShop(m_currentPlayer);
+            break;
+        case SaveLoadTab:
+            if (m_saveLoadPage) m_saveLoadPage->refreshSaveSlots();
+            break;
+        default:
+            break;
     }
 }
 
@@ -312,6 +291,61 @@ void MenuOverlay::setOpacity(qreal opacity)
     update();
 }
 
+void MenuOverlay::captureBackdrop()
+{
+    releaseBackdrop();
+    QWidget *host = parentWidget();
+    if (!host) {
+        return;
+    }
+
+    PYRPG_PROFILE_SCOPE("MenuOverlay::captureBackdrop");
+    m_backdrop = host->grab(geometry());
+    if (m_backdrop.isNull()) {
+        return;
+    }
+
+    // The overlay now covers them with an opaque snapshot; nothing under it needs to repaint
+    setAttribute(Qt::WA_OpaquePaintEvent, true);
+    for (QObject *child : host->children()) {
+        QWidget *widget = qobject_cast<QWidget *>(child);
+        if (widget && widget != this && !widget->isWindow() && widget->isVisible() && widget->updatesEnabled()) {
+            widget->setUpdatesEnabled(false);
+            m_pausedWidgets.append(widget);
+        }
+    }
+}
+
+void MenuOverlay::releaseBackdrop()
+{
+    for (const QPointer<QWidget> &widget : std::as_const(m_pausedWidgets)) {
+        if (widget) {
+            widget->setUpdatesEnabled(true);
+        }
+    }
+    m_pausedWidgets.clear();
+    m_backdrop = QPixmap();
+    setAttribute(Qt::WA_OpaquePaintEvent, false);
+}
+
+void MenuOverlay::hideEvent(QHideEvent *event)
+{
+    // A minimised window hides its children too; keep the snapshot for when it comes back
+    if (!event->spontaneous()) {
+        releaseBackdrop();
+    }
+    QWidget::hideEvent(event);
+}
+
+void MenuOverlay::resizeEvent(QResizeEvent *event)
+{
+    // The snapshot no longer matches the window; show the live page instead
+    if (!m_backdrop.isNull() && m_backdrop.deviceIndependentSize() != QSizeF(size())) {
+        releaseBackdrop();
+    }
+    QWidget::resizeEvent(event);
+}
+
 void MenuOverlay::paintEvent(QPaintEvent *event)
 {
     Q_UNUSED(event);
@@ -319,6 +353,10 @@ void MenuOverlay::paintEvent(QPaintEvent *event)
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing);
 
+    if (!m_backdrop.isNull()) {
+        painter.drawPixmap(0, 0, m_backdrop);
+    }
+
     // Draw semi-transparent background
     QColor overlayColor = QColor(0, 0, 0);
     overlayColor.setAlphaF(0.7 * m_opacity);
@@ -351,6 +389,11 @@ void MenuOverlay::mousePressEvent(QMouseEvent *event)
 void MenuOverlay::animateShow()
 {
     m_animation->stop();
+    if (AnimationSpeed::instance().isInstant()) {
+        setOpacity(1.0);
+        return;
+    }
+    m_animation->setDuration(AnimationSpeed::instance().scaled(FADE_MS));
     m_animation->setStartValue(0.0);
     m_animation->setEndValue(1.0);
     m_animation->start();
@@ -359,12 +402,29 @@ void MenuOverlay::animateShow()
 void MenuOverlay::animateHide()
 {
     m_animation->stop();
+    if (AnimationSpeed::instance().isInstant()) {
+        setOpacity(0.0);
+        finishHide();
+        return;
+    }
+    m_animation->setDuration(AnimationSpeed::instance().scaled(FADE_MS));
     m_animation->setStartValue(m_opacity);
     m_animation->setEndValue(0.0);
     m_animation->start();
     // Note: The finished signal is handled by the permanent connection in the constructor
 }
 
+void MenuOverlay::finishHide()
+{
+    hide();
+    // Restore focus to previous widget
+    if (m_previousFocusWidget) {
+        m_previousFocusWidget->setFocus();
+        m_previousFocusWidget = nullptr;
+    }
+    emit overlayHidden();
+}
+
 void MenuOverlay::handleItemChanged()
 {
     // Refresh all tabs when inventory or shop changes
@@ -2,9 +2,13 @@
 #define MENUOVERLAY_H
 
 #include <QWidget>
+#include <QPixmap>
+#include <QPointer>
+#include <QList>
 
 class QTabWidget;
 class QPushButton;
+class QComboBox;
 class QPropertyAnimation;
 class InventoryPage;
 class StatsPage;
@@ -12,6 +16,13 @@ class ShopPage;
 class SaveLoadPage;
 class Player;
 
+// In-game menu shown over the window, fading in and out over a darkened backdrop.
+//
+// When it opens, the overlay snapshots the window underneath into a pixmap and
+// paints that static backdrop during the fade and while open, instead of being a
+// translucent layer over live widgets. The widgets underneath stop repainting
+// until it closes. Without a parent, or after the window is resized while open,
+// it falls back to a translucent overlay over the live page.
 class MenuOverlay : public QWidget
 {
     Q_OBJECT
@@ -23,6 +34,8 @@ public:
     void showOverlay();
     void hideOverlay();
     void updateContent(Player *player);
+    // The game replaced its player; views holding the old one start over
+    void setPlayer(Player *player);
 
     qreal opacity() const { return m_opacity; }
     void setOpacity(qreal opacity);
@@ -44,19 +57,31 @@ private slots:
 
 protected:
     void paintEvent(QPaintEvent *event) override;
+    void hideEvent(QHideEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
     void keyPressEvent(QKeyEvent *event) override;
     void mousePressEvent(QMouseEvent *event) override;
 
 private:
+    enum Tab { InventoryTab = 0, StatsTab, ShopTab, SaveLoadTab };
+
     void setupUi();
+    void ensureTabPage(int index);   // Builds the tab's page on first show
+    void refreshTabPage(int index);  // Updates an already-built page for the current player
     void animateShow();
     void animateHide();
+    void finishHide();  // Hides, restores focus and emits overlayHidden()
+    void captureBackdrop();
+    void releaseBackdrop();  // Also resumes repaints underneath
+
+    static const int FADE_MS = 200;
 
     QWidget *m_contentWidget;
     QTabWidget *m_tabWidget;
     QPushButton *m_closeButton;
     QPushButton *m_saveButton;
     QPushButton *m_loadButton;
+    QComboBox *m_speedSelector;
     QPropertyAnimation *m_animation;
 
     InventoryPage *m_inventoryPage;
@@ -65,6 +90,8 @@ private:
     SaveLoadPage *m_saveLoadPage;
 
     qreal m_opacity;
+    QPixmap m_backdrop;
+    QList<QPointer<QWidget>> m_pausedWidgets;
     Player *m_currentPlayer;
     QWidget *m_previousFocusWidget;
 };
@@ -0,0 +1,227 @@
+#include "ParticleField.h"
+#include "../diagnostics/Profiler.h"
+#include <QDebug>
+#include <QFont>
+#include <QPainter>
+#include <cmath>
+#include <random>
+
+// Shared generator for particle spawning; not synchronised, so GUI thread only
+namespace {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    int randomInt(int min, int max) {
+        std::uniform_int_distribution<> dis(min, max);
+        return dis(gen);
+    }
+
+    // Position eases out (fast burst, slow settle); opacity falls off quadratically
+    inline float easeOutExpo(float t) {
+        return t >= 1.0f ? 1.0f : 1.0f - std::pow(2.0f, -10.0f * t);
+    }
+
+    inline float easeInQuad(float t) {
+        return t * t;
+    }
+
+    QString glyphText(const QString &particleType) {
+        if (particleType == "star") return "⭐";
+        if (particleType == "spark") return "✨";
+        if (particleType == "coin") return "💰";
+        if (particleType == "heart") return "💚";
+        return "•";
+    }
+}
+
+int ParticleField::glyphFor(const QString &particleType, const QString &color, const QFont &font, qreal devicePixelRatio)
+{
+    const QString key = QString("%1|%2|%3").arg(particleType, color).arg(devicePixelRatio);
+    auto it = m_atlasIndex.constFind(key);
+    if (it != m_atlasIndex.constEnd()) {
+        return it.value();
+    }
+
+    // Render the glyph once; particles only blit this pixmap from now on
+    const int size = ParticleConstants::PARTICLE_SIZE;
+    QPixmap pixmap(QSize(size, size) * devicePixelRatio);
+    pixmap.setDevicePixelRatio(devicePixelRatio);
+    pixmap.fill(Qt::transparent);
+
+    QPainter painter(&pixmap);
+    QFont glyphFont = font;
+    glyphFont.setPixelSize(12);
+    glyphFont.setBold(true);
+    painter.setFont(glyphFont);
+    painter.setPen(QColor(color));
+    painter.drawText(QRect(0, 0, size, size), Qt::AlignCenter, glyphText(particleType));
+    painter.end();
+
+    int index = m_atlas.size();
+    m_atlas.append(pixmap);
+    m_atlasIndex.insert(key, index);
+    return index;
+}
+
+int ParticleField::spawnBurst(const QPointF &centerPos, int particleCount, const QString &particleType,
+                              const QString &color, const QFont &font, qreal devicePixelRatio)
+{
+    // Input validation
+    if (particleCount <= 0) {
+        qWarning() << "ParticleField::spawnBurst: particleCount must be positive, got" << particleCount;
+        return 0;
+    }
+
+    if (particleCount > ParticleConstants::MAX_PARTICLES_PER_BURST) {
+        qWarning() << "ParticleField::spawnBurst: particleCount" << particleCount
+                   << "exceeds maximum" << ParticleConstants::MAX_PARTICLES_PER_BURST
+                   << ", clamping to maximum";
+        particleCount = ParticleConstants::MAX_PARTICLES_PER_BURST;
+    }
+
+    int available = ParticleConstants::MAX_ACTIVE_PARTICLES - count();
+    int spawnCount = qMin(particleCount, available);
+    PYRPG_PROFILE_COUNT("particles.spawned", spawnCount);
+    if (spawnCount <= 0) {
+        return 0;
+    }
+
+    reservePool();
+    const int glyph = glyphFor(particleType, color, font, devicePixelRatio);
+    const float startX = centerPos.x() - ParticleConstants::PARTICLE_HALF_SIZE;
+    const float startY = centerPos.y() - ParticleConstants::PARTICLE_HALF_SIZE;
+
+    for (int i = 0; i < spawnCount; ++i) {
+        // Calculate position in circle (angle spacing uses the requested count)
+        double angle = (static_cast<double>(i) / particleCount) * 2 * M_PI;
+        int radius = randomInt(ParticleConstants::MIN_RADIUS, ParticleConstants::MAX_RADIUS);
+        float endX = centerPos.x() + static_cast<int>(std::cos(angle) * radius)
+                   + randomInt(-ParticleConstants::POSITION_VARIANCE, ParticleConstants::POSITION_VARIANCE);
+        float endY = centerPos.y() + static_cast<int>(std::sin(angle) * radius)
+                   + randomInt(-ParticleConstants::POSITION_VARIANCE, ParticleConstants::POSITION_VARIANCE);
+
+        m_startX.append(startX);
+        m_startY.append(startY);
+        m_deltaX.append(endX - startX);
+        m_deltaY.append(endY - startY);
+        m_ageMs.append(0.0f);
+        m_durationMs.append(randomInt(ParticleConstants::MIN_DURATION_MS, ParticleConstants::MAX_DURATION_MS));
+        m_x.append(startX);
+        m_y.append(startY);
+        m_opacity.append(1.0f);
+        m_glyph.append(glyph);
+    }
+    return spawnCount;
+}
+
+void ParticleField::reservePool()
+{
+    // Once, on the first burst; clear() keeps the capacity
+    const int capacity = ParticleConstants::MAX_ACTIVE_PARTICLES;
+    if (m_startX.capacity() >= capacity) {
+        return;
+    }
+    m_startX.reserve(capacity);
+    m_startY.reserve(capacity);
+    m_deltaX.reserve(capacity);
+    m_deltaY.reserve(capacity);
+    m_ageMs.reserve(capacity);
+    m_durationMs.reserve(capacity);
+    m_x.reserve(capacity);
+    m_y.reserve(capacity);
+    m_opacity.reserve(capacity);
+    m_glyph.reserve(capacity);
+}
+
+void ParticleField::removeParticle(int index)
+{
+    // Swap-remove keeps the arrays dense without shifting
+    int last = m_startX.size() - 1;
+    if (index != last) {
+        m_startX[index] = m_startX[last];
+        m_startY[index] = m_startY[last];
+        m_deltaX[index] = m_deltaX[last];
+        m_deltaY[index] = m_deltaY[last];
+        m_ageMs[index] = m_ageMs[last];
+        m_durationMs[index] = m_durationMs[last];
+        m_x[index] = m_x[last];
+        m_y[index] = m_y[last];
+        m_opacity[index] = m_opacity[last];
+        m_glyph[index] = m_glyph[last];
+    }
+    m_startX.removeLast();
+    m_startY.removeLast();
+    m_deltaX.removeLast();
+    m_deltaY.removeLast();
+    m_ageMs.removeLast();
+    m_durationMs.removeLast();
+    m_x.removeLast();
+    m_y.removeLast();
+    m_opacity.removeLast();
+    m_glyph.removeLast();
+}
+
+void ParticleField::advance(float elapsedMs)
+{
+    float minX = 0, minY = 0, maxX = 0, maxY = 0;
+    int i = 0;
+    while (i < m_startX.size()) {
+        float age = m_ageMs[i] + elapsedMs;
+        float duration = m_durationMs[i];
+        float fadeDuration = duration * static_cast<float>(ParticleConstants::FADE_DURATION_RATIO);
+
+        // A particle disappears once its fade completes
+        if (age >= fadeDuration) {
+            removeParticle(i);
+            continue;
+        }
+
+        float progress = easeOutExpo(age / duration);
+        m_ageMs[i] = age;
+        m_x[i] = m_startX[i] + m_deltaX[i] * progress;
+        m_y[i] = m_startY[i] + m_deltaY[i] * progress;
+        m_opacity[i] = 1.0f - easeInQuad(age / fadeDuration);
+
+        if (i == 0) {
+            minX = maxX = m_x[i];
+            minY = maxY = m_y[i];
+        } else {
+            minX = qMin(minX, m_x[i]);
+            minY = qMin(minY, m_y[i]);
+            maxX = qMax(maxX, m_x[i]);
+            maxY = qMax(maxY, m_y[i]);
+        }
+        ++i;
+    }
+
+    m_bounds = QRect();
+    if (!m_startX.isEmpty()) {
+        m_bounds = QRect(QPoint(int(minX), int(minY)), QPoint(int(maxX), int(maxY)))
+                       .adjusted(-1, -1, ParticleConstants::PARTICLE_SIZE + 1, ParticleConstants::PARTICLE_SIZE + 1);
+    }
+}
+
+void ParticleField::paint(QPainter &painter) const
+{
+    const qreal baseOpacity = painter.opacity();
+    for (int i = 0; i < m_startX.size(); ++i) {
+        painter.setOpacity(baseOpacity * m_opacity[i]);
+        painter.drawPixmap(QPointF(m_x[i], m_y[i]), m_atlas[m_glyph[i]]);
+    }
+    painter.setOpacity(baseOpacity);
+}
+
+void ParticleField::clear()
+{
+    m_startX.clear();
+    m_startY.clear();
+    m_deltaX.clear();
+    m_deltaY.clear();
+    m_ageMs.clear();
+    m_durationMs.clear();
+    m_x.clear();
+    m_y.clear();
+    m_opacity.clear();
+    m_glyph.clear();
+    m_bounds = QRect();
+}
@@ -0,0 +1,83 @@
+#ifndef PARTICLEFIELD_H
+#define PARTICLEFIELD_H
+
+#include <QPointF>
+#include <QRect>
+#include <QVector>
+#include <QHash>
+#include <QPixmap>
+#include <QString>
+
+class QFont;
+class QPainter;
+
+// Particle animation constants
+namespace ParticleConstants {
+    constexpr int ATTACK_IMPACT_DELAY_MS = 300;
+    constexpr int COMBAT_RESULT_DELAY_MS = 200;
+    constexpr int LEVEL_UP_DELAY_MS = 500;
+    constexpr int PARTICLE_SIZE = 16;
+    constexpr int MIN_DURATION_MS = 800;
+    constexpr int MAX_DURATION_MS = 1200;
+    constexpr int MIN_RADIUS = 30;
+    constexpr int MAX_RADIUS = 80;
+    constexpr int POSITION_VARIANCE = 10;
+    constexpr int PARTICLE_HALF_SIZE = PARTICLE_SIZE / 2;
+    constexpr double FADE_DURATION_RATIO = 0.7;
+    constexpr int VICTORY_SECOND_BURST_DELAY_MS = 200;
+    constexpr int TEXT_FLOAT_DISTANCE = 30;
+    constexpr int TEXT_ANIMATION_DURATION_MS = 2000;
+    constexpr int TEXT_VERTICAL_OFFSET = 50;
+    constexpr int MAX_PARTICLES_PER_BURST = 1000;
+    constexpr int MAX_ACTIVE_PARTICLES = 4096;
+    constexpr int FRAME_INTERVAL_MS = 16;
+}
+
+// --- ParticleField Class ---
+// The particle simulation without a widget: whoever owns it advances it from
+// their frame clock and paints it with their own painter. Particles live in a
+// struct-of-arrays pool (dead slots are swap-removed, so capacity is reused and
+// steady-state bursts allocate nothing) and are drawn from a per-(glyph, colour)
+// pixmap atlas rendered once.
+class ParticleField
+{
+public:
+    // Spawns up to particleCount particles flying out from centerPos; returns how
+    // many were spawned (fewer once the pool is full)
+    int spawnBurst(const QPointF &centerPos, int particleCount, const QString &particleType,
+                   const QString &color, const QFont &font, qreal devicePixelRatio);
+    // Ages and moves every particle, dropping those whose fade has completed
+    void advance(float elapsedMs);
+    void paint(QPainter &painter) const;
+    void clear();
+
+    int count() const { return m_startX.size(); }
+    bool isEmpty() const { return m_startX.isEmpty(); }
+    // Area the live particles cover after the last advance(); empty when none are alive
+    QRect bounds() const { return m_bounds; }
+
+private:
+    int glyphFor(const QString &particleType, const QString &color, const QFont &font, qreal devicePixelRatio);
+    void reservePool();
+    void removeParticle(int index);
+
+    // Particle pool (one entry per live particle in each array)
+    QVector<float> m_startX;
+    QVector<float> m_startY;
+    QVector<float> m_deltaX;
+    QVector<float> m_deltaY;
+    QVector<float> m_ageMs;
+    QVector<float> m_durationMs;
+    QVector<float> m_x;
+    QVector<float> m_y;
+    QVector<float> m_opacity;
+    QVector<int> m_glyph;
+
+    // Glyph atlas: one pre-rendered pixmap per (particle type, colour)
+    QVector<QPixmap> m_atlas;
+    QHash<QString, int> m_atlasIndex;
+
+    QRect m_bounds;
+};
+
+#endif // PARTICLEFIELD_H
@@ -1,92 +1,14 @@
 #include "ParticleSystem.h"
-#include <QEasingCurve>
-#include <QDebug>
-#include <cmath>
-#include <random>
-#include <QFontMetrics>
-#include <QGraphicsOpacityEffect>
-
-// Thread-safe random number generator
-namespace {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-
-    int randomInt(int min, int max) {
-        std::uniform_int_distribution<> dis(min, max);
-        return dis(gen);
-    }
-}
-
-// --- Particle Implementation ---
-
-Particle::Particle(QWidget *parent, const QString &particleType, const QString &color)
-    : QLabel(parent),
-      m_opacityEffect(new QGraphicsOpacityEffect(this))
-{
-    // The parent is passed from ParticleSystem::createBurst
-    setParent(parent);
-    setAttribute(Qt::WA_TranslucentBackground);
-    setFixedSize(ParticleConstants::PARTICLE_SIZE, ParticleConstants::PARTICLE_SIZE);
-    setGraphicsEffect(m_opacityEffect); // Apply the opacity effect
-
-    QString text;
-    if (particleType == "star") text = "⭐";
-    else if (particleType == "spark") text = "✨";
-    else if (particleType == "coin") text = "💰";
-    else if (particleType == "heart") text = "💚";
-    else text = "•";
-
-    setText(text);
-    setStyleSheet(QString("color: %1; font-size: 12px; font-weight: bold;").arg(color));
-    show();
-}
-
-Particle::~Particle()
-{
-    // Animations are managed by Qt's parent-child ownership and will be
-    // deleted automatically. We don't need to manually delete them here.
-    // Just clear the list to avoid dangling pointers.
-    m_animations.clear();
-}
-
-void Particle::animate(const QPoint &startPos, const QPoint &endPos, int duration)
-{
-    move(startPos);
-
-    // Position animation (no parent set - managed by m_animations list)
-    QPropertyAnimation *anim = new QPropertyAnimation(this, "pos");
-    anim->setStartValue(startPos);
-
-    // Add some randomness to end position
-    QPoint variance(randomInt(-ParticleConstants::POSITION_VARIANCE, ParticleConstants::POSITION_VARIANCE),
-                    randomInt(-ParticleConstants::POSITION_VARIANCE, ParticleConstants::POSITION_VARIANCE));
-    anim->setEndValue(endPos + variance);
-
-    anim->setDuration(duration);
-    anim->setEasingCurve(QEasingCurve::OutExpo);
-
-    // Fade out animation (no parent set - managed by m_animations list)
-    QPropertyAnimation *fadeAnim = new QPropertyAnimation(m_opacityEffect, "opacity");
-    fadeAnim->setStartValue(1.0);
-    fadeAnim->setEndValue(0.0);
-    fadeAnim->setDuration(static_cast<int>(duration * ParticleConstants::FADE_DURATION_RATIO));
-    fadeAnim->setEasingCurve(QEasingCurve::InQuad);
-
-    // Connect to delete the particle when fade is finished
-    connect(fadeAnim, &QPropertyAnimation::finished, this, &Particle::deleteLater);
-
-    anim->start();
-    fadeAnim->start();
-
-    m_animations.append(anim);
-    m_animations.append(fadeAnim);
-}
+#include "AnimationSpeed.h"
+#include "../diagnostics/Profiler.h"
+#include <QPainter>
+#include <QPaintEvent>
 
 // --- ParticleSystem Implementation ---
 
 ParticleSystem::ParticleSystem(QWidget *parent)
     : QWidget(parent),
-      m_activeParticleCount(0),
+      m_frameTimer(new QTimer(this)),
       m_emitSignalWhenComplete(false)
 {
     // The particle system should be transparent and cover the area where effects happen
@@ -94,56 +16,51 @@ ParticleSystem::ParticleSystem(QWidget *parent)
     // Allow mouse events to pass through to underlying widgets (like buttons)
     setAttribute(Qt::WA_TransparentForMouseEvents);
     // We rely on the parent to set the geometry.
+
+    m_frameTimer->setTimerType(Qt::PreciseTimer);
+    m_frameTimer->setInterval(ParticleConstants::FRAME_INTERVAL_MS);
+    connect(m_frameTimer, &QTimer::timeout, this, &ParticleSystem::advance);
 }
 
 void ParticleSystem::createBurst(const QPoint &centerPos, int particleCount, const QString &particleType, const QString &color, bool emitSignal)
 {
-    // Input validation
-    if (particleCount <= 0) {
-        qWarning() << "ParticleSystem::createBurst: particleCount must be positive, got" << particleCount;
-        return;
-    }
-
-    if (particleCount > ParticleConstants::MAX_PARTICLES_PER_BURST) {
-        qWarning() << "ParticleSystem::createBurst: particleCount" << particleCount
-                   << "exceeds maximum" << ParticleConstants::MAX_PARTICLES_PER_BURST
-                   << ", clamping to maximum";
-        particleCount = ParticleConstants::MAX_PARTICLES_PER_BURST;
-    }
-
+    PYRPG_PROFILE_SCOPE("ParticleSystem::createBurst");
     if (emitSignal) {
         m_emitSignalWhenComplete = true;
     }
 
-    for (int i = 0; i < particleCount; ++i) {
-        Particle *particle = new Particle(this, particleType, color);
-
-        // Track when particles are destroyed
-        connect(particle, &QObject::destroyed, this, &ParticleSystem::onParticleDestroyed);
-        m_activeParticleCount++;
-
-        // Calculate position in circle
-        double angle = (static_cast<double>(i) / particleCount) * 2 * M_PI;
-        int radius = randomInt(ParticleConstants::MIN_RADIUS, ParticleConstants::MAX_RADIUS);
-        int endX = centerPos.x() + static_cast<int>(std::cos(angle) * radius);
-        int endY = centerPos.y() + static_cast<int>(std::sin(angle) * radius);
+    // Particles are cosmetic; at instant speed the burst completes without any
+    if (!AnimationSpeed::instance().isInstant()) {
+        m_field.spawnBurst(centerPos, particleCount, particleType, color, font(), devicePixelRatioF());
+    }
 
-        QPoint startPos = centerPos - QPoint(ParticleConstants::PARTICLE_HALF_SIZE, ParticleConstants::PARTICLE_HALF_SIZE);
-        QPoint endPos(endX, endY);
+    if (activeParticleCount() == 0) {
+        // Pool is full, nothing spawned or instant speed; still honour the completion contract
+        if (m_emitSignalWhenComplete) {
+            m_emitSignalWhenComplete = false;
+            emit animationFinished();
+        }
+        return;
+    }
 
-        int duration = randomInt(ParticleConstants::MIN_DURATION_MS, ParticleConstants::MAX_DURATION_MS);
-        particle->animate(startPos, endPos, duration);
-        m_particles.append(particle);
+    if (!m_frameTimer->isActive()) {
+        m_frameClock.start();
+        m_frameTimer->start();
     }
 }
 
-void ParticleSystem::onParticleDestroyed()
+void ParticleSystem::advance()
 {
-    m_activeParticleCount--;
+    PYRPG_PROFILE_SCOPE("ParticleSystem::advance");
+    m_field.advance(static_cast<float>(AnimationSpeed::instance().scaledElapsed(m_frameClock.restart())));
 
-    // When all particles are destroyed, clean up and emit signal if needed
-    if (m_activeParticleCount == 0) {
-        m_particles.clear();
+    // Repaint only where particles were last frame and where they are now
+    QRect bounds = m_field.bounds();
+    update(m_dirtyBounds.united(bounds));
+    m_dirtyBounds = bounds;
+
+    if (m_field.isEmpty()) {
+        m_frameTimer->stop();
         if (m_emitSignalWhenComplete) {
             m_emitSignalWhenComplete = false;
             emit animationFinished();
@@ -151,12 +68,21 @@ void ParticleSystem::onParticleDestroyed()
     }
 }
 
+void ParticleSystem::paintEvent(QPaintEvent *event)
+{
+    if (m_field.isEmpty()) return;
+
+    QPainter painter(this);
+    painter.setClipRect(event->rect());
+    m_field.paint(painter);
+}
+
 void ParticleSystem::victoryExplosion(const QPoint &centerPos)
 {
     // First burst doesn't emit signal
     createBurst(centerPos, 8, "star", "#e5c07b", false);
     // Second burst will emit signal when all particles from both bursts are done
-    QTimer::singleShot(ParticleConstants::VICTORY_SECOND_BURST_DELAY_MS, [this, centerPos] {
+    AnimationSpeed::instance().runAfter(ParticleConstants::VICTORY_SECOND_BURST_DELAY_MS, this, [this, centerPos] {
         createBurst(centerPos, 6, "spark", "#98c379", true);
     });
 }
@@ -175,5 +101,3 @@ void ParticleSystem::goldRewardBurst(const QPoint &centerPos)
 {
     createBurst(centerPos, 8, "coin", "#e5c07b");
 }
-
-
@@ -2,52 +2,16 @@
 #define PARTICLESYSTEM_H
 
 #include <QWidget>
-#include <QLabel>
-#include <QPropertyAnimation>
 #include <QPoint>
-#include <QList>
+#include <QRect>
+#include <QElapsedTimer>
 #include <QTimer>
-#include <QObject>
-#include <QGraphicsOpacityEffect> // Added for fading
-
-// Particle animation constants
-namespace ParticleConstants {
-    constexpr int ATTACK_IMPACT_DELAY_MS = 300;
-    constexpr int COMBAT_RESULT_DELAY_MS = 200;
-    constexpr int LEVEL_UP_DELAY_MS = 500;
-    constexpr int PARTICLE_SIZE = 16;
-    constexpr int MIN_DURATION_MS = 800;
-    constexpr int MAX_DURATION_MS = 1200;
-    constexpr int MIN_RADIUS = 30;
-    constexpr int MAX_RADIUS = 80;
-    constexpr int POSITION_VARIANCE = 10;
-    constexpr int PARTICLE_HALF_SIZE = PARTICLE_SIZE / 2;
-    constexpr double FADE_DURATION_RATIO = 0.7;
-    constexpr int VICTORY_SECOND_BURST_DELAY_MS = 200;
-    constexpr int TEXT_FLOAT_DISTANCE = 30;
-    constexpr int TEXT_ANIMATION_DURATION_MS = 2000;
-    constexpr int TEXT_VERTICAL_OFFSET = 50;
-    constexpr int MAX_PARTICLES_PER_BURST = 100;
-}
-
-// --- Particle Class ---
-class Particle : public QLabel
-{
-    Q_OBJECT
-    // Removed Q_PROPERTY for pos and windowOpacity, relying on QWidget::pos and QGraphicsOpacityEffect
-
-public:
-    explicit Particle(QWidget *parent = nullptr, const QString &particleType = "star", const QString &color = "#dc3545");
-    ~Particle() override;
-
-    void animate(const QPoint &startPos, const QPoint &endPos, int duration = 1000);
-
-private:
-    QList<QPropertyAnimation*> m_animations;
-    QGraphicsOpacityEffect *m_opacityEffect; // New member for fading
-};
+#include "ParticleField.h"
 
 // --- ParticleSystem Class ---
+// Transparent overlay that runs a ParticleField on its own frame timer, which
+// only runs while particles are alive. Used where effects sit on top of
+// ordinary widgets (dialogs); the combat arena paints its particles itself.
 class ParticleSystem : public QWidget
 {
     Q_OBJECT
@@ -64,15 +28,20 @@ public:
     void levelUpBurst(const QPoint &centerPos);
     void goldRewardBurst(const QPoint &centerPos);
 
+    int activeParticleCount() const { return m_field.count(); }
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
 private slots:
-    void onParticleDestroyed();
+    void advance();
 
 private:
-    QList<Particle*> m_particles;
-    int m_activeParticleCount;
+    ParticleField m_field;
+    QTimer *m_frameTimer;
+    QElapsedTimer m_frameClock;
+    QRect m_dirtyBounds;
     bool m_emitSignalWhenComplete;
 };
 
-
-
 #endif // PARTICLESYSTEM_H
@@ -0,0 +1,182 @@
+#include "PerformanceOverlay.h"
+#include "theme/Theme.h"
+#include <QFontDatabase>
+#include <QPainter>
+#include <QTimer>
+#include <algorithm>
+
+PerformanceOverlay::PerformanceOverlay(QWidget *parent)
+    : QWidget(parent),
+      m_page(Page::Timings)
+{
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setAttribute(Qt::WA_NoSystemBackground);
+    setFocusPolicy(Qt::NoFocus);
+
+    QFont font = QFontDatabase::systemFont(QFontDatabase::FixedFont);
+    font.setPointSize(Theme::FONT_SIZE_XS);
+    setFont(font);
+
+    m_refreshTimer = new QTimer(this);
+    m_refreshTimer->setInterval(REFRESH_INTERVAL_MS);
+    connect(m_refreshTimer, &QTimer::timeout, this, &PerformanceOverlay::refresh);
+
+    hide();
+}
+
+void PerformanceOverlay::toggle()
+{
+    if (!isVisible()) {
+        m_page = Page::Timings;
+        show();
+        raise();
+    } else if (m_page == Page::Timings) {
+        m_page = Page::Memory;
+        refresh();
+    } else {
+        hide();
+    }
+}
+
+void PerformanceOverlay::updatePosition()
+{
+    if (!parentWidget()) return;
+
+    int width = std::min(460, parentWidget()->width());
+    setGeometry(parentWidget()->width() - width, 0, width, parentWidget()->height());
+}
+
+void PerformanceOverlay::showEvent(QShowEvent *event)
+{
+    QWidget::showEvent(event);
+    updatePosition();
+    refresh();
+    m_refreshTimer->start();
+}
+
+void PerformanceOverlay::hideEvent(QHideEvent *event)
+{
+    QWidget::hideEvent(event);
+    m_refreshTimer->stop();
+}
+
+void PerformanceOverlay::refresh()
+{
+    m_probes = Profiler::instance().probeSnapshots();
+    m_counters = Profiler::instance().counterSnapshots();
+    m_allocations = AllocationTracker::instance().snapshots();
+
+    // Slowest tail first: that is what players feel as hitches
+    std::sort(m_probes.begin(), m_probes.end(), [](const ProbeSnapshot &a, const ProbeSnapshot &b) {
+        return a.p99Ns > b.p99Ns;
+    });
+
+    update();
+}
+
+QString PerformanceOverlay::formatDuration(quint64 ns)
+{
+    if (ns >= 1000000) {
+        return QString::number(ns / 1000000.0, 'f', 1) + "ms";
+    }
+    if (ns >= 1000) {
+        return QString::number(ns / 1000.0, 'f', 1) + "us";
+    }
+    return QString::number(ns) + "ns";
+}
+
+QString PerformanceOverlay::formatBytes(qint64 bytes)
+{
+    if (bytes >= 1024 * 1024) {
+        return QString::number(bytes / (1024.0 * 1024.0), 'f', 1) + "MB";
+    }
+    if (bytes >= 1024) {
+        return QString::number(bytes / 1024.0, 'f', 1) + "KB";
+    }
+    return QString::number(bytes) + "B";
+}
+
+QStringList PerformanceOverlay::timingLines() const
+{
+    QStringList lines;
+    if (!Profiler::isEnabled()) {
+        lines << "Profiling disabled in this build (PYRPG_PROFILING=OFF)";
+        return lines;
+    }
+
+    lines << QString("%1 %2 %3 %4")
+                 .arg(QStringLiteral("probe"), -28)
+                 .arg(QStringLiteral("calls"), 8)
+                 .arg(QStringLiteral("p50"), 9)
+                 .arg(QStringLiteral("p99"), 9);
+    int rows = 0;
+    for (const ProbeSnapshot &probe : m_probes) {
+        if (rows++ >= MAX_ROWS) break;
+        lines << QString("%1 %2 %3 %4")
+                     .arg(probe.name.left(28), -28)
+                     .arg(probe.count, 8)
+                     .arg(formatDuration(probe.p50Ns), 9)
+                     .arg(formatDuration(probe.p99Ns), 9);
+    }
+    if (!m_counters.isEmpty()) {
+        lines << "";
+        lines << "counters";
+        for (const CounterSnapshot &counter : m_counters) {
+            lines << QString("%1 %2").arg(counter.name.left(28), -28).arg(counter.value, 8);
+        }
+    }
+    return lines;
+}
+
+QStringList PerformanceOverlay::memoryLines() const
+{
+    QStringList lines;
+    if (!AllocationTracker::isEnabled()) {
+        lines << "Allocation tracking disabled in this build (PYRPG_ALLOCATION_TRACKING=OFF)";
+        return lines;
+    }
+
+    lines << QString("%1 %2 %3 %4")
+                 .arg(QStringLiteral("tag"), -24)
+                 .arg(QStringLiteral("live"), 8)
+                 .arg(QStringLiteral("bytes"), 9)
+                 .arg(QStringLiteral("allocs"), 10);
+    qint64 totalBytes = 0;
+    for (const AllocationSnapshot &allocation : m_allocations) {
+        totalBytes += allocation.liveBytes;
+        lines << QString("%1 %2 %3 %4")
+                     .arg(allocation.name.left(24), -24)
+                     .arg(allocation.liveCount, 8)
+                     .arg(formatBytes(allocation.liveBytes), 9)
+                     .arg(allocation.totalAllocations, 10);
+    }
+    lines << "";
+    lines << QString("%1 %2").arg(QStringLiteral("total live (shallow)"), -33).arg(formatBytes(totalBytes), 9);
+    return lines;
+}
+
+void PerformanceOverlay::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    QFontMetrics metrics(font());
+    const int lineHeight = metrics.height();
+    const int padding = Theme::SPACING_SM;
+
+    const QStringList lines = m_page == Page::Timings ? timingLines() : memoryLines();
+
+    QRect panel(0, 0, width(), lines.size() * lineHeight + padding * 2);
+    QColor background = Theme::BACKGROUND;
+    background.setAlpha(220);
+    painter.fillRect(panel, background);
+    painter.setPen(Theme::BORDER);
+    painter.drawRect(panel.adjusted(0, 0, -1, -1));
+
+    painter.setPen(Theme::FOREGROUND);
+    int y = padding + metrics.ascent();
+    for (const QString &line : lines) {
+        painter.drawText(padding, y, line);
+        y += lineHeight;
+    }
+}
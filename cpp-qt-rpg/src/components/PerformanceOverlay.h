@@ -0,0 +1,52 @@
+#ifndef PERFORMANCEOVERLAY_H
+#define PERFORMANCEOVERLAY_H
+
+#include <QWidget>
+#include <QList>
+#include "diagnostics/Profiler.h"
+#include "diagnostics/AllocationTracker.h"
+
+class QTimer;
+
+// Debug overlay with two pages: p50/p99 per profiling probe plus counters, and
+// live allocation counts per tag (see AllocationTracker.h). F3 in MainWindow
+// cycles timings -> memory -> hidden; refreshes at a low rate while visible.
+class PerformanceOverlay : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit PerformanceOverlay(QWidget *parent = nullptr);
+
+    enum class Page { Timings, Memory };
+
+    void toggle();
+    Page currentPage() const { return m_page; }
+    void updatePosition();
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+    void hideEvent(QHideEvent *event) override;
+
+private slots:
+    void refresh();
+
+private:
+    static const int REFRESH_INTERVAL_MS = 500;
+    static const int MAX_ROWS = 24;
+
+    QTimer *m_refreshTimer;
+    Page m_page;
+    QList<ProbeSnapshot> m_probes;
+    QList<CounterSnapshot> m_counters;
+    QList<AllocationSnapshot> m_allocations;
+
+    QStringList timingLines() const;
+    QStringList memoryLines() const;
+
+    static QString formatDuration(quint64 ns);
+    static QString formatBytes(qint64 bytes);
+};
+
+#endif // PERFORMANCEOVERLAY_H
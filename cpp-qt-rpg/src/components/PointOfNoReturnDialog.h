@@ -2,6 +2,7 @@
 #define POINTOFNORETURNDIALOG_H
 
 #include <QDialog>
+#include "../diagnostics/AllocationTracker.h"
 
 class QLabel;
 class QPushButton;
@@ -11,6 +12,7 @@ class PointOfNoReturnDialog : public QDialog
     Q_OBJECT
 
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.dialogs")
     explicit PointOfNoReturnDialog(QWidget *parent = nullptr);
 
 private:
@@ -4,12 +4,14 @@
 #include <QDialog>
 #include <QList>
 #include <QString>
+#include "../diagnostics/AllocationTracker.h"
 
 class QuestCompletionDialog : public QDialog
 {
     Q_OBJECT
 
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.dialogs")
     explicit QuestCompletionDialog(const QString &questTitle, int expGained,
                                    int goldGained, const QList<QString> &itemNames,
                                    QWidget *parent = nullptr);
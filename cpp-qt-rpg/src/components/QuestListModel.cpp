@@ -0,0 +1,266 @@
+#include "QuestListModel.h"
+#include "../diagnostics/Profiler.h"
+#include "../game/QuestManager.h"
+#include "../models/Quest.h"
+#include "../models/Player.h"
+#include "../theme/Theme.h"
+#include <QBrush>
+
+QuestListModel::QuestListModel(QObject *parent)
+    : QAbstractListModel(parent), m_player(nullptr)
+{
+}
+
+void QuestListModel::setQuestManager(QuestManager *questManager, Player *player)
+{
+    PYRPG_PROFILE_SCOPE("QuestListModel::setQuestManager");
+    if (m_questManager) {
+        disconnect(m_questManager, nullptr, this, nullptr);
+    }
+
+    beginResetModel();
+    m_questManager = questManager;
+    m_player = player;
+    m_entries.clear();
+    if (m_questManager && m_player) {
+        appendSection(ActiveSection, m_questManager->getActiveQuests());
+        appendSection(AvailableSection, m_questManager->getAvailableQuests());
+        appendSection(CompletedSection, m_questManager->getCompletedQuests());
+        appendSection(LockedSection, m_questManager->getLockedQuests());
+    }
+    endResetModel();
+
+    if (m_questManager) {
+        connect(m_questManager, &QuestManager::questAvailable, this, &QuestListModel::onQuestAvailable);
+        connect(m_questManager, &QuestManager::questAccepted, this, &QuestListModel::onQuestAccepted);
+        connect(m_questManager, &QuestManager::questProgressed, this, &QuestListModel::onQuestProgressed);
+        connect(m_questManager, &QuestManager::questCompleted, this, &QuestListModel::onQuestCompleted);
+        connect(m_questManager, &QObject::destroyed, this, &QuestListModel::onQuestManagerDestroyed);
+    }
+}
+
+void QuestListModel::appendSection(Section section, const QList<Quest*> &quests)
+{
+    bool headerAdded = false;
+    for (Quest *quest : quests) {
+        if (!quest) continue;
+        if (!headerAdded) {
+            m_entries.append({section, ContentId()});
+            headerAdded = true;
+        }
+        m_entries.append({section, ContentId(quest->questId)});
+    }
+}
+
+void QuestListModel::onQuestAvailable(ContentId questId)
+{
+    moveQuest(questId, AvailableSection);
+}
+
+void QuestListModel::onQuestAccepted(ContentId questId)
+{
+    moveQuest(questId, ActiveSection);
+}
+
+void QuestListModel::onQuestProgressed(ContentId questId, int objectiveIndex)
+{
+    Q_UNUSED(objectiveIndex);
+    int row = rowOfQuest(questId);
+    if (row >= 0) {
+        QModelIndex changed = index(row);
+        emit dataChanged(changed, changed, {Qt::DisplayRole});
+    }
+}
+
+void QuestListModel::onQuestCompleted(ContentId questId)
+{
+    moveQuest(questId, CompletedSection);
+}
+
+void QuestListModel::onQuestManagerDestroyed()
+{
+    beginResetModel();
+    m_player = nullptr;
+    m_entries.clear();
+    endResetModel();
+}
+
+void QuestListModel::moveQuest(ContentId questId, Section section)
+{
+    int row = rowOfQuest(questId);
+    if (row >= 0) {
+        if (m_entries[row].section == section) {
+            QModelIndex changed = index(row);
+            emit dataChanged(changed, changed);
+            return;
+        }
+        removeRowAt(row);
+    }
+
+    if (sectionHeaderRow(section) < 0) {
+        int headerRow = sectionEndRow(section);
+        beginInsertRows(QModelIndex(), headerRow, headerRow);
+        m_entries.insert(headerRow, {section, ContentId()});
+        endInsertRows();
+    }
+
+    int insertRow = sectionEndRow(section);
+    beginInsertRows(QModelIndex(), insertRow, insertRow);
+    m_entries.insert(insertRow, {section, questId});
+    endInsertRows();
+}
+
+void QuestListModel::removeRowAt(int row)
+{
+    Section section = m_entries[row].section;
+    beginRemoveRows(QModelIndex(), row, row);
+    m_entries.removeAt(row);
+    endRemoveRows();
+
+    // Drop the header of a section that just became empty
+    int headerRow = sectionHeaderRow(section);
+    if (headerRow >= 0 && sectionEndRow(section) == headerRow + 1) {
+        beginRemoveRows(QModelIndex(), headerRow, headerRow);
+        m_entries.removeAt(headerRow);
+        endRemoveRows();
+    }
+}
+
+int QuestListModel::sectionHeaderRow(Section section) const
+{
+    for (int row = 0; row < m_entries.size(); ++row) {
+        if (m_entries[row].section == section && !m_entries[row].questId.isValid()) {
+            return row;
+        }
+    }
+    return -1;
+}
+
+int QuestListModel::sectionEndRow(Section section) const
+{
+    int row = 0;
+    while (row < m_entries.size() && m_entries[row].section <= section) {
+        ++row;
+    }
+    return row;
+}
+
+int QuestListModel::rowOfQuest(ContentId questId) const
+{
+    for (int row = 0; row < m_entries.size(); ++row) {
+        if (m_entries[row].questId == questId) {
+            return row;
+        }
+    }
+    return -1;
+}
+
+int QuestListModel::questCount(Section section) const
+{
+    int count = 0;
+    for (const Entry &entry : m_entries) {
+        if (entry.section == section && entry.questId.isValid()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+Quest *QuestListModel::resolveQuest(const Entry &entry) const
+{
+    if (!entry.questId.isValid() || !m_questManager) return nullptr;
+    if (entry.quest) return entry.quest;
+
+    // Active and completed quests are read from the player's copy, which is the
+    // one QuestManager updates progress on. Player::getQuest is a linear search,
+    // so the result is kept rather than looked up on every paint.
+    if ((entry.section == ActiveSection || entry.section == CompletedSection) && m_player) {
+        entry.quest = m_player->getQuest(entry.questId.toString());
+    }
+    if (!entry.quest) {
+        entry.quest = m_questManager->getQuestById(entry.questId);
+    }
+    return entry.quest;
+}
+
+Quest *QuestListModel::questAt(int row) const
+{
+    return (row >= 0 && row < m_entries.size()) ? resolveQuest(m_entries[row]) : nullptr;
+}
+
+int QuestListModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_entries.size();
+}
+
+QString QuestListModel::sectionTitle(Section section)
+{
+    switch (section) {
+        case ActiveSection: return "=== ACTIVE QUESTS ===";
+        case AvailableSection: return "=== AVAILABLE QUESTS ===";
+        case CompletedSection: return "=== COMPLETED QUESTS ===";
+        case LockedSection: return "=== LOCKED QUESTS ===";
+    }
+    return QString();
+}
+
+QString QuestListModel::statusBadge(const Quest *quest)
+{
+    if (!quest) return "";
+
+    if (quest->isActive()) {
+        return QString("[%1/%2]").arg(quest->getProgress()).arg(quest->getTotalObjectives());
+    } else if (quest->isComplete()) {
+        return "[✓]";
+    } else if (quest->isAvailable()) {
+        return "[!]";
+    } else {
+        return "[🔒]";
+    }
+}
+
+QVariant QuestListModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_entries.size()) return QVariant();
+
+    const Entry &entry = m_entries[index.row()];
+    const bool isHeader = !entry.questId.isValid();
+
+    switch (role) {
+        case Qt::DisplayRole: {
+            if (isHeader) return sectionTitle(entry.section);
+            Quest *quest = resolveQuest(entry);
+            if (!quest) return entry.questId.toString();
+            if (entry.section == LockedSection) return QString("??? %1").arg(quest->title);
+            return QString("%1  %2").arg(quest->title, statusBadge(quest));
+        }
+        case Qt::ForegroundRole:
+            if (isHeader) {
+                if (entry.section == ActiveSection) return QBrush(Theme::ACCENT);
+                if (entry.section == AvailableSection) return QBrush(Theme::PRIMARY);
+                return QBrush(Theme::MUTED_FOREGROUND);
+            }
+            if (entry.section == CompletedSection || entry.section == LockedSection) {
+                return QBrush(Theme::MUTED_FOREGROUND);
+            }
+            return QVariant();
+        case QuestRole:
+            return QVariant::fromValue(static_cast<void*>(resolveQuest(entry)));
+        case QuestIdRole:
+            return entry.questId.toString();
+        case SectionRole:
+            return int(entry.section);
+        case IsHeaderRole:
+            return isHeader;
+        default:
+            return QVariant();
+    }
+}
+
+Qt::ItemFlags QuestListModel::flags(const QModelIndex &index) const
+{
+    if (!index.isValid() || index.row() >= m_entries.size()) return Qt::NoItemFlags;
+    // Headers are not selectable
+    return m_entries[index.row()].questId.isValid() ? Qt::ItemIsEnabled | Qt::ItemIsSelectable
+                                                    : Qt::ItemIsEnabled;
+}
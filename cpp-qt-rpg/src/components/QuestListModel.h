@@ -0,0 +1,104 @@
+#ifndef QUESTLISTMODEL_H
+#define QUESTLISTMODEL_H
+
+#include "../game/ContentId.h"
+#include <QAbstractListModel>
+#include <QSortFilterProxyModel>
+#include <QPointer>
+#include <QList>
+#include <QString>
+
+class QuestManager;
+class Quest;
+class Player;
+
+// Sectioned list model over a QuestManager's quests (Active, Available,
+// Completed, Locked), each section preceded by a non-selectable header row.
+//
+// The model snapshots the manager once in setQuestManager and then follows its
+// questAvailable/questAccepted/questProgressed/questCompleted signals, moving or
+// refreshing single rows. Views such as the quest log and the combat-page
+// tracker therefore stay live without re-querying the manager.
+class QuestListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    enum Section {
+        ActiveSection = 0,
+        AvailableSection,
+        CompletedSection,
+        LockedSection
+    };
+
+    enum Roles {
+        QuestRole = Qt::UserRole + 1,  // Quest*; null for header rows
+        QuestIdRole,
+        SectionRole,
+        IsHeaderRole
+    };
+
+    explicit QuestListModel(QObject *parent = nullptr);
+
+    // Rebuilds from the manager and subscribes to its signals; null clears the model
+    void setQuestManager(QuestManager *questManager, Player *player);
+    QuestManager *questManager() const { return m_questManager; }
+
+    Quest *questAt(int row) const;
+    int rowOfQuest(ContentId questId) const;
+    int questCount(Section section) const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+    static QString statusBadge(const Quest *quest);
+
+private slots:
+    void onQuestAvailable(ContentId questId);
+    void onQuestAccepted(ContentId questId);
+    void onQuestProgressed(ContentId questId, int objectiveIndex);
+    void onQuestCompleted(ContentId questId);
+    void onQuestManagerDestroyed();
+
+private:
+    struct Entry
+    {
+        Section section;
+        ContentId questId;  // Invalid for a section header
+        // Resolved on first use; a quest changing section gets a new entry
+        mutable Quest *quest = nullptr;
+    };
+
+    QPointer<QuestManager> m_questManager;
+    Player *m_player;
+    QList<Entry> m_entries;  // Ordered by section
+
+    void appendSection(Section section, const QList<Quest*> &quests);
+    // Moves (or inserts) a quest row to the end of a section, adding or
+    // dropping section headers as needed
+    void moveQuest(ContentId questId, Section section);
+    void removeRowAt(int row);
+    int sectionHeaderRow(Section section) const;
+    int sectionEndRow(Section section) const;
+    Quest *resolveQuest(const Entry &entry) const;
+    static QString sectionTitle(Section section);
+};
+
+// Active quests only, without headers; feeds compact trackers such as the
+// one on CombatPage
+class ActiveQuestFilterModel : public QSortFilterProxyModel
+{
+public:
+    using QSortFilterProxyModel::QSortFilterProxyModel;
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const override
+    {
+        QModelIndex index = sourceModel()->index(sourceRow, 0, sourceParent);
+        return !index.data(QuestListModel::IsHeaderRole).toBool()
+            && index.data(QuestListModel::SectionRole).toInt() == QuestListModel::ActiveSection;
+    }
+};
+
+#endif // QUESTLISTMODEL_H
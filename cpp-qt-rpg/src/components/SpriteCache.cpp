@@ -0,0 +1,134 @@
+#include "SpriteCache.h"
+#include "SpriteManifest.h"
+#include "../diagnostics/Profiler.h"
+#include <QFile>
+#include <QHash>
+#include <QtMath>
+
+SpriteCache &SpriteCache::instance()
+{
+    static SpriteCache cache;
+    return cache;
+}
+
+QImage SpriteCache::image(const QString &assetPath)
+{
+    auto it = m_sources.constFind(assetPath);
+    if (it != m_sources.constEnd()) {
+        return it.value();
+    }
+
+    PYRPG_PROFILE_SCOPE("SpriteCache::decode");
+    PYRPG_PROFILE_COUNT("sprites.decoded", 1);
+    QImage decoded = sourceImage(assetPath);  // Null for missing assets; cached so we never retry
+    m_sources.insert(assetPath, decoded);
+    return decoded;
+}
+
+QImage SpriteCache::sourceImage(const QString &assetPath)
+{
+    if (QFile::exists(assetPath)) {
+        return QImage(assetPath);
+    }
+
+    // The app bundles only the pipeline output: use the largest, densest variant
+    auto it = SpriteManifest::variants().constFind(assetPath);
+    if (it == SpriteManifest::variants().constEnd()) {
+        return QImage();
+    }
+    const SpriteManifest::Variant *largest = nullptr;
+    for (const SpriteManifest::Variant &variant : it.value()) {
+        if (!largest || variant.size * variant.scale > largest->size * largest->scale) {
+            largest = &variant;
+        }
+    }
+    return largest ? QImage(largest->path) : QImage();
+}
+
+QPixmap SpriteCache::pixmap(const QString &assetPath, const QSize &size, qreal devicePixelRatio)
+{
+    const VariantKey key{assetPath, size, qRound(devicePixelRatio * 100)};
+    auto it = m_variants.constFind(key);
+    if (it != m_variants.constEnd()) {
+        return it.value();
+    }
+
+    QImage scaled = prescaledImage(assetPath, size, devicePixelRatio);
+    if (scaled.isNull()) {
+        scaled = scaledImage(image(assetPath), size, devicePixelRatio);
+    }
+    insertScaledImage(assetPath, size, devicePixelRatio, scaled);
+    return m_variants.value(key);
+}
+
+QImage SpriteCache::prescaledImage(const QString &assetPath, const QSize &size, qreal devicePixelRatio)
+{
+    const auto &manifest = SpriteManifest::variants();
+    auto it = manifest.constFind(assetPath);
+    if (it == manifest.constEnd() || size.width() != size.height()) {
+        return QImage();  // Variants are fitted into square boxes
+    }
+
+    // The sparsest variant that is still dense enough for the screen, else the densest there is
+    const SpriteManifest::Variant *best = nullptr;
+    for (const SpriteManifest::Variant &variant : it.value()) {
+        if (variant.size != size.width()) {
+            continue;
+        }
+        bool bestTooSparse = best && best->scale < devicePixelRatio;
+        if (!best || (bestTooSparse && variant.scale > best->scale)
+            || (!bestTooSparse && variant.scale >= devicePixelRatio && variant.scale < best->scale)) {
+            best = &variant;
+        }
+    }
+    if (!best) {
+        return QImage();
+    }
+
+    PYRPG_PROFILE_COUNT("sprites.prescaled", 1);
+    QImage image(best->path);
+    if (qFuzzyCompare(qreal(best->scale), devicePixelRatio)) {
+        return image;
+    }
+    // Fractional ratios scale from the nearest variant, still far cheaper than from the source
+    return scaledImage(image, size, devicePixelRatio);
+}
+
+QImage SpriteCache::scaledImage(const QImage &source, const QSize &size, qreal devicePixelRatio)
+{
+    if (source.isNull() || size.isEmpty()) {
+        return QImage();
+    }
+    PYRPG_PROFILE_SCOPE("SpriteCache::scale");
+    PYRPG_PROFILE_COUNT("sprites.scaled", 1);
+    QSize physicalSize(qCeil(size.width() * devicePixelRatio), qCeil(size.height() * devicePixelRatio));
+    return source.scaled(physicalSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+}
+
+void SpriteCache::insertImage(const QString &assetPath, const QImage &image)
+{
+    if (!m_sources.contains(assetPath)) {
+        m_sources.insert(assetPath, image);
+    }
+}
+
+void SpriteCache::insertScaledImage(const QString &assetPath, const QSize &size, qreal devicePixelRatio,
+                                    const QImage &scaled)
+{
+    const VariantKey key{assetPath, size, qRound(devicePixelRatio * 100)};
+    if (m_variants.contains(key)) {
+        return;
+    }
+    QPixmap variant;
+    if (!scaled.isNull()) {
+        variant = QPixmap::fromImage(scaled);
+        variant.setDevicePixelRatio(devicePixelRatio);
+    }
+    m_variants.insert(key, variant);
+}
+
+void SpriteCache::clear()
+{
+    m_sources.clear();
+    m_variants.clear();
+}
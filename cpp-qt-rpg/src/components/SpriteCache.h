@@ -0,0 +1,77 @@
+#ifndef SPRITECACHE_H
+#define SPRITECACHE_H
+
+#include <QString>
+#include <QSize>
+#include <QHash>
+#include <QImage>
+#include <QPixmap>
+
+// Shared cache of decoded sprite assets and their scaled variants.
+//
+// Each asset (e.g. ":/assets/warrior.png") is decoded once; scaled variants are
+// keyed by (asset, logical size, device pixel ratio) and rendered at physical
+// resolution, so repeated lookups are a hash hit returning an implicitly shared
+// QPixmap. Missing assets are remembered too and yield a null pixmap. Variants the
+// build pre-scaled (":/sprites/manifest.json") are loaded directly. Other sizes are
+// scaled from the full-size source where it is bundled (the tests bundle
+// assets.qrc), else from the asset's largest pre-scaled variant; the app bundles
+// only the pipeline output, so an asset missing from assets/sprites.json has no
+// image at all (ContentDatabase warns about such monster sprites).
+//
+// GUI thread only (QPixmap), apart from the static scaledImage().
+class SpriteCache
+{
+public:
+    static SpriteCache &instance();
+
+    // Asset scaled to fit within size (aspect ratio kept); null if the asset is missing
+    QPixmap pixmap(const QString &assetPath, const QSize &size, qreal devicePixelRatio = 1.0);
+
+    // Largest image of the asset this build has (see sourceImage), decoded once
+    QImage image(const QString &assetPath);
+    // The full-size source if bundled, else the largest pre-scaled variant; null if
+    // the build has neither. Uncached, any thread.
+    static QImage sourceImage(const QString &assetPath);
+
+    // Seed the cache with work done off the GUI thread (see ContentWarmup); entries
+    // that are already cached are kept
+    void insertImage(const QString &assetPath, const QImage &image);
+    void insertScaledImage(const QString &assetPath, const QSize &size, qreal devicePixelRatio, const QImage &scaled);
+
+    // The scaled variant pixmap() would produce; QImage only, so any thread may call it
+    static QImage scaledImage(const QImage &source, const QSize &size, qreal devicePixelRatio);
+    // Variant pre-scaled at build time (see src/tools/AssetTool.cpp and assets/sprites.json),
+    // already at physical size; null if the manifest has none for this asset and size.
+    // Any thread.
+    static QImage prescaledImage(const QString &assetPath, const QSize &size, qreal devicePixelRatio);
+
+    int decodedAssetCount() const { return m_sources.size(); }
+    int variantCount() const { return m_variants.size(); }
+    void clear();
+
+private:
+    SpriteCache() = default;
+    SpriteCache(const SpriteCache &) = delete;
+    SpriteCache &operator=(const SpriteCache &) = delete;
+
+    struct VariantKey {
+        QString assetPath;
+        QSize size;
+        int dprPercent;
+
+        bool operator==(const VariantKey &other) const
+        {
+            return dprPercent == other.dprPercent && size == other.size && assetPath == other.assetPath;
+        }
+    };
+    friend size_t qHash(const VariantKey &key, size_t seed)
+    {
+        return qHashMulti(seed, key.assetPath, key.size.width(), key.size.height(), key.dprPercent);
+    }
+
+    QHash<QString, QImage> m_sources;
+    QHash<VariantKey, QPixmap> m_variants;
+};
+
+#endif // SPRITECACHE_H
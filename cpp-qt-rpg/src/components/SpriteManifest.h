@@ -0,0 +1,53 @@
+#ifndef SPRITEMANIFEST_H
+#define SPRITEMANIFEST_H
+
+#include <QFile>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+
+// The sprite pipeline's manifest (":/sprites/manifest.json", written by
+// pyrpg-assettool from assets/sprites.json): for each source asset path, the
+// pre-scaled variants the build bundles. Header-only so content validation can
+// consult it without linking the sprite cache. Any thread.
+namespace SpriteManifest {
+
+struct Variant {
+    int size;   // Logical box the sprite was fitted into
+    int scale;  // Device pixel ratio it was rendered for
+    QString path;
+};
+
+// Read once; empty when the build did not bundle the sprite pipeline's output
+inline const QHash<QString, QList<Variant>> &variants()
+{
+    static const QHash<QString, QList<Variant>> variants = []() {
+        QHash<QString, QList<Variant>> variants;
+        QFile file(":/sprites/manifest.json");
+        if (!file.open(QIODevice::ReadOnly)) {
+            return variants;
+        }
+        const QJsonArray sprites = QJsonDocument::fromJson(file.readAll()).object().value("sprites").toArray();
+        for (const QJsonValue &value : sprites) {
+            const QJsonObject sprite = value.toObject();
+            variants[sprite.value("source").toString()].append({sprite.value("size").toInt(),
+                                                                sprite.value("scale").toInt(),
+                                                                sprite.value("path").toString()});
+        }
+        return variants;
+    }();
+    return variants;
+}
+
+// Whether this build can draw the asset at all: pre-scaled, or from a bundled source
+inline bool canDraw(const QString &assetPath)
+{
+    return variants().contains(assetPath) || QFile::exists(assetPath);
+}
+
+} // namespace SpriteManifest
+
+#endif // SPRITEMANIFEST_H
@@ -16,7 +16,7 @@ public:
     void clearValidation();
 
 private:
-    void applyStyle(const QString &color, const QString &bgColor, const QString &messagePrefix);
+    void applyState(const QString &state, const QString &messagePrefix);
 };
 
 #endif // VALIDATIONLABEL_H
\ No newline at end of file
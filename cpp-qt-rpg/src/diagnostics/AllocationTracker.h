@@ -0,0 +1,179 @@
+#ifndef ALLOCATIONTRACKER_H
+#define ALLOCATIONTRACKER_H
+
+#include <QString>
+#include <QList>
+#include <QMap>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QFile>
+#include <QTextStream>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+// Opt-in per-subsystem allocation accounting.
+//
+// Classes opt in with PYRPG_TRACK_ALLOCATIONS("tag") in a public section, which
+// gives them class-specific operator new/delete that count live objects and bytes
+// per tag. Subclasses share their base's tag unless they declare their own.
+// Bytes are shallow (sizeof the object); heap data owned by members such as
+// QString is not attributed.
+//
+// Usage:
+//   class Item {
+//   public:
+//       PYRPG_TRACK_ALLOCATIONS("models.Item")
+//       ...
+//   };
+//
+// The macro expands to nothing unless PYRPG_ENABLE_ALLOCATION_TRACKING is defined
+// (CMake option PYRPG_ALLOCATION_TRACKING).
+
+struct AllocationTag
+{
+    explicit AllocationTag(const QString &tagName)
+        : name(tagName), liveCount(0), liveBytes(0), totalAllocations(0) {}
+
+    QString name;
+    std::atomic<qint64> liveCount;
+    std::atomic<qint64> liveBytes;
+    std::atomic<qint64> totalAllocations;
+};
+
+struct AllocationSnapshot
+{
+    QString name;
+    qint64 liveCount;
+    qint64 liveBytes;
+    qint64 totalAllocations;
+};
+
+class AllocationTracker
+{
+public:
+    static AllocationTracker &instance()
+    {
+        static AllocationTracker tracker;
+        return tracker;
+    }
+
+    // Returned pointers stay valid for the lifetime of the process
+    AllocationTag *tag(const QString &name)
+    {
+        QMutexLocker locker(&m_mutex);
+        AllocationTag *&tag = m_tags[name];
+        if (!tag) {
+            tag = new AllocationTag(name);
+        }
+        return tag;
+    }
+
+    static void *allocate(AllocationTag *tag, std::size_t size)
+    {
+        void *ptr = ::operator new(size);
+        tag->liveCount.fetch_add(1, std::memory_order_relaxed);
+        tag->liveBytes.fetch_add(qint64(size), std::memory_order_relaxed);
+        tag->totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        return ptr;
+    }
+
+    static void deallocate(AllocationTag *tag, void *ptr, std::size_t size)
+    {
+        if (!ptr) return;
+        tag->liveCount.fetch_sub(1, std::memory_order_relaxed);
+        tag->liveBytes.fetch_sub(qint64(size), std::memory_order_relaxed);
+        ::operator delete(ptr);
+    }
+
+    // Sorted by tag name
+    QList<AllocationSnapshot> snapshots() const
+    {
+        QMutexLocker locker(&m_mutex);
+        QList<AllocationSnapshot> snapshots;
+        for (const AllocationTag *tag : m_tags) {
+            snapshots.append({tag->name,
+                              tag->liveCount.load(std::memory_order_relaxed),
+                              tag->liveBytes.load(std::memory_order_relaxed),
+                              tag->totalAllocations.load(std::memory_order_relaxed)});
+        }
+        return snapshots;
+    }
+
+    qint64 totalLiveBytes() const
+    {
+        qint64 total = 0;
+        for (const AllocationSnapshot &snapshot : snapshots()) {
+            total += snapshot.liveBytes;
+        }
+        return total;
+    }
+
+    // Plain-text table of every tag
+    QString report() const
+    {
+        QString text;
+        QTextStream out(&text);
+        out << QString("%1 %2 %3 %4\n")
+                   .arg(QStringLiteral("tag"), -28)
+                   .arg(QStringLiteral("live"), 10)
+                   .arg(QStringLiteral("bytes"), 12)
+                   .arg(QStringLiteral("allocs"), 12);
+        for (const AllocationSnapshot &snapshot : snapshots()) {
+            out << QString("%1 %2 %3 %4\n")
+                       .arg(snapshot.name, -28)
+                       .arg(snapshot.liveCount, 10)
+                       .arg(snapshot.liveBytes, 12)
+                       .arg(snapshot.totalAllocations, 12);
+        }
+        return text;
+    }
+
+    bool writeReport(const QString &filePath) const
+    {
+        QFile file(filePath);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+            return false;
+        }
+        QTextStream out(&file);
+        out << report();
+        return out.status() == QTextStream::Ok;
+    }
+
+    static constexpr bool isEnabled()
+    {
+#ifdef PYRPG_ENABLE_ALLOCATION_TRACKING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+private:
+    AllocationTracker() = default;
+    AllocationTracker(const AllocationTracker &) = delete;
+    AllocationTracker &operator=(const AllocationTracker &) = delete;
+
+    // Tags are intentionally never freed: classes cache them in statics
+    mutable QMutex m_mutex;
+    QMap<QString, AllocationTag*> m_tags;
+};
+
+#ifdef PYRPG_ENABLE_ALLOCATION_TRACKING
+// Placement forms are re-declared because class-specific operator new hides the
+// global ones that containers use for in-place construction.
+#define PYRPG_TRACK_ALLOCATIONS(tagName) \
+    static AllocationTag *allocationTag() \
+    { \
+        static AllocationTag *tag = AllocationTracker::instance().tag(QStringLiteral(tagName)); \
+        return tag; \
+    } \
+    static void *operator new(std::size_t size) { return AllocationTracker::allocate(allocationTag(), size); } \
+    static void operator delete(void *ptr, std::size_t size) { AllocationTracker::deallocate(allocationTag(), ptr, size); } \
+    static void *operator new(std::size_t, void *where) noexcept { return where; } \
+    static void operator delete(void *, void *) noexcept {}
+#else
+#define PYRPG_TRACK_ALLOCATIONS(tagName)
+#endif
+
+#endif // ALLOCATIONTRACKER_H
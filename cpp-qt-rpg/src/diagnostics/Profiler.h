@@ -0,0 +1,267 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <QString>
+#include <QList>
+#include <QMap>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QElapsedTimer>
+#include <QtAlgorithms>
+#include "Tracer.h"
+#include <atomic>
+#include <array>
+
+// Lightweight hot-path instrumentation: named scoped timers and counters.
+//
+// Usage:
+//   PYRPG_PROFILE_SCOPE("Game::playerAttack");    // times the enclosing scope
+//   PYRPG_PROFILE_COUNT("particles.spawned", n);  // adds n to a counter
+//
+// Each timer name owns a log-linear latency histogram (4 sub-buckets per power
+// of two, so percentiles are within 25%). Probes are looked up once per call
+// site and cached in a function-local static; recording is lock-free.
+// While the Tracer is recording, each timed scope also becomes a begin/end
+// trace event (see Tracer.h).
+//
+// The macros expand to nothing unless PYRPG_ENABLE_PROFILING is defined
+// (CMake option PYRPG_PROFILING).
+
+struct ProfileProbe
+{
+    static const int BUCKET_COUNT = 256;
+
+    explicit ProfileProbe(const QString &probeName) : name(probeName) { reset(); }
+
+    QString name;
+    std::array<std::atomic<quint64>, BUCKET_COUNT> buckets;
+    std::atomic<quint64> count;
+    std::atomic<quint64> totalNs;
+    std::atomic<quint64> maxNs;
+
+    static int bucketIndex(quint64 ns)
+    {
+        if (ns < 4) {
+            return int(ns);
+        }
+        int exponent = 63 - qCountLeadingZeroBits(ns);
+        int sub = int((ns >> (exponent - 2)) & 3);
+        return (exponent - 1) * 4 + sub;
+    }
+
+    // Midpoint of the bucket's value range
+    static quint64 bucketValue(int index)
+    {
+        if (index < 4) {
+            return quint64(index);
+        }
+        int exponent = index / 4 + 1;
+        int sub = index % 4;
+        quint64 lower = quint64(4 + sub) << (exponent - 2);
+        quint64 width = quint64(1) << (exponent - 2);
+        return lower + width / 2;
+    }
+
+    void record(qint64 ns)
+    {
+        quint64 value = ns > 0 ? quint64(ns) : 0;
+        buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+        totalNs.fetch_add(value, std::memory_order_relaxed);
+        quint64 previousMax = maxNs.load(std::memory_order_relaxed);
+        while (value > previousMax
+               && !maxNs.compare_exchange_weak(previousMax, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    // p in [0, 1]; returns nanoseconds
+    quint64 percentile(double p) const
+    {
+        quint64 total = 0;
+        for (const auto &bucket : buckets) {
+            total += bucket.load(std::memory_order_relaxed);
+        }
+        if (total == 0) {
+            return 0;
+        }
+
+        quint64 target = quint64(p * double(total));
+        if (target < 1) target = 1;
+        quint64 cumulative = 0;
+        for (int i = 0; i < BUCKET_COUNT; ++i) {
+            cumulative += buckets[i].load(std::memory_order_relaxed);
+            if (cumulative >= target) {
+                return bucketValue(i);
+            }
+        }
+        return maxNs.load(std::memory_order_relaxed);
+    }
+
+    void reset()
+    {
+        for (auto &bucket : buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        count.store(0, std::memory_order_relaxed);
+        totalNs.store(0, std::memory_order_relaxed);
+        maxNs.store(0, std::memory_order_relaxed);
+    }
+};
+
+struct ProfileCounter
+{
+    explicit ProfileCounter(const QString &counterName) : name(counterName), value(0) {}
+
+    QString name;
+    std::atomic<qint64> value;
+};
+
+struct ProbeSnapshot
+{
+    QString name;
+    quint64 count;
+    quint64 p50Ns;
+    quint64 p99Ns;
+    quint64 maxNs;
+    quint64 meanNs;
+};
+
+struct CounterSnapshot
+{
+    QString name;
+    qint64 value;
+};
+
+class Profiler
+{
+public:
+    static Profiler &instance()
+    {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    // Returned pointers stay valid for the lifetime of the process
+    ProfileProbe *probe(const QString &name)
+    {
+        QMutexLocker locker(&m_mutex);
+        ProfileProbe *&probe = m_probes[name];
+        if (!probe) {
+            probe = new ProfileProbe(name);
+        }
+        return probe;
+    }
+
+    ProfileCounter *counter(const QString &name)
+    {
+        QMutexLocker locker(&m_mutex);
+        ProfileCounter *&counter = m_counters[name];
+        if (!counter) {
+            counter = new ProfileCounter(name);
+        }
+        return counter;
+    }
+
+    // Sorted by name
+    QList<ProbeSnapshot> probeSnapshots() const
+    {
+        QMutexLocker locker(&m_mutex);
+        QList<ProbeSnapshot> snapshots;
+        for (const ProfileProbe *probe : m_probes) {
+            ProbeSnapshot snapshot;
+            snapshot.name = probe->name;
+            snapshot.count = probe->count.load(std::memory_order_relaxed);
+            snapshot.p50Ns = probe->percentile(0.50);
+            snapshot.p99Ns = probe->percentile(0.99);
+            snapshot.maxNs = probe->maxNs.load(std::memory_order_relaxed);
+            snapshot.meanNs = snapshot.count > 0
+                ? probe->totalNs.load(std::memory_order_relaxed) / snapshot.count : 0;
+            snapshots.append(snapshot);
+        }
+        return snapshots;
+    }
+
+    QList<CounterSnapshot> counterSnapshots() const
+    {
+        QMutexLocker locker(&m_mutex);
+        QList<CounterSnapshot> snapshots;
+        for (const ProfileCounter *counter : m_counters) {
+            snapshots.append({counter->name, counter->value.load(std::memory_order_relaxed)});
+        }
+        return snapshots;
+    }
+
+    void reset()
+    {
+        QMutexLocker locker(&m_mutex);
+        for (ProfileProbe *probe : m_probes) {
+            probe->reset();
+        }
+        for (ProfileCounter *counter : m_counters) {
+            counter->value.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    static constexpr bool isEnabled()
+    {
+#ifdef PYRPG_ENABLE_PROFILING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+private:
+    Profiler() = default;
+    Profiler(const Profiler &) = delete;
+    Profiler &operator=(const Profiler &) = delete;
+
+    // Probes and counters are intentionally never freed: call sites cache them in statics
+    mutable QMutex m_mutex;
+    QMap<QString, ProfileProbe*> m_probes;
+    QMap<QString, ProfileCounter*> m_counters;
+};
+
+// Also emits begin/end trace events while the Tracer is recording
+class ScopedProfileTimer
+{
+public:
+    ScopedProfileTimer(ProfileProbe *probe, const char *traceName)
+        : m_probe(probe), m_traceName(traceName)
+    {
+        Tracer::instance().begin(m_traceName);
+        m_timer.start();
+    }
+    ~ScopedProfileTimer()
+    {
+        m_probe->record(m_timer.nsecsElapsed());
+        Tracer::instance().end(m_traceName);
+    }
+
+    ScopedProfileTimer(const ScopedProfileTimer &) = delete;
+    ScopedProfileTimer &operator=(const ScopedProfileTimer &) = delete;
+
+private:
+    ProfileProbe *m_probe;
+    const char *m_traceName;
+    QElapsedTimer m_timer;
+};
+
+#define PYRPG_PROFILE_CONCAT_INNER(a, b) a##b
+#define PYRPG_PROFILE_CONCAT(a, b) PYRPG_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef PYRPG_ENABLE_PROFILING
+#define PYRPG_PROFILE_SCOPE(name) \
+    static ProfileProbe *PYRPG_PROFILE_CONCAT(pyrpgProbe_, __LINE__) = Profiler::instance().probe(QStringLiteral(name)); \
+    ScopedProfileTimer PYRPG_PROFILE_CONCAT(pyrpgTimer_, __LINE__)(PYRPG_PROFILE_CONCAT(pyrpgProbe_, __LINE__), name)
+#define PYRPG_PROFILE_COUNT(name, delta) \
+    do { \
+        static ProfileCounter *pyrpgCounter = Profiler::instance().counter(QStringLiteral(name)); \
+        pyrpgCounter->value.fetch_add(qint64(delta), std::memory_order_relaxed); \
+    } while (0)
+#else
+#define PYRPG_PROFILE_SCOPE(name) do {} while (0)
+#define PYRPG_PROFILE_COUNT(name, delta) do {} while (0)
+#endif
+
+#endif // PROFILER_H
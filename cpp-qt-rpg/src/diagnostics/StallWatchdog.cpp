@@ -0,0 +1,182 @@
+#include "StallWatchdog.h"
+#include "Tracer.h"
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QMetaObject>
+#include <QSettings>
+#include <QStandardPaths>
+#include <QTextStream>
+#include <QDebug>
+
+StallWatchdog::StallWatchdog(int thresholdMs, QObject *parent)
+    : QThread(parent),
+      m_thresholdMs(qMax(1, thresholdMs)),
+      m_heartbeatReceiver(new QObject()),
+      m_stopRequested(false),
+      m_heartbeatPending(false),
+      m_heartbeatSentNs(0),
+      m_heartbeatReceivedNs(0),
+      m_stallCount(0)
+{
+    setObjectName("StallWatchdog");
+
+    QString dataDir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    QDir().mkpath(dataDir);
+    m_reportPath = dataDir + "/stalls.log";
+}
+
+StallWatchdog::~StallWatchdog()
+{
+    stop();
+    wait();
+    // Deleting the receiver drops any heartbeat still queued on the GUI thread
+    delete m_heartbeatReceiver;
+    Tracer::instance().setBackgroundRecording(false);
+}
+
+void StallWatchdog::stop()
+{
+    m_stopRequested.store(true, std::memory_order_relaxed);
+}
+
+int StallWatchdog::configuredThresholdMs()
+{
+    QSettings settings;
+    int thresholdMs = settings.value("diagnostics/stallThresholdMs", DEFAULT_THRESHOLD_MS).toInt();
+
+    if (qEnvironmentVariableIsSet("PYRPG_STALL_MS")) {
+        bool ok = false;
+        int overrideMs = qEnvironmentVariableIntValue("PYRPG_STALL_MS", &ok);
+        if (ok && overrideMs >= 0) {
+            thresholdMs = overrideMs;
+        } else {
+            qWarning() << "Ignoring invalid PYRPG_STALL_MS value" << qgetenv("PYRPG_STALL_MS");
+        }
+    }
+    return qMax(0, thresholdMs);
+}
+
+void StallWatchdog::run()
+{
+    Tracer &tracer = Tracer::instance();
+    tracer.setBackgroundRecording(true);
+
+    const qint64 thresholdNs = qint64(m_thresholdMs) * 1000000;
+    const unsigned long pollMs = qMax(1, m_thresholdMs / 4);
+
+    bool stallCaptured = false;
+    qint64 stallStartNs = 0;
+    QStringList inFlight;
+    QStringList recentEvents;
+
+    while (!m_stopRequested.load(std::memory_order_relaxed)) {
+        if (!m_heartbeatPending.load(std::memory_order_acquire)) {
+            qint64 sentNs = m_heartbeatSentNs.load(std::memory_order_relaxed);
+            qint64 durationNs = m_heartbeatReceivedNs.load(std::memory_order_relaxed) - sentNs;
+
+            if (sentNs > 0 && durationNs > thresholdNs) {
+                if (!stallCaptured) {
+                    // The stall ended between polls; the buffers still hold its events
+                    recentEvents = captureRecentEvents(sentNs);
+                    inFlight.clear();
+                }
+                m_stallCount.fetch_add(1, std::memory_order_relaxed);
+                appendReport(durationNs, inFlight, recentEvents);
+            }
+            stallCaptured = false;
+            sendHeartbeat();
+        } else if (!stallCaptured) {
+            stallStartNs = m_heartbeatSentNs.load(std::memory_order_relaxed);
+            if (tracer.nowNs() - stallStartNs > thresholdNs) {
+                // Capture while the GUI thread is still blocked so in-flight scopes are visible
+                inFlight = captureInFlightScopes();
+                recentEvents = captureRecentEvents(stallStartNs);
+                stallCaptured = true;
+            }
+        }
+
+        msleep(pollMs);
+    }
+}
+
+void StallWatchdog::sendHeartbeat()
+{
+    m_heartbeatPending.store(true, std::memory_order_relaxed);
+    m_heartbeatSentNs.store(Tracer::instance().nowNs(), std::memory_order_relaxed);
+
+    QMetaObject::invokeMethod(m_heartbeatReceiver, [this]() {
+        m_heartbeatReceivedNs.store(Tracer::instance().nowNs(), std::memory_order_relaxed);
+        m_heartbeatPending.store(false, std::memory_order_release);
+    }, Qt::QueuedConnection);
+}
+
+QStringList StallWatchdog::captureInFlightScopes() const
+{
+    // Replay the GUI thread's recent begin/end events; whatever is still open is in flight
+    const QList<TraceEvent> events = Tracer::instance().recentThreadEvents(m_heartbeatReceiver->thread(), 1024);
+
+    QStringList openScopes;
+    for (const TraceEvent &event : events) {
+        if (event.phase == 'B') {
+            openScopes.append(QString::fromUtf8(event.name));
+        } else if (event.phase == 'E' && !openScopes.isEmpty()) {
+            openScopes.removeLast();
+        }
+    }
+    return openScopes;
+}
+
+QStringList StallWatchdog::captureRecentEvents(qint64 stallStartNs) const
+{
+    QList<ThreadTraceEvent> events = Tracer::instance().recentEvents(RECENT_EVENT_COUNT);
+    if (events.size() > RECENT_EVENT_COUNT) {
+        events = events.mid(events.size() - RECENT_EVENT_COUNT);
+    }
+
+    QStringList lines;
+    for (const ThreadTraceEvent &entry : std::as_const(events)) {
+        double offsetMs = (entry.event.timestampNs - stallStartNs) / 1000000.0;
+        lines.append(QString("%1 ms  tid %2  %3  %4  %5")
+            .arg(offsetMs, 10, 'f', 3)
+            .arg(entry.threadId)
+            .arg(QChar(entry.event.phase))
+            .arg(QString::fromUtf8(entry.event.category), -6)
+            .arg(QString::fromUtf8(entry.event.name)));
+    }
+    return lines;
+}
+
+void StallWatchdog::appendReport(qint64 durationNs, const QStringList &inFlight, const QStringList &recentEvents)
+{
+    // Keep the report bounded across sessions: one rotated generation
+    QFileInfo reportInfo(m_reportPath);
+    if (reportInfo.exists() && reportInfo.size() > MAX_REPORT_BYTES) {
+        QString previousPath = m_reportPath + ".1";
+        QFile::remove(previousPath);
+        QFile::rename(m_reportPath, previousPath);
+    }
+
+    QFile file(m_reportPath);
+    if (!file.open(QIODevice::Append | QIODevice::Text)) {
+        qWarning() << "StallWatchdog: cannot write report to" << m_reportPath;
+        return;
+    }
+
+    QTextStream out(&file);
+    out << "=== Stall at " << QDateTime::currentDateTime().toString(Qt::ISODateWithMs)
+        << ": " << QString::number(durationNs / 1000000.0, 'f', 1) << " ms"
+        << " (threshold " << m_thresholdMs << " ms) ===\n";
+    out << "In flight: " << (inFlight.isEmpty() ? QString("(none recorded)") : inFlight.join(" > ")) << "\n";
+    if (recentEvents.isEmpty()) {
+        out << "No trace events recorded\n";
+    } else {
+        out << "Recent trace events (relative to stall start):\n";
+        for (const QString &line : recentEvents) {
+            out << "  " << line << "\n";
+        }
+    }
+    out << "\n";
+}
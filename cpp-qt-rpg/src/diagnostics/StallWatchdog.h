@@ -0,0 +1,63 @@
+#ifndef STALLWATCHDOG_H
+#define STALLWATCHDOG_H
+
+#include <QThread>
+#include <QString>
+#include <QStringList>
+#include <atomic>
+
+class QObject;
+
+// Background thread that detects GUI event-loop stalls ("hitches").
+//
+// The watchdog posts a heartbeat to the GUI thread's event queue and measures
+// how long it takes to be delivered. When a heartbeat is late by more than the
+// threshold, it captures the instrumented scopes in flight on the GUI thread and
+// the most recent trace events (it keeps the Tracer recording in the background
+// while running), then appends a report once the stall ends.
+//
+// Reports go to <AppDataLocation>/stalls.log, rotated to stalls.log.1 when the
+// file exceeds MAX_REPORT_BYTES. Scope data needs a PYRPG_PROFILING build; stall
+// durations are recorded either way.
+class StallWatchdog : public QThread
+{
+public:
+    static const int DEFAULT_THRESHOLD_MS = 50;
+
+    // Must be constructed on the GUI thread
+    explicit StallWatchdog(int thresholdMs = DEFAULT_THRESHOLD_MS, QObject *parent = nullptr);
+    ~StallWatchdog() override;
+
+    void stop();
+
+    int thresholdMs() const { return m_thresholdMs; }
+    QString reportPath() const { return m_reportPath; }
+    int stallCount() const { return m_stallCount.load(std::memory_order_relaxed); }
+
+    // QSettings "diagnostics/stallThresholdMs", overridden by the PYRPG_STALL_MS
+    // environment variable; 0 disables the watchdog
+    static int configuredThresholdMs();
+
+protected:
+    void run() override;
+
+private:
+    static const int RECENT_EVENT_COUNT = 48;
+    static const qint64 MAX_REPORT_BYTES = 512 * 1024;
+
+    int m_thresholdMs;
+    QString m_reportPath;
+    QObject *m_heartbeatReceiver;  // Lives on the GUI thread; queued heartbeats die with it
+    std::atomic<bool> m_stopRequested;
+    std::atomic<bool> m_heartbeatPending;
+    std::atomic<qint64> m_heartbeatSentNs;
+    std::atomic<qint64> m_heartbeatReceivedNs;
+    std::atomic<int> m_stallCount;
+
+    void sendHeartbeat();
+    QStringList captureInFlightScopes() const;
+    QStringList captureRecentEvents(qint64 stallStartNs) const;
+    void appendReport(qint64 durationNs, const QStringList &inFlight, const QStringList &recentEvents);
+};
+
+#endif // STALLWATCHDOG_H
@@ -0,0 +1,348 @@
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <QString>
+#include <QList>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QTextStream>
+#include <QThread>
+#include <QCoreApplication>
+#include <QEvent>
+#include <QObject>
+#include <atomic>
+#include <algorithm>
+
+// Optional event tracer producing Chrome trace JSON (chrome://tracing, Perfetto).
+//
+// Every PYRPG_PROFILE_SCOPE also records begin/end events while tracing is on;
+// PYRPG_TRACE_SCOPE and PYRPG_TRACE_INSTANT add trace-only events (signal slots,
+// page switches, input). Names and categories must be string literals or otherwise
+// live for the whole process (e.g. QMetaObject::className()).
+//
+// Recording is toggled at runtime with Tracer::setEnabled (F4 in the game window,
+// or the PYRPG_TRACE environment variable at startup); writeChromeTrace dumps the
+// buffered events on demand. Diagnostics such as the stall watchdog keep the ring
+// buffers filling in the background with setBackgroundRecording.
+//
+// Each thread writes into its own fixed-size ring buffer without locking; the
+// mutex is only taken when a thread records its first event and when dumping.
+// Readers check each slot's sequence number and skip entries overwritten while
+// they were being copied. Recording is a no-op while tracing is disabled (the
+// default).
+
+struct TraceEvent
+{
+    const char *name;
+    const char *category;
+    qint64 timestampNs;
+    char phase;  // 'B' begin, 'E' end, 'i' instant
+};
+
+class TraceBuffer
+{
+public:
+    static const int CAPACITY = 1 << 16;  // Most recent events kept per thread
+
+    TraceBuffer(int threadId, const QString &threadName, QThread *thread)
+        : m_threadId(threadId), m_threadName(threadName), m_thread(thread), m_writeIndex(0), m_clearedIndex(0)
+    {
+        m_slots = new Slot[CAPACITY];
+    }
+    ~TraceBuffer() { delete[] m_slots; }
+
+    // Owner thread only
+    void append(const char *name, const char *category, qint64 timestampNs, char phase)
+    {
+        quint64 index = m_writeIndex.load(std::memory_order_relaxed);
+        Slot &slot = m_slots[index % CAPACITY];
+
+        // Odd while the slot is being written, 2 * (index + 1) once it holds event index
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.category.store(category, std::memory_order_relaxed);
+        slot.timestampNs.store(timestampNs, std::memory_order_relaxed);
+        slot.phase.store(phase, std::memory_order_relaxed);
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+
+        m_writeIndex.store(index + 1, std::memory_order_release);
+    }
+
+    // Any thread; events older than the ring's capacity, or overwritten while
+    // being copied, are dropped.
+    QList<TraceEvent> snapshot(int maxEvents = CAPACITY) const
+    {
+        quint64 end = m_writeIndex.load(std::memory_order_acquire);
+        quint64 begin = m_clearedIndex.load(std::memory_order_acquire);
+        quint64 count = std::min<quint64>(end - std::min(begin, end), quint64(std::min(maxEvents, CAPACITY)));
+        QList<TraceEvent> events;
+        events.reserve(int(count));
+        for (quint64 i = end - count; i < end; ++i) {
+            const Slot &slot = m_slots[i % CAPACITY];
+            quint64 sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence != 2 * i + 2) {
+                continue;
+            }
+            TraceEvent event = {slot.name.load(std::memory_order_relaxed),
+                                slot.category.load(std::memory_order_relaxed),
+                                slot.timestampNs.load(std::memory_order_relaxed),
+                                slot.phase.load(std::memory_order_relaxed)};
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+                continue;
+            }
+            events.append(event);
+        }
+        return events;
+    }
+
+    // Any thread. Hides everything recorded so far; the owner keeps writing
+    // from its own index, so this never races append().
+    void clear() { m_clearedIndex.store(m_writeIndex.load(std::memory_order_acquire), std::memory_order_release); }
+
+    int threadId() const { return m_threadId; }
+    QString threadName() const { return m_threadName; }
+    QThread *thread() const { return m_thread; }
+
+private:
+    struct Slot
+    {
+        std::atomic<quint64> sequence{0};
+        std::atomic<const char*> name{nullptr};
+        std::atomic<const char*> category{nullptr};
+        std::atomic<qint64> timestampNs{0};
+        std::atomic<char> phase{0};
+    };
+
+    int m_threadId;
+    QString m_threadName;
+    QThread *m_thread;  // Identity only; may dangle once the thread has finished
+    Slot *m_slots;
+    std::atomic<quint64> m_writeIndex;    // Written by the owner thread only
+    std::atomic<quint64> m_clearedIndex;  // Events before this are hidden
+};
+
+struct ThreadTraceEvent
+{
+    TraceEvent event;
+    int threadId;
+};
+
+class Tracer
+{
+public:
+    static Tracer &instance()
+    {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    // True while events are being recorded for any reason
+    bool isEnabled() const
+    {
+        return m_enabled.load(std::memory_order_relaxed) || m_background.load(std::memory_order_relaxed);
+    }
+
+    // True while an explicit capture (F4 / PYRPG_TRACE) is running
+    bool isCapturing() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    // Starting a capture discards previously buffered events
+    void setEnabled(bool enabled)
+    {
+        if (enabled && !isCapturing()) {
+            clear();
+        }
+        m_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void setBackgroundRecording(bool enabled) { m_background.store(enabled, std::memory_order_relaxed); }
+
+    // Same clock as event timestamps
+    qint64 nowNs() const { return m_clock.nsecsElapsed(); }
+
+    void record(const char *name, const char *category, char phase)
+    {
+        if (!isEnabled()) {
+            return;
+        }
+        threadBuffer()->append(name, category, m_clock.nsecsElapsed(), phase);
+    }
+
+    void begin(const char *name, const char *category = "scope") { record(name, category, 'B'); }
+    void end(const char *name, const char *category = "scope") { record(name, category, 'E'); }
+    void instant(const char *name, const char *category) { record(name, category, 'i'); }
+
+    void clear()
+    {
+        QMutexLocker locker(&m_mutex);
+        for (TraceBuffer *buffer : std::as_const(m_buffers)) {
+            buffer->clear();
+        }
+    }
+
+    // Most recent events across all threads, oldest first
+    QList<ThreadTraceEvent> recentEvents(int maxEventsPerThread) const
+    {
+        QList<ThreadTraceEvent> events;
+        QMutexLocker locker(&m_mutex);
+        for (const TraceBuffer *buffer : m_buffers) {
+            const QList<TraceEvent> threadEvents = buffer->snapshot(maxEventsPerThread);
+            for (const TraceEvent &event : threadEvents) {
+                events.append({event, buffer->threadId()});
+            }
+        }
+        std::sort(events.begin(), events.end(), [](const ThreadTraceEvent &a, const ThreadTraceEvent &b) {
+            return a.event.timestampNs < b.event.timestampNs;
+        });
+        return events;
+    }
+
+    // Most recent events recorded on one thread, oldest first
+    QList<TraceEvent> recentThreadEvents(QThread *thread, int maxEvents) const
+    {
+        QMutexLocker locker(&m_mutex);
+        for (const TraceBuffer *buffer : m_buffers) {
+            if (buffer->thread() == thread) {
+                return buffer->snapshot(maxEvents);
+            }
+        }
+        return {};
+    }
+
+    // Writes all buffered events in Chrome trace JSON format
+    bool writeChromeTrace(const QString &filePath) const
+    {
+        QFile file(filePath);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+            return false;
+        }
+
+        QTextStream out(&file);
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        bool first = true;
+        qint64 pid = QCoreApplication::applicationPid();
+
+        QMutexLocker locker(&m_mutex);
+        for (const TraceBuffer *buffer : m_buffers) {
+            // Thread name metadata so the viewer labels each track
+            if (!first) out << ",\n";
+            first = false;
+            out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+                << ",\"tid\":" << buffer->threadId()
+                << ",\"args\":{\"name\":\"" << escape(buffer->threadName()) << "\"}}";
+
+            const QList<TraceEvent> events = buffer->snapshot();
+            for (const TraceEvent &event : events) {
+                out << ",\n{\"name\":\"" << escape(QString::fromUtf8(event.name))
+                    << "\",\"cat\":\"" << escape(QString::fromUtf8(event.category))
+                    << "\",\"ph\":\"" << event.phase
+                    << "\",\"ts\":" << QString::number(event.timestampNs / 1000.0, 'f', 3)
+                    << ",\"pid\":" << pid
+                    << ",\"tid\":" << buffer->threadId();
+                if (event.phase == 'i') {
+                    out << ",\"s\":\"t\"";
+                }
+                out << "}";
+            }
+        }
+        out << "\n]}\n";
+        return out.status() == QTextStream::Ok;
+    }
+
+private:
+    Tracer() : m_enabled(false), m_background(false), m_nextThreadId(1) { m_clock.start(); }
+    Tracer(const Tracer &) = delete;
+    Tracer &operator=(const Tracer &) = delete;
+
+    TraceBuffer *threadBuffer()
+    {
+        // Buffers are owned by the tracer and outlive their threads so dumps stay valid
+        thread_local TraceBuffer *buffer = nullptr;
+        if (!buffer) {
+            QMutexLocker locker(&m_mutex);
+            QThread *thread = QThread::currentThread();
+            QString threadName = thread->objectName();
+            if (threadName.isEmpty()) {
+                QCoreApplication *app = QCoreApplication::instance();
+                threadName = (app && thread == app->thread()) ? QString("GUI") : QString("worker");
+            }
+            buffer = new TraceBuffer(m_nextThreadId++, threadName, thread);
+            m_buffers.append(buffer);
+        }
+        return buffer;
+    }
+
+    static QString escape(const QString &text)
+    {
+        QString escaped = text;
+        escaped.replace('\\', "\\\\").replace('"', "\\\"");
+        return escaped;
+    }
+
+    std::atomic<bool> m_enabled;
+    std::atomic<bool> m_background;
+    QElapsedTimer m_clock;
+    mutable QMutex m_mutex;
+    QList<TraceBuffer*> m_buffers;
+    int m_nextThreadId;
+};
+
+class ScopedTrace
+{
+public:
+    ScopedTrace(const char *name, const char *category) : m_name(name), m_category(category)
+    {
+        Tracer::instance().begin(m_name, m_category);
+    }
+    ~ScopedTrace() { Tracer::instance().end(m_name, m_category); }
+
+    ScopedTrace(const ScopedTrace &) = delete;
+    ScopedTrace &operator=(const ScopedTrace &) = delete;
+
+private:
+    const char *m_name;
+    const char *m_category;
+};
+
+#ifdef PYRPG_ENABLE_PROFILING
+#define PYRPG_TRACE_SCOPE(name, category) ScopedTrace PYRPG_TRACE_CONCAT(pyrpgTrace_, __LINE__)(name, category)
+#define PYRPG_TRACE_INSTANT(name, category) Tracer::instance().instant(name, category)
+#else
+#define PYRPG_TRACE_SCOPE(name, category) do {} while (0)
+#define PYRPG_TRACE_INSTANT(name, category) do {} while (0)
+#endif
+
+#define PYRPG_TRACE_CONCAT_INNER(a, b) a##b
+#define PYRPG_TRACE_CONCAT(a, b) PYRPG_TRACE_CONCAT_INNER(a, b)
+
+// Marks input and paint dispatch while a trace is being captured, so a trace
+// shows what happened between a click and the next repaint. Install on qApp.
+class TraceInputFilter : public QObject
+{
+public:
+    using QObject::QObject;
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override
+    {
+        switch (event->type()) {
+            case QEvent::MouseButtonPress:
+                PYRPG_TRACE_INSTANT("MouseButtonPress", "input");
+                break;
+            case QEvent::KeyPress:
+                PYRPG_TRACE_INSTANT("KeyPress", "input");
+                break;
+            case QEvent::Paint:
+                PYRPG_TRACE_INSTANT(watched->metaObject()->className(), "paint");
+                break;
+            default:
+                break;
+        }
+        return QObject::eventFilter(watched, event);
+    }
+};
+
+#endif // TRACER_H
@@ -1,6 +1,8 @@
 #include "CodexManager.h"
+#include "../diagnostics/Profiler.h"
 #include "factories/LoreFactory.h"
 #include <QDebug>
+#include <algorithm>
 
 CodexManager::CodexManager(Player* player, QObject* parent)
     : QObject(parent)
@@ -12,38 +14,75 @@ CodexManager::~CodexManager()
 {
     // Lore entries are managed by factory static cache, don't delete them here
     m_loreMap.clear();
+    m_entries.clear();
     m_categoryMap.clear();
+    m_triggers.clear();
 }
 
 void CodexManager::loadLoreEntries()
 {
-    QList<LoreEntry*> entries = LoreFactory::getAllLoreEntries();
-    for (LoreEntry* entry : entries) {
-        if (entry) {
-            m_loreMap[entry->entryId] = entry;
-            m_categoryMap[entry->category].append(entry);
-        }
+    PYRPG_PROFILE_SCOPE("CodexManager::loadLoreEntries");
+    // Starts over, so this also picks up a content reload
+    m_loreMap.clear();
+    m_entries.clear();
+    m_categoryMap.clear();
+    m_triggers.clear();
+    m_entries = LoreFactory::getAllLoreEntries();
+    m_entries.removeAll(nullptr);
+    std::sort(m_entries.begin(), m_entries.end(), [](const LoreEntry *a, const LoreEntry *b) {
+        return a->entryId < b->entryId;
+    });
+    for (LoreEntry* entry : m_entries) {
+        m_loreMap[ContentId(entry->entryId)] = entry;
+        m_categoryMap[entry->category].append(entry);
+        Trigger trigger = parseTrigger(entry->discoveryTrigger);
+        m_triggers[trigger.subject].append({trigger, entry});
     }
     qDebug() << "Loaded" << m_loreMap.size() << "lore entries";
 }
 
-void CodexManager::checkDiscoveryTriggers(const QString &triggerString)
+CodexManager::Trigger CodexManager::parseTrigger(const QString &triggerString)
+{
+    if (triggerString.startsWith("kill_")) {
+        int separator = triggerString.lastIndexOf('_');
+        bool ok = false;
+        int kills = triggerString.mid(separator + 1).toInt(&ok);
+        if (ok && separator > 5) {
+            return {Trigger::Kill, ContentId(triggerString.mid(5, separator - 5)), kills};
+        }
+    } else if (triggerString.startsWith("quest_complete_")) {
+        return {Trigger::QuestComplete, ContentId(triggerString.mid(15)), 0};
+    } else if (triggerString.startsWith("item_get_")) {
+        return {Trigger::ItemGet, ContentId(triggerString.mid(9)), 0};
+    }
+    return {Trigger::Other, ContentId(triggerString), 0};
+}
+
+void CodexManager::fireTrigger(const Trigger &trigger)
 {
-    for (LoreEntry* entry : m_loreMap.values()) {
-        if (entry->discoveryTrigger == triggerString) {
-            unlockEntry(entry->entryId);
+    const QList<TriggeredEntry> candidates = m_triggers.value(trigger.subject);
+    for (const TriggeredEntry &candidate : candidates) {
+        if (candidate.trigger.kind == trigger.kind && candidate.trigger.kills == trigger.kills) {
+            unlockEntry(ContentId(candidate.entry->entryId));
         }
     }
 }
 
-void CodexManager::unlockEntry(const QString &entryId)
+void CodexManager::checkDiscoveryTriggers(const QString &triggerString)
+{
+    PYRPG_PROFILE_SCOPE("CodexManager::checkDiscoveryTriggers");
+    fireTrigger(parseTrigger(triggerString));
+}
+
+void CodexManager::unlockEntry(ContentId entryId)
 {
     // Check if already unlocked
-    if (m_player->hasUnlockedLore(entryId)) {
+    QString id = entryId.toString();
+    if (m_player->hasUnlockedLore(id)) {
         return;
     }
 
-    m_player->unlockLore(entryId);
+    m_player->unlockLore(id);
 
     LoreEntry* entry = m_loreMap.value(entryId, nullptr);
     if (entry) {
@@ -51,7 +90,7 @@ void CodexManager::unlockEntry(const QString &entryId)
     }
 }
 
-LoreEntry* CodexManager::getEntry(const QString &entryId) const
+LoreEntry* CodexManager::getEntry(ContentId entryId) const
 {
     return m_loreMap.value(entryId, nullptr);
 }
@@ -74,26 +113,33 @@ QList<LoreEntry*> CodexManager::getAllEntriesInCategory(const QString &category)
     return m_categoryMap.value(category);
 }
 
-void CodexManager::onEnemyKilled(const QString &enemyName)
+QList<LoreEntry*> CodexManager::getAllEntries() const
 {
-    // Track kill counts per enemy
-    m_killCounts[enemyName]++;
+    return m_entries;
+}
 
-    int kills = m_killCounts[enemyName];
-    QString trigger = QString("kill_%1_%2").arg(enemyName).arg(kills);
+void CodexManager::onEnemyKilled(ContentId enemyName)
+{
+    PYRPG_PROFILE_SCOPE("CodexManager::onEnemyKilled");
+    // Track kill counts per enemy
+    int slot = int(enemyName.value());
+    if (slot >= m_killCounts.size()) {
+        m_killCounts.resize(ContentId::count());
+    }
+    int kills = ++m_killCounts[slot];
 
-    qDebug() << "Enemy killed:" << enemyName << "Count:" << kills << "Trigger:" << trigger;
-    checkDiscoveryTriggers(trigger);
+    qDebug() << "Enemy killed:" << enemyName << "Count:" << kills;
+    fireTrigger({Trigger::Kill, enemyName, kills});
 }
 
-void CodexManager::onQuestCompleted(const QString &questId)
+void CodexManager::onQuestCompleted(ContentId questId)
 {
-    QString trigger = QString("quest_complete_%1").arg(questId);
-    checkDiscoveryTriggers(trigger);
+    PYRPG_PROFILE_SCOPE("CodexManager::onQuestCompleted");
+    fireTrigger({Trigger::QuestComplete, questId, 0});
 }
 
-void CodexManager::onItemCollected(const QString &itemName)
+void CodexManager::onItemCollected(ContentId itemName)
 {
-    QString trigger = QString("item_get_%1").arg(itemName);
-    checkDiscoveryTriggers(trigger);
+    PYRPG_PROFILE_SCOPE("CodexManager::onItemCollected");
+    fireTrigger({Trigger::ItemGet, itemName, 0});
 }
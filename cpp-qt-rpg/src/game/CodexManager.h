@@ -3,10 +3,13 @@
 
 #include "models/LoreEntry.h"
 #include "models/Player.h"
+#include "ContentId.h"
 #include <QObject>
+#include <QHash>
 #include <QMap>
 #include <QList>
 #include <QString>
+#include <QVector>
 
 class CodexManager : public QObject
 {
@@ -19,24 +22,44 @@ public:
     // Lore management
     void loadLoreEntries();
     void checkDiscoveryTriggers(const QString &triggerString);
-    void unlockEntry(const QString &entryId);
-    LoreEntry* getEntry(const QString &entryId) const;
+    void unlockEntry(ContentId entryId);
+    LoreEntry* getEntry(ContentId entryId) const;
     QList<LoreEntry*> getUnlockedEntries(const QString &category) const;
     QList<LoreEntry*> getAllEntriesInCategory(const QString &category) const;
+    QList<LoreEntry*> getAllEntries() const;
 
     // Event handlers (connected to game signals)
-    void onEnemyKilled(const QString &enemyName);
-    void onQuestCompleted(const QString &questId);
-    void onItemCollected(const QString &itemName);
+    void onEnemyKilled(ContentId enemyName);
+    void onQuestCompleted(ContentId questId);
+    void onItemCollected(ContentId itemName);
 
 signals:
-    void loreUnlocked(const QString &entryId, const QString &title);
+    void loreUnlocked(ContentId entryId, const QString &title);
 
 private:
+    // A discoveryTrigger split up: "kill_<enemy>_<kills>", "quest_complete_<quest id>"
+    // and "item_get_<item>"; anything else ("manual") is matched whole
+    struct Trigger {
+        enum Kind { Kill, QuestComplete, ItemGet, Other };
+        Kind kind;
+        ContentId subject;
+        int kills;  // Kill only
+    };
+
+    struct TriggeredEntry {
+        Trigger trigger;
+        LoreEntry* entry;
+    };
+
+    static Trigger parseTrigger(const QString &triggerString);
+    void fireTrigger(const Trigger &trigger);
+
     Player* m_player;  // Reference, not owned
-    QMap<QString, LoreEntry*> m_loreMap;  // All lore, owned by factory
+    QHash<ContentId, LoreEntry*> m_loreMap;  // All lore, owned by factory
+    QList<LoreEntry*> m_entries;  // The same, by id
     QMap<QString, QList<LoreEntry*>> m_categoryMap;  // Entries by category
-    QMap<QString, int> m_killCounts;  // Track kill counts per enemy
+    QHash<ContentId, QList<TriggeredEntry>> m_triggers;  // By trigger subject
+    QVector<int> m_killCounts;  // Kills per enemy, indexed by ContentId::value()
 };
 
 #endif // CODEXMANAGER_H
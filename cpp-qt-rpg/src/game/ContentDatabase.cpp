@@ -0,0 +1,1178 @@
+#include "ContentDatabase.h"
+#include "../components/SpriteManifest.h"
+#include "../diagnostics/Profiler.h"
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSet>
+#include <QSettings>
+#include <QDebug>
+#include <cmath>
+#include <initializer_list>
+
+namespace {
+
+const char *RESOURCE_DIR = ":/content/";
+const char *SETTINGS_KEY = "content/overrideDir";
+
+const char *ITEMS_FILE = "items.json";
+const char *SKILLS_FILE = "skills.json";
+const char *MONSTERS_FILE = "monsters.json";
+const char *QUESTS_FILE = "quests.json";
+const char *DIALOGUES_FILE = "dialogues.json";
+const char *STORY_EVENTS_FILE = "story_events.json";
+const char *LORE_FILE = "lore.json";
+
+// Values the game code branches on
+const QStringList ITEM_TYPES = {"consumable", "weapon", "armor", "accessory"};
+const QStringList CONSUMABLE_EFFECTS = {"heal", "restore_mana"};
+const QStringList EQUIPMENT_TYPES = {"weapon", "armor", "accessory"};
+const QStringList SKILL_TYPES = {"physical", "magic", "buff"};
+const QStringList QUEST_STATUSES = {"locked", "available", "active", "completed", "rewarded"};
+const QStringList OBJECTIVE_TYPES = {"kill_enemies", "reach_level", "collect_item", "defeat_boss"};
+const QStringList EFFECT_TYPES = {"AdvanceQuest", "GiveItem", "GiveGold", "GiveXP", "UnlockQuest"};
+const QStringList TRIGGER_TYPES = {"manual", "quest_start", "quest_complete", "level_reached"};
+
+enum class FieldType { String, Text, Int, Number, Bool, StringList, Array, Object, Stat };
+
+struct Field {
+    const char *name;
+    FieldType type;
+    bool required;
+};
+
+QString typeName(FieldType type)
+{
+    switch (type) {
+        case FieldType::String: return "a string";
+        case FieldType::Text: return "a string or an array of lines";
+        case FieldType::Int: return "an integer";
+        case FieldType::Number: return "a number";
+        case FieldType::Bool: return "true or false";
+        case FieldType::StringList: return "an array of strings";
+        case FieldType::Array: return "an array";
+        case FieldType::Object: return "an object";
+        case FieldType::Stat: return "a {\"base\", \"perLevel\"} object";
+    }
+    return QString();
+}
+
+bool isInt(const QJsonValue &value)
+{
+    if (!value.isDouble()) {
+        return false;
+    }
+    double number = value.toDouble();
+    return number == std::floor(number) && std::abs(number) <= 1e9;
+}
+
+bool isStringArray(const QJsonValue &value)
+{
+    if (!value.isArray()) {
+        return false;
+    }
+    for (const QJsonValue &element : value.toArray()) {
+        if (!element.isString()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool isStat(const QJsonValue &value)
+{
+    if (!value.isObject()) {
+        return false;
+    }
+    QJsonObject object = value.toObject();
+    if (object.isEmpty()) {
+        return false;
+    }
+    for (auto it = object.begin(); it != object.end(); ++it) {
+        if ((it.key() != "base" && it.key() != "perLevel") || !isInt(it.value())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool hasType(const QJsonValue &value, FieldType type)
+{
+    switch (type) {
+        case FieldType::String: return value.isString();
+        case FieldType::Text: return value.isString() || isStringArray(value);
+        case FieldType::Int: return isInt(value);
+        case FieldType::Number: return value.isDouble();
+        case FieldType::Bool: return value.isBool();
+        case FieldType::StringList: return isStringArray(value);
+        case FieldType::Array: return value.isArray();
+        case FieldType::Object: return value.isObject();
+        case FieldType::Stat: return isStat(value);
+    }
+    return false;
+}
+
+// Reads one content file and reports its problems as "<path>: <where>: <what>"
+class FileReader
+{
+public:
+    FileReader(const QString &fileName, const QString &overrideDirectory, QStringList *errors)
+        : m_errors(errors)
+        , m_errorCount(0)
+    {
+        m_path = RESOURCE_DIR + fileName;
+        if (!overrideDirectory.isEmpty()) {
+            QString candidate = QDir(overrideDirectory).filePath(fileName);
+            if (QFileInfo::exists(candidate)) {
+                m_path = candidate;
+            }
+        }
+    }
+
+    QString path() const { return m_path; }
+    bool ok() const { return m_errorCount == 0; }
+
+    bool read(QJsonObject *root)
+    {
+        QFile file(m_path);
+        if (!file.open(QIODevice::ReadOnly)) {
+            error(QString(), "cannot open: " + file.errorString());
+            return false;
+        }
+        QJsonParseError parseError;
+        QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &parseError);
+        if (parseError.error != QJsonParseError::NoError) {
+            error(QString(), QString("%1 at offset %2").arg(parseError.errorString()).arg(parseError.offset));
+            return false;
+        }
+        if (!document.isObject()) {
+            error(QString(), "expected a JSON object at the top level");
+            return false;
+        }
+        *root = document.object();
+        return true;
+    }
+
+    void error(const QString &where, const QString &message)
+    {
+        ++m_errorCount;
+        m_errors->append(where.isEmpty() ? QString("%1: %2").arg(m_path, message)
+                                         : QString("%1: %2: %3").arg(m_path, where, message));
+    }
+
+    // Required fields are present, every field has its type and there are no
+    // others, which catches misspelt optional fields that would otherwise be
+    // silently ignored.
+    bool check(const QJsonObject &object, const QString &where, std::initializer_list<Field> fields)
+    {
+        int before = m_errorCount;
+        QSet<QString> known;
+        for (const Field &field : fields) {
+            known.insert(field.name);
+            auto it = object.constFind(field.name);
+            if (it == object.constEnd()) {
+                if (field.required) {
+                    error(where, QString("missing \"%1\"").arg(field.name));
+                }
+            } else if (!hasType(it.value(), field.type)) {
+                error(where, QString("\"%1\" must be %2").arg(QString::fromLatin1(field.name), typeName(field.type)));
+            }
+        }
+        for (auto it = object.begin(); it != object.end(); ++it) {
+            if (!known.contains(it.key())) {
+                error(where, QString("unknown field \"%1\"").arg(it.key()));
+            }
+        }
+        return m_errorCount == before;
+    }
+
+    // Elements of an array field that are objects; others are reported
+    QList<QJsonObject> objects(const QJsonObject &object, const QString &key, const QString &where)
+    {
+        QList<QJsonObject> result;
+        const QJsonArray array = object.value(key).toArray();
+        for (int i = 0; i < array.size(); ++i) {
+            if (array.at(i).isObject()) {
+                result.append(array.at(i).toObject());
+            } else {
+                error(where, QString("\"%1\"[%2] must be an object").arg(key).arg(i));
+                result.append(QJsonObject());
+            }
+        }
+        return result;
+    }
+
+    void checkOneOf(const QString &where, const QString &field, const QString &value, const QStringList &allowed)
+    {
+        if (!allowed.contains(value)) {
+            error(where, QString("\"%1\" is \"%2\"; expected one of %3").arg(field, value, allowed.join(", ")));
+        }
+    }
+
+private:
+    QString m_path;
+    QStringList *m_errors;
+    int m_errorCount;
+};
+
+QString text(const QJsonObject &object, const QString &key)
+{
+    QJsonValue value = object.value(key);
+    if (value.isArray()) {
+        QStringList lines;
+        for (const QJsonValue &line : value.toArray()) {
+            lines.append(line.toString());
+        }
+        return lines.join('\n');
+    }
+    return value.toString();
+}
+
+QStringList strings(const QJsonObject &object, const QString &key)
+{
+    QStringList result;
+    for (const QJsonValue &value : object.value(key).toArray()) {
+        result.append(value.toString());
+    }
+    return result;
+}
+
+ContentDatabase::StatFormula stat(const QJsonObject &object, const QString &key)
+{
+    ContentDatabase::StatFormula formula;
+    if (object.contains(key)) {
+        QJsonObject value = object.value(key).toObject();
+        formula.isSet = true;
+        formula.base = value.value("base").toInt();
+        formula.perLevel = value.value("perLevel").toInt();
+    }
+    return formula;
+}
+
+void checkUnique(FileReader &reader, QSet<QString> &seen, const QString &where, const QString &id)
+{
+    if (id.isEmpty()) {
+        reader.error(where, "id must not be empty");
+    } else if (seen.contains(id)) {
+        reader.error(where, "duplicate id");
+    }
+    seen.insert(id);
+}
+
+QString describe(const char *kind, int index, const QString &id)
+{
+    return id.isEmpty() ? QString("%1 #%2").arg(kind).arg(index + 1)
+                        : QString("%1 \"%2\"").arg(QString::fromLatin1(kind), id);
+}
+
+void parseItems(FileReader &reader, const QJsonObject &root, QList<Item> *items,
+                QStringList *shop, ContentDatabase::LootTable *loot)
+{
+    if (!reader.check(root, QString(), {{"items", FieldType::Array, true},
+                                        {"shop", FieldType::StringList, true},
+                                        {"loot", FieldType::Object, true}})) {
+        return;
+    }
+
+    QSet<QString> names;
+    const QList<QJsonObject> itemObjects = reader.objects(root, "items", QString());
+    for (int i = 0; i < itemObjects.size(); ++i) {
+        const QJsonObject &object = itemObjects.at(i);
+        QString where = describe("item", i, object.value("name").toString());
+        if (!reader.check(object, where, {{"name", FieldType::String, true},
+                                          {"type", FieldType::String, true},
+                                          {"rarity", FieldType::String, true},
+                                          {"slot", FieldType::String, false},
+                                          {"attackBonus", FieldType::Int, false},
+                                          {"defenseBonus", FieldType::Int, false},
+                                          {"effect", FieldType::String, false},
+                                          {"power", FieldType::Int, false},
+                                          {"value", FieldType::Int, true},
+                                          {"description", FieldType::String, false},
+                                          {"loreId", FieldType::String, false}})) {
+            continue;
+        }
+        Item item(object.value("name").toString(), object.value("type").toString(),
+                  object.value("rarity").toString(), object.value("slot").toString(),
+                  object.value("attackBonus").toInt(), object.value("defenseBonus").toInt(),
+                  object.value("effect").toString(), object.value("power").toInt(),
+                  object.value("value").toInt(), object.value("description").toString(),
+                  object.value("loreId").toString());
+        checkUnique(reader, names, where, item.name);
+        reader.checkOneOf(where, "type", item.itemType, ITEM_TYPES);
+        if (item.itemType == "consumable") {
+            reader.checkOneOf(where, "effect", item.effect, CONSUMABLE_EFFECTS);
+        } else if (item.slot != item.itemType) {
+            reader.error(where, QString("equipment \"slot\" must be \"%1\"").arg(item.itemType));
+        }
+        items->append(item);
+    }
+
+    *shop = strings(root, "shop");
+
+    QJsonObject lootObject = root.value("loot").toObject();
+    if (!reader.check(lootObject, "loot", {{"consumableChance", FieldType::Int, true},
+                                           {"consumables", FieldType::StringList, true},
+                                           {"rarities", FieldType::Array, true},
+                                           {"valuePerLevel", FieldType::Int, true},
+                                           {"equipment", FieldType::Array, true},
+                                           {"loreRarities", FieldType::StringList, false}})) {
+        return;
+    }
+    loot->consumableChance = lootObject.value("consumableChance").toInt();
+    loot->consumables = strings(lootObject, "consumables");
+    loot->valuePerLevel = lootObject.value("valuePerLevel").toInt();
+    loot->loreRarities = strings(lootObject, "loreRarities");
+    if (loot->consumableChance < 0 || loot->consumableChance > 100) {
+        reader.error("loot", "\"consumableChance\" must be a percentage");
+    }
+    if (loot->consumableChance > 0 && loot->consumables.isEmpty()) {
+        reader.error("loot", "\"consumables\" is empty");
+    }
+
+    int totalWeight = 0;
+    for (const QJsonObject &object : reader.objects(lootObject, "rarities", "loot")) {
+        if (!reader.check(object, "loot rarity", {{"name", FieldType::String, true},
+                                                  {"weight", FieldType::Int, true},
+                                                  {"multiplier", FieldType::Number, true}})) {
+            continue;
+        }
+        ContentDatabase::LootRarity rarity;
+        rarity.name = object.value("name").toString();
+        rarity.weight = object.value("weight").toInt();
+        rarity.multiplier = object.value("multiplier").toDouble();
+        if (rarity.weight < 0) {
+            reader.error(QString("loot rarity \"%1\"").arg(rarity.name), "\"weight\" must not be negative");
+        }
+        totalWeight += qMax(0, rarity.weight);
+        loot->rarities.append(rarity);
+    }
+    if (totalWeight <= 0) {
+        reader.error("loot", "rarity weights must add up to more than 0");
+    }
+
+    for (const QJsonObject &object : reader.objects(lootObject, "equipment", "loot")) {
+        QString where = QString("loot equipment \"%1\"").arg(object.value("type").toString());
+        if (!reader.check(object, where, {{"type", FieldType::String, true},
+                                          {"names", FieldType::StringList, true},
+                                          {"attackBonus", FieldType::Stat, false},
+                                          {"defenseBonus", FieldType::Stat, false},
+                                          {"description", FieldType::String, true}})) {
+            continue;
+        }
+        ContentDatabase::LootEquipment equipment;
+        equipment.type = object.value("type").toString();
+        equipment.names = strings(object, "names");
+        equipment.attackBonus = stat(object, "attackBonus");
+        equipment.defenseBonus = stat(object, "defenseBonus");
+        equipment.description = object.value("description").toString();
+        reader.checkOneOf(where, "type", equipment.type, EQUIPMENT_TYPES);
+        if (equipment.names.isEmpty()) {
+            reader.error(where, "\"names\" is empty");
+        }
+        loot->equipment.append(equipment);
+    }
+    if (loot->consumableChance < 100 && loot->equipment.isEmpty()) {
+        reader.error("loot", "\"equipment\" is empty");
+    }
+}
+
+bool parseClassSkills(FileReader &reader, const QJsonObject &object, const QString &where,
+                      bool named, ContentDatabase::ClassSkills *classSkills)
+{
+    bool ok = named ? reader.check(object, where, {{"name", FieldType::String, true},
+                                                   {"skills", FieldType::StringList, true},
+                                                   {"startingSkills", FieldType::StringList, true}})
+                    : reader.check(object, where, {{"skills", FieldType::StringList, true},
+                                                   {"startingSkills", FieldType::StringList, true}});
+    if (!ok) {
+        return false;
+    }
+    classSkills->className = object.value("name").toString();
+    classSkills->skills = strings(object, "skills");
+    classSkills->startingSkills = strings(object, "startingSkills");
+    for (const QString &starting : classSkills->startingSkills) {
+        if (!classSkills->skills.contains(starting)) {
+            reader.error(where, QString("starting skill \"%1\" is not in \"skills\"").arg(starting));
+        }
+    }
+    return true;
+}
+
+void parseSkills(FileReader &reader, const QJsonObject &root, QList<Skill> *skills,
+                 QList<ContentDatabase::ClassSkills> *classes, ContentDatabase::ClassSkills *defaultClass)
+{
+    if (!reader.check(root, QString(), {{"skills", FieldType::Array, true},
+                                        {"classes", FieldType::Array, true},
+                                        {"defaultClass", FieldType::Object, true}})) {
+        return;
+    }
+
+    QSet<QString> names;
+    const QList<QJsonObject> skillObjects = reader.objects(root, "skills", QString());
+    for (int i = 0; i < skillObjects.size(); ++i) {
+        const QJsonObject &object = skillObjects.at(i);
+        QString where = describe("skill", i, object.value("name").toString());
+        if (!reader.check(object, where, {{"name", FieldType::String, true},
+                                          {"type", FieldType::String, true},
+                                          {"damage", FieldType::Int, false},
+                                          {"manaCost", FieldType::Int, true},
+                                          {"description", FieldType::String, false}})) {
+            continue;
+        }
+        Skill skill(object.value("name").toString(), object.value("type").toString(),
+                    object.value("damage").toInt(), object.value("manaCost").toInt(),
+                    object.value("description").toString());
+        checkUnique(reader, names, where, skill.name);
+        reader.checkOneOf(where, "type", skill.skillType, SKILL_TYPES);
+        skills->append(skill);
+    }
+
+    QSet<QString> classNames;
+    const QList<QJsonObject> classObjects = reader.objects(root, "classes", QString());
+    for (int i = 0; i < classObjects.size(); ++i) {
+        QString where = describe("class", i, classObjects.at(i).value("name").toString());
+        ContentDatabase::ClassSkills classSkills;
+        if (parseClassSkills(reader, classObjects.at(i), where, true, &classSkills)) {
+            checkUnique(reader, classNames, where, classSkills.className.toLower());
+            classes->append(classSkills);
+        }
+    }
+    parseClassSkills(reader, root.value("defaultClass").toObject(), "defaultClass", false, defaultClass);
+}
+
+bool parseMonster(FileReader &reader, const QJsonObject &object, const QString &where,
+                  ContentDatabase::MonsterTemplate *monster)
+{
+    if (!reader.check(object, where, {{"id", FieldType::String, true},
+                                      {"name", FieldType::String, true},
+                                      {"spriteType", FieldType::String, true},
+                                      {"aliases", FieldType::StringList, false},
+                                      {"health", FieldType::Stat, false},
+                                      {"attack", FieldType::Stat, false},
+                                      {"defense", FieldType::Stat, false},
+                                      {"magicAttack", FieldType::Stat, false},
+                                      {"experience", FieldType::Stat, false},
+                                      {"gold", FieldType::Stat, false}})) {
+        return false;
+    }
+    monster->id = object.value("id").toString();
+    monster->name = object.value("name").toString();
+    monster->spriteType = object.value("spriteType").toString();
+    monster->aliases = strings(object, "aliases");
+    monster->health = stat(object, "health");
+    monster->attack = stat(object, "attack");
+    monster->defense = stat(object, "defense");
+    monster->magicAttack = stat(object, "magicAttack");
+    monster->experience = stat(object, "experience");
+    monster->gold = stat(object, "gold");
+    if (monster->spriteType.isEmpty()) {
+        reader.error(where, "\"spriteType\" must not be empty");
+    }
+    return true;
+}
+
+void parseMonsters(FileReader &reader, const QJsonObject &root, int *levelVariance,
+                   QList<ContentDatabase::MonsterTemplate> *monsters,
+                   QList<ContentDatabase::EncounterTier> *encounters, int *bossLevelOffset,
+                   QString *defaultBoss, QList<ContentDatabase::MonsterTemplate> *bosses,
+                   QString *finalBossName, QStringList *finalBossAliases)
+{
+    if (!reader.check(root, QString(), {{"levelVariance", FieldType::Int, true},
+                                        {"monsters", FieldType::Array, true},
+                                        {"encounters", FieldType::Array, true},
+                                        {"bossLevelOffset", FieldType::Int, true},
+                                        {"defaultBoss", FieldType::String, true},
+                                        {"bosses", FieldType::Array, true},
+                                        {"finalBoss", FieldType::Object, true}})) {
+        return;
+    }
+    *levelVariance = root.value("levelVariance").toInt();
+    *bossLevelOffset = root.value("bossLevelOffset").toInt();
+    *defaultBoss = root.value("defaultBoss").toString();
+    if (*levelVariance < 0) {
+        reader.error(QString(), "\"levelVariance\" must not be negative");
+    }
+
+    // Names are shared between monsters and bosses so a quest target means one thing
+    QSet<QString> ids;
+    QHash<QString, QString> owners;
+    auto addNames = [&reader, &owners](const ContentDatabase::MonsterTemplate &monster, const QString &where) {
+        for (const QString &name : QStringList{monster.id, monster.name} + monster.aliases) {
+            QString owner = owners.value(name);
+            if (!owner.isEmpty() && owner != monster.id) {
+                reader.error(where, QString("name \"%1\" is already used by \"%2\"").arg(name, owner));
+            }
+            owners.insert(name, monster.id);
+        }
+    };
+
+    const QList<QJsonObject> monsterObjects = reader.objects(root, "monsters", QString());
+    for (int i = 0; i < monsterObjects.size(); ++i) {
+        QString where = describe("monster", i, monsterObjects.at(i).value("id").toString());
+        ContentDatabase::MonsterTemplate monster;
+        if (parseMonster(reader, monsterObjects.at(i), where, &monster)) {
+            checkUnique(reader, ids, where, monster.id);
+            addNames(monster, where);
+            monsters->append(monster);
+        }
+    }
+    const QList<QJsonObject> bossObjects = reader.objects(root, "bosses", QString());
+    for (int i = 0; i < bossObjects.size(); ++i) {
+        QString where = describe("boss", i, bossObjects.at(i).value("id").toString());
+        ContentDatabase::MonsterTemplate boss;
+        if (parseMonster(reader, bossObjects.at(i), where, &boss)) {
+            checkUnique(reader, ids, where, boss.id);
+            addNames(boss, where);
+            bosses->append(boss);
+        }
+    }
+
+    int totalWeight = 0;
+    const QList<QJsonObject> tierObjects = reader.objects(root, "encounters", QString());
+    for (int i = 0; i < tierObjects.size(); ++i) {
+        QString where = QString("encounter tier #%1").arg(i + 1);
+        if (!reader.check(tierObjects.at(i), where, {{"weight", FieldType::Int, true},
+                                                     {"monsters", FieldType::StringList, true}})) {
+            continue;
+        }
+        ContentDatabase::EncounterTier tier;
+        tier.weight = tierObjects.at(i).value("weight").toInt();
+        tier.monsterIds = strings(tierObjects.at(i), "monsters");
+        if (tier.weight < 0) {
+            reader.error(where, "\"weight\" must not be negative");
+        }
+        if (tier.monsterIds.isEmpty()) {
+            reader.error(where, "\"monsters\" is empty");
+        }
+        for (const QString &id : tier.monsterIds) {
+            bool found = false;
+            for (const ContentDatabase::MonsterTemplate &monster : *monsters) {
+                found = found || monster.id == id;
+            }
+            if (!found) {
+                reader.error(where, QString("\"%1\" is not a monster id").arg(id));
+            }
+        }
+        totalWeight += qMax(0, tier.weight);
+        encounters->append(tier);
+    }
+    if (totalWeight <= 0) {
+        reader.error(QString(), "encounter weights must add up to more than 0");
+    }
+
+    bool defaultFound = false;
+    for (const ContentDatabase::MonsterTemplate &boss : *bosses) {
+        defaultFound = defaultFound || boss.id == *defaultBoss;
+    }
+    if (!defaultFound) {
+        reader.error(QString(), QString("\"defaultBoss\" \"%1\" is not a boss id").arg(*defaultBoss));
+    }
+
+    QJsonObject finalBoss = root.value("finalBoss").toObject();
+    if (reader.check(finalBoss, "finalBoss", {{"name", FieldType::String, true},
+                                              {"aliases", FieldType::StringList, false}})) {
+        *finalBossName = finalBoss.value("name").toString();
+        *finalBossAliases = strings(finalBoss, "aliases");
+    }
+}
+
+void parseQuests(FileReader &reader, const QJsonObject &root, QList<Quest> *quests)
+{
+    if (!reader.check(root, QString(), {{"quests", FieldType::Array, true}})) {
+        return;
+    }
+
+    QSet<QString> ids;
+    const QList<QJsonObject> questObjects = reader.objects(root, "quests", QString());
+    for (int i = 0; i < questObjects.size(); ++i) {
+        const QJsonObject &object = questObjects.at(i);
+        QString where = describe("quest", i, object.value("id").toString());
+        if (!reader.check(object, where, {{"id", FieldType::String, true},
+                                          {"title", FieldType::String, true},
+                                          {"description", FieldType::String, false},
+                                          {"longDescription", FieldType::Text, false},
+                                          {"status", FieldType::String, true},
+                                          {"minimumLevel", FieldType::Int, false},
+                                          {"orderIndex", FieldType::Int, false},
+                                          {"prerequisites", FieldType::StringList, false},
+                                          {"objectives", FieldType::Array, true},
+                                          {"rewards", FieldType::Object, false}})) {
+            continue;
+        }
+        Quest quest(object.value("id").toString(), object.value("title").toString(),
+                    object.value("description").toString(), object.value("status").toString(),
+                    object.value("minimumLevel").toInt(1));
+        quest.longDescription = text(object, "longDescription");
+        quest.orderIndex = object.value("orderIndex").toInt(i + 1);
+        quest.prerequisiteQuestIds = strings(object, "prerequisites");
+        checkUnique(reader, ids, where, quest.questId);
+        reader.checkOneOf(where, "status", quest.status, QUEST_STATUSES);
+
+        for (const QJsonObject &objectiveObject : reader.objects(object, "objectives", where)) {
+            if (!reader.check(objectiveObject, where + " objective", {{"type", FieldType::String, true},
+                                                                      {"description", FieldType::String, true},
+                                                                      {"targetId", FieldType::String, false},
+                                                                      {"required", FieldType::Int, true}})) {
+                continue;
+            }
+            QuestObjective objective;
+            objective.type = objectiveObject.value("type").toString();
+            objective.description = objectiveObject.value("description").toString();
+            objective.targetId = objectiveObject.value("targetId").toString();
+            objective.required = objectiveObject.value("required").toInt();
+            reader.checkOneOf(where, "objective type", objective.type, OBJECTIVE_TYPES);
+            if (objective.type != "reach_level" && objective.targetId.isEmpty()) {
+                reader.error(where, QString("%1 objective needs a \"targetId\"").arg(objective.type));
+            }
+            if (objective.required <= 0) {
+                reader.error(where, "objective \"required\" must be at least 1");
+            }
+            quest.objectives.append(objective);
+        }
+        if (quest.objectives.isEmpty()) {
+            reader.error(where, "a quest needs at least one objective");
+        }
+
+        QJsonObject rewards = object.value("rewards").toObject();
+        if (reader.check(rewards, where + " rewards", {{"experience", FieldType::Int, false},
+                                                       {"gold", FieldType::Int, false},
+                                                       {"items", FieldType::StringList, false}})) {
+            quest.rewards.experience = rewards.value("experience").toInt();
+            quest.rewards.gold = rewards.value("gold").toInt();
+            quest.rewards.itemNames = strings(rewards, "items");
+        }
+        quests->append(quest);
+    }
+}
+
+void parseDialogues(FileReader &reader, const QJsonObject &root, QList<DialogueTree> *dialogues)
+{
+    if (!reader.check(root, QString(), {{"dialogues", FieldType::Array, true}})) {
+        return;
+    }
+
+    QSet<QString> ids;
+    const QList<QJsonObject> treeObjects = reader.objects(root, "dialogues", QString());
+    for (int i = 0; i < treeObjects.size(); ++i) {
+        const QJsonObject &object = treeObjects.at(i);
+        QString where = describe("dialogue", i, object.value("id").toString());
+        if (!reader.check(object, where, {{"id", FieldType::String, true},
+                                          {"npcName", FieldType::String, true},
+                                          {"startNodeId", FieldType::String, true},
+                                          {"nodes", FieldType::Array, true}})) {
+            continue;
+        }
+        DialogueTree tree;
+        tree.id = object.value("id").toString();
+        tree.npcName = object.value("npcName").toString();
+        tree.startNodeId = object.value("startNodeId").toString();
+        checkUnique(reader, ids, where, tree.id);
+
+        for (const QJsonObject &nodeObject : reader.objects(object, "nodes", where)) {
+            QString nodeWhere = QString("%1 node \"%2\"").arg(where, nodeObject.value("id").toString());
+            if (!reader.check(nodeObject, nodeWhere, {{"id", FieldType::String, true},
+                                                      {"speaker", FieldType::String, true},
+                                                      {"text", FieldType::Text, true},
+                                                      {"choices", FieldType::Array, false},
+                                                      {"autoNextNodeId", FieldType::String, false},
+                                                      {"endsDialogue", FieldType::Bool, false}})) {
+                continue;
+            }
+            DialogueNode node;
+            node.id = nodeObject.value("id").toString();
+            node.speaker = nodeObject.value("speaker").toString();
+            node.text = text(nodeObject, "text");
+            node.autoNextNodeId = nodeObject.value("autoNextNodeId").toString();
+            node.endsDialogue = nodeObject.value("endsDialogue").toBool();
+            if (node.id.isEmpty() || tree.nodes.contains(node.id)) {
+                reader.error(nodeWhere, "node ids must be unique and not empty");
+            }
+
+            for (const QJsonObject &choiceObject : reader.objects(nodeObject, "choices", nodeWhere)) {
+                if (!reader.check(choiceObject, nodeWhere + " choice", {{"text", FieldType::String, true},
+                                                                        {"targetNodeId", FieldType::String, false},
+                                                                        {"requiresLevel", FieldType::Bool, false},
+                                                                        {"requiredLevel", FieldType::Int, false},
+                                                                        {"effects", FieldType::Array, false}})) {
+                    continue;
+                }
+                DialogueChoice choice;
+                choice.text = choiceObject.value("text").toString();
+                choice.targetNodeId = choiceObject.value("targetNodeId").toString();
+                choice.requiresLevel = choiceObject.value("requiresLevel").toBool();
+                choice.requiredLevel = choiceObject.value("requiredLevel").toInt();
+
+                for (const QJsonObject &effectObject : reader.objects(choiceObject, "effects", nodeWhere)) {
+                    if (!reader.check(effectObject, nodeWhere + " effect", {{"type", FieldType::String, true},
+                                                                            {"target", FieldType::String, false},
+                                                                            {"value", FieldType::Int, false}})) {
+                        continue;
+                    }
+                    DialogueEffect effect;
+                    effect.type = effectObject.value("type").toString();
+                    effect.target = effectObject.value("target").toString();
+                    effect.value = effectObject.value("value").toInt();
+                    reader.checkOneOf(nodeWhere, "effect type", effect.type, EFFECT_TYPES);
+                    choice.effects.append(effect);
+                }
+                node.choices.append(choice);
+            }
+            tree.nodes.insert(node.id, node);
+        }
+        dialogues->append(tree);
+    }
+}
+
+void parseStoryEvents(FileReader &reader, const QJsonObject &root, QList<StoryEvent> *events)
+{
+    if (!reader.check(root, QString(), {{"storyEvents", FieldType::Array, true}})) {
+        return;
+    }
+
+    QSet<QString> ids;
+    const QList<QJsonObject> eventObjects = reader.objects(root, "storyEvents", QString());
+    for (int i = 0; i < eventObjects.size(); ++i) {
+        const QJsonObject &object = eventObjects.at(i);
+        QString where = describe("story event", i, object.value("id").toString());
+        if (!reader.check(object, where, {{"id", FieldType::String, true},
+                                          {"title", FieldType::String, true},
+                                          {"text", FieldType::Text, true},
+                                          {"triggerType", FieldType::String, true},
+                                          {"triggerId", FieldType::String, false},
+                                          {"imagePaths", FieldType::StringList, false},
+                                          {"prerequisites", FieldType::StringList, false}})) {
+            continue;
+        }
+        StoryEvent event;
+        event.eventId = object.value("id").toString();
+        event.title = object.value("title").toString();
+        event.eventText = text(object, "text");
+        event.triggerType = object.value("triggerType").toString();
+        event.triggerId = object.value("triggerId").toString();
+        event.imagePaths = strings(object, "imagePaths");
+        event.prerequisites = strings(object, "prerequisites");
+        checkUnique(reader, ids, where, event.eventId);
+        reader.checkOneOf(where, "triggerType", event.triggerType, TRIGGER_TYPES);
+        if (event.triggerType == "level_reached") {
+            bool ok = false;
+            event.triggerId.toInt(&ok);
+            if (!ok) {
+                reader.error(where, "level_reached needs a level number as \"triggerId\"");
+            }
+        }
+        events->append(event);
+    }
+}
+
+void parseLore(FileReader &reader, const QJsonObject &root, QList<LoreEntry> *lore)
+{
+    if (!reader.check(root, QString(), {{"lore", FieldType::Array, true}})) {
+        return;
+    }
+
+    QSet<QString> ids;
+    const QList<QJsonObject> entryObjects = reader.objects(root, "lore", QString());
+    for (int i = 0; i < entryObjects.size(); ++i) {
+        const QJsonObject &object = entryObjects.at(i);
+        QString where = describe("lore entry", i, object.value("id").toString());
+        if (!reader.check(object, where, {{"id", FieldType::String, true},
+                                          {"category", FieldType::String, true},
+                                          {"title", FieldType::String, true},
+                                          {"shortDescription", FieldType::String, false},
+                                          {"fullText", FieldType::Text, true},
+                                          {"imagePath", FieldType::String, false},
+                                          {"discoveryTrigger", FieldType::String, false}})) {
+            continue;
+        }
+        LoreEntry entry;
+        entry.entryId = object.value("id").toString();
+        entry.category = object.value("category").toString();
+        entry.title = object.value("title").toString();
+        entry.shortDescription = object.value("shortDescription").toString();
+        entry.fullText = text(object, "fullText");
+        entry.imagePath = object.value("imagePath").toString();
+        entry.discoveryTrigger = object.value("discoveryTrigger").toString();
+        checkUnique(reader, ids, where, entry.entryId);
+        lore->append(entry);
+    }
+}
+
+} // namespace
+
+bool ContentDatabase::MonsterTemplate::answersTo(const QString &name) const
+{
+    return name == id || name == this->name || aliases.contains(name);
+}
+
+ContentDatabase &ContentDatabase::instance()
+{
+    static ContentDatabase database;
+    return database;
+}
+
+ContentDatabase::ContentDatabase()
+    : m_overrideDirectory(configuredOverrideDirectory())
+    , m_revision(0)
+{
+    PYRPG_PROFILE_SCOPE("ContentDatabase::load");
+
+    Content content;
+    if (!load(m_overrideDirectory, &content, &m_lastErrors, &m_lastWarnings)) {
+        for (const QString &error : m_lastErrors) {
+            qWarning().noquote() << "Content error:" << error;
+        }
+        if (m_overrideDirectory.isEmpty()) {
+            // Bundled content is checked by the tests; nothing sensible to fall back to
+            qWarning() << "Bundled content failed validation; game content is missing";
+            return;
+        }
+        qWarning() << "Ignoring content overrides in" << m_overrideDirectory;
+        content = Content();
+        m_lastErrors.clear();
+        m_lastWarnings.clear();
+        if (!load(QString(), &content, &m_lastErrors, &m_lastWarnings)) {
+            return;
+        }
+    }
+    for (const QString &warning : m_lastWarnings) {
+        qWarning().noquote() << "Content warning:" << warning;
+    }
+    apply(content);
+}
+
+QStringList ContentDatabase::fileNames()
+{
+    return {ITEMS_FILE, SKILLS_FILE, MONSTERS_FILE, QUESTS_FILE, DIALOGUES_FILE, STORY_EVENTS_FILE, LORE_FILE};
+}
+
+QString ContentDatabase::configuredOverrideDirectory()
+{
+    QSettings settings;
+    QString directory = settings.value(SETTINGS_KEY).toString();
+    if (qEnvironmentVariableIsSet("PYRPG_CONTENT_DIR")) {
+        directory = qEnvironmentVariable("PYRPG_CONTENT_DIR");
+    }
+    if (!directory.isEmpty() && !QFileInfo(directory).isDir()) {
+        qWarning() << "Ignoring content override directory that does not exist:" << directory;
+        return QString();
+    }
+    return directory;
+}
+
+void ContentDatabase::setOverrideDirectory(const QString &path)
+{
+    m_overrideDirectory = path;
+}
+
+bool ContentDatabase::reload(QStringList *errors)
+{
+    PYRPG_PROFILE_SCOPE("ContentDatabase::reload");
+
+    Content content;
+    QStringList loadErrors;
+    QStringList loadWarnings;
+    bool ok = load(m_overrideDirectory, &content, &loadErrors, &loadWarnings);
+    m_lastErrors = loadErrors;
+    if (errors) {
+        *errors = loadErrors;
+    }
+    if (!ok) {
+        for (const QString &error : loadErrors) {
+            qWarning().noquote() << "Content error:" << error;
+        }
+        qWarning() << "Content reload rejected; keeping the current content";
+        return false;
+    }
+    m_lastWarnings = loadWarnings;
+    for (const QString &warning : loadWarnings) {
+        qWarning().noquote() << "Content warning:" << warning;
+    }
+    apply(content);
+    return true;
+}
+
+bool ContentDatabase::validate(const QString &overrideDirectory, QStringList *errors, QStringList *warnings)
+{
+    Content content;
+    QStringList ignoredWarnings;
+    return load(overrideDirectory, &content, errors, warnings ? warnings : &ignoredWarnings);
+}
+
+bool ContentDatabase::load(const QString &overrideDirectory, Content *content,
+                           QStringList *errors, QStringList *warnings)
+{
+    int errorsBefore = errors->size();
+
+    // Each file is parsed on its own first; the cross-file checks below only
+    // make sense once every file is readable
+    auto parse = [&](const char *fileName, auto &&parser) {
+        FileReader reader(fileName, overrideDirectory, errors);
+        QJsonObject root;
+        if (reader.read(&root)) {
+            parser(reader, root);
+        }
+    };
+    parse(ITEMS_FILE, [content](FileReader &reader, const QJsonObject &root) {
+        parseItems(reader, root, &content->items, &content->shop, &content->loot);
+    });
+    parse(SKILLS_FILE, [content](FileReader &reader, const QJsonObject &root) {
+        parseSkills(reader, root, &content->skills, &content->classes, &content->defaultClass);
+    });
+    parse(MONSTERS_FILE, [content](FileReader &reader, const QJsonObject &root) {
+        parseMonsters(reader, root, &content->levelVariance, &content->monsters, &content->encounters,
+                      &content->bossLevelOffset, &content->defaultBoss, &content->bosses,
+                      &content->finalBossName, &content->finalBossAliases);
+    });
+    parse(QUESTS_FILE, [content](FileReader &reader, const QJsonObject &root) {
+        parseQuests(reader, root, &content->quests);
+    });
+    parse(DIALOGUES_FILE, [content](FileReader &reader, const QJsonObject &root) {
+        parseDialogues(reader, root, &content->dialogues);
+    });
+    parse(STORY_EVENTS_FILE, [content](FileReader &reader, const QJsonObject &root) {
+        parseStoryEvents(reader, root, &content->storyEvents);
+    });
+    parse(LORE_FILE, [content](FileReader &reader, const QJsonObject &root) {
+        parseLore(reader, root, &content->lore);
+    });
+    if (errors->size() > errorsBefore) {
+        return false;
+    }
+
+    QSet<QString> itemNames, skillNames, questIds, loreIds, monsterNames;
+    for (const Item &item : content->items) itemNames.insert(item.name);
+    for (const Skill &skill : content->skills) skillNames.insert(skill.name);
+    for (const Quest &quest : content->quests) questIds.insert(quest.questId);
+    for (const LoreEntry &entry : content->lore) loreIds.insert(entry.entryId);
+    for (const QList<MonsterTemplate> *list : {&content->monsters, &content->bosses}) {
+        for (const MonsterTemplate &monster : *list) {
+            monsterNames.insert(monster.id);
+            monsterNames.insert(monster.name);
+            for (const QString &alias : monster.aliases) monsterNames.insert(alias);
+        }
+    }
+    monsterNames.insert(content->finalBossName);
+    for (const QString &alias : content->finalBossAliases) monsterNames.insert(alias);
+
+    auto fail = [errors](const QString &fileName, const QString &message) {
+        errors->append(QString("%1: %2").arg(fileName, message));
+    };
+    auto warn = [warnings](const QString &fileName, const QString &message) {
+        warnings->append(QString("%1: %2").arg(fileName, message));
+    };
+
+    // Only in builds that bundle the sprite pipeline; the others draw from the sources
+    if (!SpriteManifest::variants().isEmpty()) {
+        for (const QList<MonsterTemplate> *list : {&content->monsters, &content->bosses}) {
+            for (const MonsterTemplate &monster : *list) {
+                if (!SpriteManifest::canDraw(QString(":/assets/%1.png").arg(monster.spriteType))) {
+                    warn(MONSTERS_FILE, QString("monster \"%1\": spriteType \"%2\" is not in assets/sprites.json "
+                                                "and will be drawn without a sprite").arg(monster.id, monster.spriteType));
+                }
+            }
+        }
+    }
+
+    for (const Item &item : content->items) {
+        if (!item.loreId.isEmpty() && !loreIds.contains(item.loreId)) {
+            fail(ITEMS_FILE, QString("item \"%1\": loreId \"%2\" is not a lore entry").arg(item.name, item.loreId));
+        }
+    }
+    for (const QString &name : content->shop) {
+        if (!itemNames.contains(name)) {
+            fail(ITEMS_FILE, QString("shop item \"%1\" is not in the item catalog").arg(name));
+        }
+    }
+    for (const QString &name : content->loot.consumables) {
+        if (!itemNames.contains(name)) {
+            fail(ITEMS_FILE, QString("loot consumable \"%1\" is not in the item catalog").arg(name));
+        }
+    }
+
+    for (const ClassSkills &classSkills : content->classes + QList<ClassSkills>{content->defaultClass}) {
+        for (const QString &name : classSkills.skills) {
+            if (!skillNames.contains(name)) {
+                QString className = classSkills.className.isEmpty() ? "defaultClass" : classSkills.className;
+                fail(SKILLS_FILE, QString("class \"%1\": skill \"%2\" is not defined").arg(className, name));
+            }
+        }
+    }
+
+    for (const Quest &quest : content->quests) {
+        for (const QString &prerequisite : quest.prerequisiteQuestIds) {
+            if (!questIds.contains(prerequisite) || prerequisite == quest.questId) {
+                fail(QUESTS_FILE, QString("quest \"%1\": prerequisite \"%2\" is not another quest")
+                                      .arg(quest.questId, prerequisite));
+            }
+        }
+        for (const QuestObjective &objective : quest.objectives) {
+            if ((objective.type == "kill_enemies" || objective.type == "defeat_boss")
+                && !monsterNames.contains(objective.targetId)) {
+                fail(QUESTS_FILE, QString("quest \"%1\": target \"%2\" is not a monster, boss or final boss")
+                                      .arg(quest.questId, objective.targetId));
+            }
+        }
+        // QuestManager skips reward items it cannot create
+        for (const QString &name : quest.rewards.itemNames) {
+            if (!itemNames.contains(name)) {
+                warn(QUESTS_FILE, QString("quest \"%1\": reward \"%2\" is not in the item catalog and will not be given")
+                                      .arg(quest.questId, name));
+            }
+        }
+    }
+
+    for (const DialogueTree &tree : content->dialogues) {
+        if (!tree.nodes.contains(tree.startNodeId)) {
+            fail(DIALOGUES_FILE, QString("dialogue \"%1\": start node \"%2\" does not exist")
+                                     .arg(tree.id, tree.startNodeId));
+        }
+        for (const DialogueNode &node : tree.nodes) {
+            QString where = QString("dialogue \"%1\" node \"%2\"").arg(tree.id, node.id);
+            if (!node.autoNextNodeId.isEmpty() && !tree.nodes.contains(node.autoNextNodeId)) {
+                fail(DIALOGUES_FILE, QString("%1: autoNextNodeId \"%2\" does not exist").arg(where, node.autoNextNodeId));
+            }
+            if (node.choices.isEmpty() && node.autoNextNodeId.isEmpty() && !node.endsDialogue) {
+                fail(DIALOGUES_FILE, where + ": no choices, no autoNextNodeId and does not end the dialogue");
+            }
+            for (const DialogueChoice &choice : node.choices) {
+                if (!choice.targetNodeId.isEmpty() && !tree.nodes.contains(choice.targetNodeId)) {
+                    fail(DIALOGUES_FILE, QString("%1: choice \"%2\" leads to missing node \"%3\"")
+                                             .arg(where, choice.text, choice.targetNodeId));
+                }
+                for (const DialogueEffect &effect : choice.effects) {
+                    if ((effect.type == "UnlockQuest" || effect.type == "AdvanceQuest")
+                        && !questIds.contains(effect.target)) {
+                        fail(DIALOGUES_FILE, QString("%1: %2 target \"%3\" is not a quest")
+                                                 .arg(where, effect.type, effect.target));
+                    } else if (effect.type == "GiveItem" && !itemNames.contains(effect.target)) {
+                        warn(DIALOGUES_FILE, QString("%1: GiveItem \"%2\" is not in the item catalog and will not be given")
+                                                 .arg(where, effect.target));
+                    }
+                }
+            }
+        }
+    }
+
+    for (const StoryEvent &event : content->storyEvents) {
+        if ((event.triggerType == "quest_start" || event.triggerType == "quest_complete")
+            && !questIds.contains(event.triggerId)) {
+            fail(STORY_EVENTS_FILE, QString("story event \"%1\": triggerId \"%2\" is not a quest")
+                                        .arg(event.eventId, event.triggerId));
+        }
+    }
+
+    return errors->size() == errorsBefore;
+}
+
+void ContentDatabase::apply(const Content &content)
+{
+    m_content = content;
+    ++m_revision;
+
+    m_itemIndex.clear();
+    for (int i = 0; i < m_content.items.size(); ++i) {
+        m_itemIndex.insert(m_content.items.at(i).name, i);
+    }
+    m_skillIndex.clear();
+    for (int i = 0; i < m_content.skills.size(); ++i) {
+        m_skillIndex.insert(m_content.skills.at(i).name, i);
+    }
+
+    // Objects already handed out are updated in place; ones dropped from the
+    // content stay alive in the pool in case something still points at them
+    m_shopItems.clear();
+    for (const QString &name : m_content.shop) {
+        Item *&shared = m_shopItemPool[name];
+        if (shared) {
+            *shared = *item(name);
+        } else {
+            shared = new Item(*item(name));
+        }
+        m_shopItems.insert(name, shared);
+    }
+
+    m_dialogues.clear();
+    m_dialogueById.clear();
+    for (const DialogueTree &tree : m_content.dialogues) {
+        DialogueTree *&shared = m_dialoguePool[tree.id];
+        if (shared) {
+            *shared = tree;
+        } else {
+            shared = new DialogueTree(tree);
+        }
+        m_dialogues.append(shared);
+        m_dialogueById.insert(tree.id, shared);
+    }
+
+    m_storyEvents.clear();
+    m_storyEventById.clear();
+    for (const StoryEvent &event : m_content.storyEvents) {
+        StoryEvent *&shared = m_storyEventPool[event.eventId];
+        if (shared) {
+            *shared = event;
+        } else {
+            shared = new StoryEvent(event);
+        }
+        m_storyEvents.append(shared);
+        m_storyEventById.insert(event.eventId, shared);
+    }
+
+    m_lore.clear();
+    m_loreById.clear();
+    for (const LoreEntry &entry : m_content.lore) {
+        LoreEntry *&shared = m_lorePool[entry.entryId];
+        if (shared) {
+            *shared = entry;
+        } else {
+            shared = new LoreEntry(entry);
+        }
+        m_lore.append(shared);
+        m_loreById.insert(entry.entryId, shared);
+    }
+}
+
+const Item *ContentDatabase::item(const QString &name) const
+{
+    auto it = m_itemIndex.constFind(name);
+    return it == m_itemIndex.constEnd() ? nullptr : &m_content.items.at(it.value());
+}
+
+const Skill *ContentDatabase::skill(const QString &name) const
+{
+    auto it = m_skillIndex.constFind(name);
+    return it == m_skillIndex.constEnd() ? nullptr : &m_content.skills.at(it.value());
+}
+
+const ContentDatabase::ClassSkills &ContentDatabase::skillsForClass(const QString &className) const
+{
+    for (const ClassSkills &classSkills : m_content.classes) {
+        if (classSkills.className.compare(className, Qt::CaseInsensitive) == 0) {
+            return classSkills;
+        }
+    }
+    return m_content.defaultClass;
+}
+
+const ContentDatabase::MonsterTemplate *ContentDatabase::monster(const QString &name) const
+{
+    for (const MonsterTemplate &monster : m_content.monsters) {
+        if (monster.answersTo(name)) {
+            return &monster;
+        }
+    }
+    return nullptr;
+}
+
+const ContentDatabase::MonsterTemplate *ContentDatabase::boss(const QString &name) const
+{
+    for (const MonsterTemplate &boss : m_content.bosses) {
+        if (boss.answersTo(name)) {
+            return &boss;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,204 @@
+#ifndef CONTENTDATABASE_H
+#define CONTENTDATABASE_H
+
+#include "../models/Item.h"
+#include "../models/Skill.h"
+#include "../models/Quest.h"
+#include "../models/DialogueData.h"
+#include "../models/StoryEvent.h"
+#include "../models/LoreEntry.h"
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+
+// Game content read from JSON: items, skills, monsters, quests, dialogues,
+// story events and lore. The factories in factories/ hand out objects built
+// from it.
+//
+// Each catalog is one file (see fileNames()). The bundled copies are compiled
+// in under :/content/. A file of the same name in the override directory
+// (PYRPG_CONTENT_DIR, or the content/overrideDir setting) replaces the bundled
+// one, so content can be edited without a rebuild. Every load checks each file
+// against its schema (required fields, types, misspelt fields) and then the
+// catalogs against each other: lore ids, dialogue node targets, quest
+// prerequisites and kill targets, class skill lists and so on. A load with
+// errors is not applied; reload() keeps the current content and reports them.
+// Problems the game already tolerates, such as quest reward items that are not
+// in the item catalog or monster sprites the build does not bundle, are logged
+// as warnings.
+//
+// Lore entries, dialogue trees, story events and shop items are handed out as
+// pointers that stay valid for the life of the process: a reload updates them
+// in place. The first instance() call loads the content and may come from the
+// content warm-up thread; reload() is GUI thread only.
+class ContentDatabase
+{
+public:
+    // A stat at a given level: base + perLevel * level
+    struct StatFormula {
+        bool isSet = false;
+        int base = 0;
+        int perLevel = 0;
+
+        int at(int level) const { return base + perLevel * level; }
+    };
+
+    struct MonsterTemplate {
+        QString id;              // "shadow_wolf"
+        QString name;            // "Shadow Wolf", shown in combat
+        QString spriteType;      // Monster::enemyType; drawn from :/assets/<spriteType>.png, which
+                                 // the app has only if assets/sprites.json lists it
+        QStringList aliases;     // Other names createMonster() accepts
+        // Unset stats keep the Monster constructor's defaults
+        StatFormula health;
+        StatFormula attack;
+        StatFormula defense;
+        StatFormula magicAttack;
+        StatFormula experience;
+        StatFormula gold;
+
+        bool answersTo(const QString &name) const;
+    };
+
+    struct EncounterTier {
+        int weight = 0;
+        QStringList monsterIds;
+    };
+
+    struct LootRarity {
+        QString name;
+        int weight = 0;
+        double multiplier = 1.0;
+    };
+
+    struct LootEquipment {
+        QString type;            // "weapon", "armor" or "accessory"; also the slot
+        QStringList names;
+        StatFormula attackBonus;
+        StatFormula defenseBonus;
+        QString description;     // "{attack}" and "{defense}" are replaced
+    };
+
+    struct LootTable {
+        int consumableChance = 0;    // Percent
+        QStringList consumables;     // Item catalog names
+        QList<LootRarity> rarities;
+        int valuePerLevel = 0;
+        QList<LootEquipment> equipment;
+        // Drops of these rarities carry the loreId of the catalog item of the same name
+        QStringList loreRarities;
+    };
+
+    struct ClassSkills {
+        QString className;
+        QStringList skills;
+        QStringList startingSkills;
+    };
+
+    static ContentDatabase &instance();
+
+    // Items
+    const Item *item(const QString &name) const;
+    const QMap<QString, Item*> &shopItems() const { return m_shopItems; }
+    const LootTable &lootTable() const { return m_content.loot; }
+
+    // Skills; classes are matched case-insensitively, unknown ones get the default list
+    const Skill *skill(const QString &name) const;
+    const ClassSkills &skillsForClass(const QString &className) const;
+
+    // Monsters, matched by id, name or alias
+    const MonsterTemplate *monster(const QString &name) const;
+    const MonsterTemplate *boss(const QString &name) const;
+    const MonsterTemplate *defaultBoss() const { return boss(m_content.defaultBoss); }
+    const QList<MonsterTemplate> &monsters() const { return m_content.monsters; }
+    const QList<MonsterTemplate> &bosses() const { return m_content.bosses; }
+    const QList<EncounterTier> &encounterTiers() const { return m_content.encounters; }
+    int levelVariance() const { return m_content.levelVariance; }
+    int bossLevelOffset() const { return m_content.bossLevelOffset; }
+    QString finalBossName() const { return m_content.finalBossName; }
+
+    // Quest definitions, in file order
+    const QList<Quest> &quests() const { return m_content.quests; }
+
+    // In file order; nullptr for unknown ids
+    const QList<DialogueTree*> &dialogues() const { return m_dialogues; }
+    DialogueTree *dialogue(const QString &id) const { return m_dialogueById.value(id, nullptr); }
+    const QList<StoryEvent*> &storyEvents() const { return m_storyEvents; }
+    StoryEvent *storyEvent(const QString &id) const { return m_storyEventById.value(id, nullptr); }
+    const QList<LoreEntry*> &loreEntries() const { return m_lore; }
+    LoreEntry *loreEntry(const QString &id) const { return m_loreById.value(id, nullptr); }
+
+    // Loading
+    static QStringList fileNames();
+    static QString configuredOverrideDirectory();
+    QString overrideDirectory() const { return m_overrideDirectory; }
+    // Takes effect on the next reload(); empty loads the bundled content only
+    void setOverrideDirectory(const QString &path);
+
+    // Re-reads every file. On errors the current content is kept and false returned.
+    bool reload(QStringList *errors = nullptr);
+    // Goes up each time new content is applied
+    int revision() const { return m_revision; }
+    QStringList lastErrors() const { return m_lastErrors; }
+    QStringList lastWarnings() const { return m_lastWarnings; }
+
+    // Checks the content in overrideDirectory (plus bundled files) without applying it
+    static bool validate(const QString &overrideDirectory, QStringList *errors, QStringList *warnings = nullptr);
+
+private:
+    // Everything parsed from the files, by value
+    struct Content {
+        QList<Item> items;
+        QStringList shop;
+        LootTable loot;
+        QList<Skill> skills;
+        QList<ClassSkills> classes;
+        ClassSkills defaultClass;
+        int levelVariance = 0;
+        QList<MonsterTemplate> monsters;
+        QList<EncounterTier> encounters;
+        int bossLevelOffset = 0;
+        QString defaultBoss;
+        QList<MonsterTemplate> bosses;
+        QString finalBossName;
+        QStringList finalBossAliases;
+        QList<Quest> quests;
+        QList<DialogueTree> dialogues;
+        QList<StoryEvent> storyEvents;
+        QList<LoreEntry> lore;
+    };
+
+    ContentDatabase();
+    ContentDatabase(const ContentDatabase &) = delete;
+    ContentDatabase &operator=(const ContentDatabase &) = delete;
+
+    static bool load(const QString &overrideDirectory, Content *content,
+                     QStringList *errors, QStringList *warnings);
+    void apply(const Content &content);
+
+    Content m_content;
+    QString m_overrideDirectory;
+    int m_revision;
+    QStringList m_lastErrors;
+    QStringList m_lastWarnings;
+
+    QHash<QString, int> m_itemIndex;   // Name -> m_content.items
+    QHash<QString, int> m_skillIndex;  // Name -> m_content.skills
+
+    // Handed out by pointer; never deleted, updated in place on reload
+    QMap<QString, Item*> m_shopItems;
+    QHash<QString, Item*> m_shopItemPool;
+    QList<DialogueTree*> m_dialogues;
+    QHash<QString, DialogueTree*> m_dialogueById;
+    QHash<QString, DialogueTree*> m_dialoguePool;
+    QList<StoryEvent*> m_storyEvents;
+    QHash<QString, StoryEvent*> m_storyEventById;
+    QHash<QString, StoryEvent*> m_storyEventPool;
+    QList<LoreEntry*> m_lore;
+    QHash<QString, LoreEntry*> m_loreById;
+    QHash<QString, LoreEntry*> m_lorePool;
+};
+
+#endif // CONTENTDATABASE_H
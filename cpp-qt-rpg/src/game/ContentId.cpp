@@ -0,0 +1,138 @@
+#include "ContentId.h"
+#include <QHash>
+#include <QReadWriteLock>
+#include <atomic>
+
+namespace {
+
+// Strings are stored in fixed-size blocks that never move once allocated, so
+// reading one needs no lock: an id only reaches another thread through
+// something that synchronises (a queued signal, a mutex, starting the thread),
+// and that also publishes the entry the id refers to.
+class AtomTable
+{
+public:
+    struct Entry {
+        QString name;
+        quint32 folded = 0;
+    };
+
+    static AtomTable &instance()
+    {
+        static AtomTable table;
+        return table;
+    }
+
+    quint32 find(const QString &name) const
+    {
+        QReadLocker locker(&m_lock);
+        return m_values.value(name, 0);
+    }
+
+    quint32 intern(const QString &name)
+    {
+        if (name.isEmpty()) {
+            return 0;
+        }
+        if (quint32 value = find(name)) {
+            return value;
+        }
+        QWriteLocker locker(&m_lock);
+        return insert(name);
+    }
+
+    const Entry &entry(quint32 value) const
+    {
+        return m_blocks[value >> BLOCK_BITS].load(std::memory_order_acquire)[value & BLOCK_MASK];
+    }
+
+    int count() const { return int(m_count.load(std::memory_order_acquire)); }
+
+private:
+    static const int BLOCK_BITS = 10;
+    static const quint32 BLOCK_MASK = (1u << BLOCK_BITS) - 1;
+    static const int MAX_BLOCKS = 4096;  // About four million ids
+
+    AtomTable()
+        : m_count(1)
+    {
+        for (std::atomic<Entry*> &block : m_blocks) {
+            block.store(nullptr, std::memory_order_relaxed);
+        }
+        // Value 0 is the invalid id
+        m_blocks[0].store(new Entry[1 << BLOCK_BITS], std::memory_order_release);
+        // So QVariant::toString() works on signal arguments (QSignalSpy, QML)
+        QMetaType::registerConverter<ContentId, QString>(&ContentId::toString);
+    }
+
+    ~AtomTable()
+    {
+        for (std::atomic<Entry*> &block : m_blocks) {
+            delete[] block.load(std::memory_order_relaxed);
+        }
+    }
+
+    // With m_lock held for writing
+    quint32 insert(const QString &name)
+    {
+        auto it = m_values.constFind(name);
+        if (it != m_values.constEnd()) {
+            return it.value();
+        }
+
+        QString lower = name.toLower();
+        quint32 folded = lower == name ? 0 : insert(lower);
+
+        quint32 value = m_count.load(std::memory_order_relaxed);
+        int block = int(value >> BLOCK_BITS);
+        if (block >= MAX_BLOCKS) {
+            qFatal("ContentId: more than %d ids interned", MAX_BLOCKS << BLOCK_BITS);
+        }
+        Entry *entries = m_blocks[block].load(std::memory_order_relaxed);
+        if (!entries) {
+            entries = new Entry[1 << BLOCK_BITS];
+            m_blocks[block].store(entries, std::memory_order_release);
+        }
+        entries[value & BLOCK_MASK] = {name, folded ? folded : value};
+        m_values.insert(name, value);
+        m_count.store(value + 1, std::memory_order_release);
+        return value;
+    }
+
+    mutable QReadWriteLock m_lock;
+    QHash<QString, quint32> m_values;
+    std::atomic<Entry*> m_blocks[MAX_BLOCKS];
+    std::atomic<quint32> m_count;
+};
+
+}
+
+ContentId::ContentId(const QString &name)
+    : m_value(AtomTable::instance().intern(name))
+{
+}
+
+ContentId ContentId::find(const QString &name)
+{
+    return ContentId(AtomTable::instance().find(name));
+}
+
+int ContentId::count()
+{
+    return AtomTable::instance().count();
+}
+
+QString ContentId::toString() const
+{
+    return m_value ? AtomTable::instance().entry(m_value).name : QString();
+}
+
+ContentId ContentId::folded() const
+{
+    return m_value ? ContentId(AtomTable::instance().entry(m_value).folded) : ContentId();
+}
+
+QDebug operator<<(QDebug debug, ContentId id)
+{
+    return debug << id.toString();
+}
@@ -0,0 +1,62 @@
+#ifndef CONTENTID_H
+#define CONTENTID_H
+
+#include <QDebug>
+#include <QHashFunctions>
+#include <QMetaType>
+#include <QString>
+
+// Interned identifier for game content: quest, lore, story event, dialogue and
+// node ids, item and monster names.
+//
+// Each distinct string gets a 32-bit value the first time it is seen and keeps
+// it for the life of the process, so copying, comparing and hashing an id are
+// integer operations and toString() is an array lookup. Values are dense from 1
+// (0 is the invalid, empty id), so per-id state can be a flat array indexed by
+// value() instead of a map; count() bounds it.
+//
+// Making an id from a string interns it, which costs a string hash and a lock.
+// Do it once where a name enters the engine (content loading, the models, UI
+// input) and pass the id on from there. Interned strings are never freed, so
+// use find() for strings that may not be content, such as search text. Ids may
+// be made and read on any thread.
+class ContentId
+{
+public:
+    ContentId() : m_value(0) {}
+    // Explicit so every interning is visible at the call site
+    explicit ContentId(const QString &name);
+    explicit ContentId(const char *name) : ContentId(QString::fromUtf8(name)) {}
+
+    // The id of name if it has been interned, else an invalid id
+    static ContentId find(const QString &name);
+    // Every value() handed out so far is below this
+    static int count();
+
+    bool isValid() const { return m_value != 0; }
+    quint32 value() const { return m_value; }
+    QString toString() const;
+    // The id of the lower-cased string, for matching names case-insensitively
+    ContentId folded() const;
+
+    friend bool operator==(ContentId a, ContentId b) { return a.m_value == b.m_value; }
+    friend bool operator!=(ContentId a, ContentId b) { return a.m_value != b.m_value; }
+    // Interning order, not alphabetical
+    friend bool operator<(ContentId a, ContentId b) { return a.m_value < b.m_value; }
+
+private:
+    explicit ContentId(quint32 value) : m_value(value) {}
+
+    quint32 m_value;
+};
+
+inline size_t qHash(ContentId id, size_t seed = 0)
+{
+    return qHash(id.value(), seed);
+}
+
+QDebug operator<<(QDebug debug, ContentId id);
+
+Q_DECLARE_METATYPE(ContentId)
+
+#endif // CONTENTID_H
@@ -0,0 +1,98 @@
+#include "ContentWarmup.h"
+#include "../diagnostics/Profiler.h"
+#include "../components/SpriteCache.h"
+#include "ContentDatabase.h"
+#include "factories/MonsterFactory.h"
+#include <QThread>
+#include <QHash>
+
+ContentWarmup::ContentWarmup(QObject *parent)
+    : QObject(parent)
+    , m_thread(nullptr)
+    , m_finished(false)
+    , m_devicePixelRatio(1.0)
+{
+}
+
+ContentWarmup::~ContentWarmup()
+{
+    if (m_thread) {
+        m_thread->wait();
+        delete m_thread;
+    }
+}
+
+void ContentWarmup::start(const QList<SpriteRequest> &sprites, qreal devicePixelRatio,
+                          const QSize &monsterSpriteSize)
+{
+    if (m_thread || m_finished) {
+        return;
+    }
+
+    PYRPG_TRACE_INSTANT("ContentWarmup::start", "warmup");
+    m_requests = sprites;
+    m_devicePixelRatio = devicePixelRatio;
+    m_monsterSpriteSize = monsterSpriteSize;
+    m_thread = QThread::create([this]() { run(); });
+    m_thread->setObjectName("ContentWarmup");
+    // Queued back to this object's (GUI) thread
+    connect(m_thread, &QThread::finished, this, &ContentWarmup::handleWorkerFinished);
+    m_thread->start(QThread::LowPriority);
+}
+
+void ContentWarmup::run()
+{
+    PYRPG_PROFILE_SCOPE("ContentWarmup::run");
+
+    {
+        PYRPG_PROFILE_SCOPE("ContentWarmup::catalogs");
+        // Reads and validates every content file, which the factories then share
+        ContentDatabase::instance();
+    }
+    if (m_monsterSpriteSize.isValid()) {
+        for (const QString &enemyType : MonsterFactory::getAllSpriteTypes()) {
+            m_requests.append({QString(":/assets/%1.png").arg(enemyType), m_monsterSpriteSize});
+        }
+    }
+
+    PYRPG_PROFILE_SCOPE("ContentWarmup::sprites");
+    QHash<QString, QImage> sources;
+    for (const SpriteRequest &request : m_requests) {
+        QImage prescaled = SpriteCache::prescaledImage(request.assetPath, request.size, m_devicePixelRatio);
+        if (!prescaled.isNull()) {
+            m_decoded.append({request, QImage(), prescaled, false});
+            continue;
+        }
+
+        auto it = sources.find(request.assetPath);
+        if (it == sources.end()) {
+            // Premultiplied is what the raster engine uploads without converting
+            QImage decoded = SpriteCache::sourceImage(request.assetPath);
+            if (!decoded.isNull()) {
+                decoded = decoded.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+            }
+            it = sources.insert(request.assetPath, decoded);
+        }
+        m_decoded.append({request, it.value(),
+                          SpriteCache::scaledImage(it.value(), request.size, m_devicePixelRatio), true});
+    }
+}
+
+void ContentWarmup::handleWorkerFinished()
+{
+    PYRPG_PROFILE_SCOPE("ContentWarmup::handOff");
+    SpriteCache &cache = SpriteCache::instance();
+    for (const DecodedSprite &sprite : std::as_const(m_decoded)) {
+        if (sprite.decodedSource) {
+            cache.insertImage(sprite.request.assetPath, sprite.source);
+        }
+        cache.insertScaledImage(sprite.request.assetPath, sprite.request.size, m_devicePixelRatio, sprite.scaled);
+    }
+    m_decoded.clear();
+
+    m_thread->deleteLater();
+    m_thread = nullptr;
+    m_finished = true;
+    PYRPG_TRACE_INSTANT("ContentWarmup::finished", "warmup");
+    emit finished();
+}
@@ -0,0 +1,65 @@
+#ifndef CONTENTWARMUP_H
+#define CONTENTWARMUP_H
+
+#include <QObject>
+#include <QList>
+#include <QString>
+#include <QSize>
+#include <QImage>
+
+class QThread;
+
+// Loads the game content and decodes sprites on a worker thread while the main
+// menu is up, so "New Game" and the first encounter find everything ready.
+//
+// ContentDatabase::instance() is a thread-safe static that reads and validates
+// the content files on first use, so calling it on the worker simply leaves it
+// loaded. Sprites are loaded
+// pre-scaled where the build provides them (SpriteCache::prescaledImage), else
+// scaled on the worker from the best image the build has (SpriteCache::sourceImage),
+// and handed to SpriteCache on the GUI thread, which is the only thread allowed to
+// create QPixmaps.
+class ContentWarmup : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct SpriteRequest {
+        QString assetPath;
+        QSize size;  // Logical size the sprite is shown at
+    };
+
+    explicit ContentWarmup(QObject *parent = nullptr);
+    ~ContentWarmup();  // Waits for a running worker
+
+    // Starts the worker; does nothing if it already ran or is running. With a
+    // valid monsterSpriteSize, every monster sprite in the content is decoded at
+    // that size too, once the worker has loaded the content.
+    void start(const QList<SpriteRequest> &sprites, qreal devicePixelRatio,
+               const QSize &monsterSpriteSize = QSize());
+    bool isRunning() const { return m_thread != nullptr; }
+    bool isFinished() const { return m_finished; }
+
+signals:
+    void finished();
+
+private:
+    struct DecodedSprite {
+        SpriteRequest request;
+        QImage source;
+        QImage scaled;
+        bool decodedSource;  // False when the build's pre-scaled variant for this size was used
+    };
+
+    void run();
+    void handleWorkerFinished();
+
+    QThread *m_thread;
+    bool m_finished;
+    QList<SpriteRequest> m_requests;
+    qreal m_devicePixelRatio;
+    QSize m_monsterSpriteSize;
+    QList<DecodedSprite> m_decoded;  // Written by the worker, read once it has finished
+};
+
+#endif // CONTENTWARMUP_H
@@ -0,0 +1,49 @@
+#include "ContentWatcher.h"
+#include "ContentDatabase.h"
+#include <QDir>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QTimer>
+
+ContentWatcher::ContentWatcher(const QString &directory, QObject *parent)
+    : QObject(parent)
+    , m_directory(directory)
+    , m_watcher(new QFileSystemWatcher(this))
+    , m_debounce(new QTimer(this))
+{
+    m_debounce->setSingleShot(true);
+    m_debounce->setInterval(DEFAULT_DEBOUNCE_MS);
+    connect(m_debounce, &QTimer::timeout, this, [this]() {
+        watchFiles();
+        emit contentChanged();
+    });
+
+    connect(m_watcher, &QFileSystemWatcher::fileChanged, this, &ContentWatcher::handleChange);
+    connect(m_watcher, &QFileSystemWatcher::directoryChanged, this, &ContentWatcher::handleChange);
+
+    m_watcher->addPath(m_directory);
+    watchFiles();
+}
+
+void ContentWatcher::setDebounceMs(int ms)
+{
+    m_debounce->setInterval(qMax(0, ms));
+}
+
+void ContentWatcher::watchFiles()
+{
+    // Only the catalog files; a file created later is picked up through the directory
+    QDir directory(m_directory);
+    const QStringList watched = m_watcher->files();
+    for (const QString &fileName : ContentDatabase::fileNames()) {
+        QString path = directory.filePath(fileName);
+        if (QFileInfo::exists(path) && !watched.contains(path)) {
+            m_watcher->addPath(path);
+        }
+    }
+}
+
+void ContentWatcher::handleChange()
+{
+    m_debounce->start();
+}
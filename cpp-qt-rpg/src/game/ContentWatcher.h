@@ -0,0 +1,42 @@
+#ifndef CONTENTWATCHER_H
+#define CONTENTWATCHER_H
+
+#include <QObject>
+#include <QString>
+
+class QFileSystemWatcher;
+class QTimer;
+
+// Watches the content override directory (ContentDatabase) and reports when
+// its content files change, so they can be reloaded without restarting.
+//
+// Editors often save by writing a new file and renaming it over the old one,
+// which drops the file from the watch list; the directory is watched too and
+// the file paths are re-added after every change. Bursts of changes (a save
+// that touches several files, or several saves in a row) are coalesced into
+// one contentChanged() after DEFAULT_DEBOUNCE_MS of quiet.
+class ContentWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int DEFAULT_DEBOUNCE_MS = 300;
+
+    explicit ContentWatcher(const QString &directory, QObject *parent = nullptr);
+
+    QString directory() const { return m_directory; }
+    void setDebounceMs(int ms);
+
+signals:
+    void contentChanged();
+
+private:
+    void watchFiles();
+    void handleChange();
+
+    QString m_directory;
+    QFileSystemWatcher *m_watcher;
+    QTimer *m_debounce;
+};
+
+#endif // CONTENTWATCHER_H
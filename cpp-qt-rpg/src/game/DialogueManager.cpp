@@ -1,7 +1,9 @@
 #include "DialogueManager.h"
+#include "../diagnostics/Profiler.h"
 #include "factories/DialogueFactory.h"
 #include "factories/ItemFactory.h"
 #include <QDebug>
+#include <algorithm>
 
 DialogueManager::DialogueManager(Player* player, QObject* parent)
     : QObject(parent)
@@ -15,24 +17,30 @@ DialogueManager::~DialogueManager()
 {
     // Dialogue trees are managed by factory static cache, don't delete them here
     m_dialogueTrees.clear();
+    m_dialogues.clear();
 }
 
 void DialogueManager::loadDialogues()
 {
-    QList<DialogueTree*> dialogues = DialogueFactory::getAllDialogues();
-    for (DialogueTree* tree : dialogues) {
-        if (tree) {
-            m_dialogueTrees[tree->id] = tree;
-        }
+    PYRPG_PROFILE_SCOPE("DialogueManager::loadDialogues");
+    m_dialogueTrees.clear();
+    m_dialogues = DialogueFactory::getAllDialogues();
+    m_dialogues.removeAll(nullptr);
+    std::sort(m_dialogues.begin(), m_dialogues.end(), [](const DialogueTree *a, const DialogueTree *b) {
+        return a->id < b->id;
+    });
+    for (DialogueTree* tree : m_dialogues) {
+        m_dialogueTrees[ContentId(tree->id)] = tree;
     }
     qDebug() << "Loaded" << m_dialogueTrees.size() << "dialogue trees";
 }
 
-void DialogueManager::startDialogue(const QString &dialogueId)
+void DialogueManager::startDialogue(ContentId dialogueId)
 {
+    PYRPG_PROFILE_SCOPE("DialogueManager::startDialogue");
     // Check if already viewed (for unique dialogues)
     // Note: For repeatable dialogues, skip this check or add a 'repeatable' flag
-    if (m_player->hasViewedDialogue(dialogueId)) {
+    if (m_player->hasViewedDialogue(dialogueId.toString())) {
         qDebug() << "Dialogue already viewed:" << dialogueId;
         // For now, allow replay - comment out return to enable replaying
         // return;
@@ -53,7 +61,25 @@ void DialogueManager::startDialogue(const QString &dialogueId)
     m_currentDialogueId = dialogueId;
 
     emit dialogueStarted(dialogueId, m_currentTree->npcName);
-    emit dialogueNodeChanged(m_currentNode->id, m_currentNode->speaker, m_currentNode->text);
+    showCurrentNode();
+}
+
+void DialogueManager::reloadDialogues(ContentId currentNodeId)
+{
+    loadDialogues();
+    if (!m_currentTree) {
+        return;
+    }
+
+    // The tree object survives a reload but its nodes were replaced
+    m_currentTree = m_dialogueTrees.value(m_currentDialogueId, nullptr);
+    m_currentNode = m_currentTree ? m_currentTree->getNode(currentNodeId.toString()) : nullptr;
+    if (!m_currentNode) {
+        qWarning() << "Dialogue" << m_currentDialogueId << "lost node" << currentNodeId << "in the content reload";
+        endDialogue();
+        return;
+    }
+    emit dialogueNodeChanged(currentNodeId, m_currentNode->speaker, m_currentNode->text);
 }
 
 DialogueNode* DialogueManager::getCurrentNode() const
@@ -63,6 +89,7 @@ DialogueNode* DialogueManager::getCurrentNode() const
 
 void DialogueManager::selectChoice(int choiceIndex)
 {
+    PYRPG_PROFILE_SCOPE("DialogueManager::selectChoice");
     if (!m_currentNode) {
         qWarning() << "No active dialogue node";
         return;
@@ -94,7 +121,7 @@ void DialogueManager::selectChoice(int choiceIndex)
 
     m_currentNode = m_currentTree->getNode(choice.targetNodeId);
     if (m_currentNode) {
-        emit dialogueNodeChanged(m_currentNode->id, m_currentNode->speaker, m_currentNode->text);
+        showCurrentNode();
 
         // Check if new node ends dialogue
         if (m_currentNode->endsDialogue && m_currentNode->choices.size() == 1 &&
@@ -116,7 +143,7 @@ void DialogueManager::advance()
 
     m_currentNode = m_currentTree->getNode(m_currentNode->autoNextNodeId);
     if (m_currentNode) {
-        emit dialogueNodeChanged(m_currentNode->id, m_currentNode->speaker, m_currentNode->text);
+        showCurrentNode();
     } else {
         endDialogue();
     }
@@ -129,17 +156,24 @@ bool DialogueManager::isDialogueActive() const
 
 void DialogueManager::endDialogue()
 {
-    if (!m_currentDialogueId.isEmpty()) {
-        m_player->markDialogueViewed(m_currentDialogueId);
+    if (m_currentDialogueId.isValid()) {
+        m_player->markDialogueViewed(m_currentDialogueId.toString());
     }
 
     m_currentTree = nullptr;
     m_currentNode = nullptr;
-    m_currentDialogueId = "";
+    m_currentDialogueId = ContentId();
 
     emit dialogueEnded();
 }
 
+void DialogueManager::showCurrentNode()
+{
+    // Only the nodes actually shown become searchable, not the branches not taken
+    m_player->markDialogueNodeViewed(m_currentDialogueId.toString(), m_currentNode->id);
+    emit dialogueNodeChanged(ContentId(m_currentNode->id), m_currentNode->speaker, m_currentNode->text);
+}
+
 void DialogueManager::applyEffect(const DialogueEffect &effect)
 {
     if (effect.type == "UnlockQuest") {
@@ -3,8 +3,10 @@
 
 #include "models/DialogueData.h"
 #include "models/Player.h"
+#include "ContentId.h"
 #include <QObject>
-#include <QMap>
+#include <QHash>
+#include <QList>
 #include <QString>
 
 class DialogueManager : public QObject
@@ -17,27 +19,33 @@ public:
 
     // Dialogue management
     void loadDialogues();
-    void startDialogue(const QString &dialogueId);
+    // After a content reload. m_currentNode points into the replaced node map,
+    // so the caller reads the current node id before reloading.
+    void reloadDialogues(ContentId currentNodeId);
+    void startDialogue(ContentId dialogueId);
     DialogueNode* getCurrentNode() const;
     void selectChoice(int choiceIndex);
     void advance();  // For linear dialogues with autoNextNodeId
     bool isDialogueActive() const;
     void endDialogue();
+    QList<DialogueTree*> getAllDialogues() const { return m_dialogues; }
 
 signals:
-    void dialogueStarted(const QString &dialogueId, const QString &npcName);
-    void dialogueNodeChanged(const QString &nodeId, const QString &speaker, const QString &text);
+    void dialogueStarted(ContentId dialogueId, const QString &npcName);
+    void dialogueNodeChanged(ContentId nodeId, const QString &speaker, const QString &text);
     void dialogueEnded();
     void effectTriggered(const QString &effectType, const QString &target, int value);
 
 private:
     void applyEffect(const DialogueEffect &effect);
+    void showCurrentNode();  // Records the node as viewed and emits dialogueNodeChanged
 
     Player* m_player;  // Reference, not owned
-    QMap<QString, DialogueTree*> m_dialogueTrees;  // All dialogues, owned
+    QHash<ContentId, DialogueTree*> m_dialogueTrees;  // All dialogues, owned by ContentDatabase
+    QList<DialogueTree*> m_dialogues;  // The same, by id
     DialogueTree* m_currentTree;  // Current dialogue in progress
     DialogueNode* m_currentNode;  // Current node in tree
-    QString m_currentDialogueId;  // For tracking and saving
+    ContentId m_currentDialogueId;  // For tracking and saving
 };
 
 #endif // DIALOGUEMANAGER_H
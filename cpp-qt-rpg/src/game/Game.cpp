@@ -1,13 +1,15 @@
 #include "Game.h"
+#include "../diagnostics/Profiler.h"
 #include "factories/MonsterFactory.h"
 #include "factories/SkillFactory.h"
 #include "factories/ItemFactory.h"
+#include "ContentDatabase.h"
 #include "../models/FinalBoss.h"
 #include <QRandomGenerator>
 
 Game::Game(QObject *parent)
 : QObject(parent), player(nullptr), currentMonster(nullptr), combatActive(false), m_questManager(nullptr),
-  m_dialogueManager(nullptr), m_storyManager(nullptr), m_codexManager(nullptr)
+  m_dialogueManager(nullptr), m_storyManager(nullptr), m_codexManager(nullptr), m_searchIndexStale(true)
 {
 }
 
@@ -35,6 +37,7 @@ Game::~Game()
 
 void Game::newGame(const QString &playerName, const QString &characterClass)
 {
+    PYRPG_PROFILE_SCOPE("Game::newGame");
     // Clean up old player object if it exists
     if (player) {
         delete player;
@@ -74,6 +77,7 @@ void Game::newGame(const QString &playerName, const QString &characterClass)
     }
     m_codexManager = new CodexManager(player, this);
     m_codexManager->loadLoreEntries();
+    m_searchIndexStale = true;
 
     // Connect manager signals BEFORE loading quests
     // This ensures that when quests are auto-accepted, story events are triggered
@@ -83,6 +87,34 @@ void Game::newGame(const QString &playerName, const QString &characterClass)
 
     // NOTE: loadQuests() is now called by MainWindow AFTER it connects to StoryManager signals
     // This ensures the tutorial event displays properly on character creation
+
+    emit playerChanged(player);
+}
+
+bool Game::reloadContent(QStringList *errors)
+{
+    PYRPG_PROFILE_SCOPE("Game::reloadContent");
+    ContentId dialogueNodeId;
+    if (m_dialogueManager && m_dialogueManager->getCurrentNode()) {
+        dialogueNodeId = ContentId(m_dialogueManager->getCurrentNode()->id);
+    }
+
+    if (!ContentDatabase::instance().reload(errors)) {
+        return false;
+    }
+
+    // Monsters, items and skills are read at creation time and need nothing here
+    if (m_dialogueManager) {
+        m_dialogueManager->reloadDialogues(dialogueNodeId);
+    }
+    if (m_storyManager) {
+        m_storyManager->loadEvents();
+    }
+    if (m_codexManager) {
+        m_codexManager->loadLoreEntries();
+    }
+    m_searchIndexStale = true;
+    return true;
 }
 
 Player* Game::getPlayer()
@@ -115,14 +147,91 @@ CodexManager* Game::getCodexManager()
     return m_codexManager;
 }
 
+QList<SearchDocument> Game::searchContent(const QString &query, int maxResults)
+{
+    if (m_searchIndexStale) {
+        rebuildSearchIndex();
+    }
+
+    QList<SearchDocument> results;
+    const QList<int> ids = m_searchIndex.search(query, maxResults, [this](const SearchDocument &document) {
+        return isSearchable(document);
+    });
+    for (int id : ids) {
+        results.append(m_searchIndex.document(id));
+    }
+    return results;
+}
+
+void Game::rebuildSearchIndex()
+{
+    PYRPG_PROFILE_SCOPE("Game::rebuildSearchIndex");
+    m_searchIndex.clear();
+
+    // Everything is indexed once per loaded catalog; visibility is checked per query
+    if (m_codexManager) {
+        for (LoreEntry *entry : m_codexManager->getAllEntries()) {
+            m_searchIndex.addDocument({SearchDocument::Lore, ContentId(entry->entryId), entry->title,
+                                       entry->shortDescription + "\n" + entry->fullText});
+        }
+    }
+    if (m_questManager) {
+        for (Quest *quest : m_questManager->getAllQuests()) {
+            QString body = quest->longDescription.isEmpty() ? quest->description
+                                                            : quest->description + "\n" + quest->longDescription;
+            for (const QuestObjective &objective : quest->objectives) {
+                body += "\n" + objective.description;
+            }
+            m_searchIndex.addDocument({SearchDocument::Quest, ContentId(quest->questId), quest->title, body});
+        }
+    }
+    const QMap<QString, Item*> shopItems = ItemFactory::getShopItems();
+    for (Item *item : shopItems) {
+        m_searchIndex.addDocument({SearchDocument::Item, ContentId(item->name), item->name,
+                                   item->itemType + "\n" + item->description});
+    }
+    if (m_dialogueManager) {
+        for (DialogueTree *tree : m_dialogueManager->getAllDialogues()) {
+            for (const DialogueNode &node : std::as_const(tree->nodes)) {
+                m_searchIndex.addDocument({SearchDocument::Dialogue, ContentId(Player::dialogueNodeKey(tree->id, node.id)),
+                                           node.speaker.isEmpty() ? tree->npcName : node.speaker, node.text});
+            }
+        }
+    }
+
+    // Quests only exist once loadQuests has run; rebuild again until they do
+    m_searchIndexStale = !m_questManager || m_questManager->getAllQuests().isEmpty();
+}
+
+bool Game::isSearchable(const SearchDocument &document) const
+{
+    if (!player) return false;
+
+    switch (document.kind) {
+        case SearchDocument::Lore:
+            return player->hasUnlockedLore(document.key.toString());
+        case SearchDocument::Quest: {
+            Quest *quest = m_questManager ? m_questManager->getQuestById(document.key) : nullptr;
+            return quest && !quest->isLocked();
+        }
+        case SearchDocument::Item:
+            return true;  // The shop catalog is always browsable
+        case SearchDocument::Dialogue:
+            return player->hasViewedDialogue(document.key.toString());  // Keyed by the node, see dialogueNodeKey
+    }
+    return false;
+}
+
 bool Game::saveGame(const QString &filePath)
 {
+    PYRPG_PROFILE_SCOPE("Game::saveGame");
     if (!player) return false;
     return saveManager.saveGame(player, filePath);
 }
 
 bool Game::loadGame(const QString &filePath)
 {
+    PYRPG_PROFILE_SCOPE("Game::loadGame");
 Player *loadedPlayer = saveManager.loadGame(filePath);
 if (!loadedPlayer) return false;
 if (player) {
@@ -154,6 +263,7 @@ if (m_codexManager) {
 }
 m_codexManager = new CodexManager(player, this);
 m_codexManager->loadLoreEntries();
+m_searchIndexStale = true;
 
 // Connect manager signals BEFORE loading quests
 connect(m_questManager, &QuestManager::questAccepted, m_storyManager, &StoryManager::onQuestStarted, Qt::UniqueConnection);
@@ -163,17 +273,21 @@ connect(m_questManager, &QuestManager::questCompleted, m_codexManager, &CodexMan
 // Load quests AFTER connections are made
 m_questManager->loadQuests();
 
+emit playerChanged(player);
+
 return true;
 }
 
 bool Game::saveToSlot(int slotNumber)
 {
+    PYRPG_PROFILE_SCOPE("Game::saveToSlot");
     if (!player) return false;
     return saveManager.saveToSlot(player, slotNumber);
 }
 
 bool Game::loadFromSlot(int slotNumber)
 {
+    PYRPG_PROFILE_SCOPE("Game::loadFromSlot");
     Player *loadedPlayer = saveManager.loadFromSlot(slotNumber);
     if (!loadedPlayer) return false;
     if (player) {
@@ -205,6 +319,7 @@ bool Game::loadFromSlot(int slotNumber)
     }
     m_codexManager = new CodexManager(player, this);
     m_codexManager->loadLoreEntries();
+    m_searchIndexStale = true;
 
     // Connect manager signals BEFORE loading quests
     connect(m_questManager, &QuestManager::questAccepted, m_storyManager, &StoryManager::onQuestStarted, Qt::UniqueConnection);
@@ -214,6 +329,8 @@ bool Game::loadFromSlot(int slotNumber)
     // NOTE: loadQuests() is now called by MainWindow AFTER it connects to StoryManager signals
     // This ensures the tutorial event displays properly on character creation
 
+    emit playerChanged(player);
+
     return true;
 }
 
@@ -225,11 +342,14 @@ bool Game::deleteSlot(int slotNumber)
 // Combat
 void Game::startCombat()
 {
+    PYRPG_PROFILE_SCOPE("Game::startCombat");
     // Create a random monster based on player level
     if (currentMonster) {
         delete currentMonster;
     }
 
+    PYRPG_PROFILE_COUNT("combat.encounters", 1);
+
     // Check if player has active quest objectives requiring specific monsters
     QString questMonsterType;
     if (m_questManager) {
@@ -274,6 +394,7 @@ void Game::startCombat()
 
 QString Game::playerAttack()
 {
+    PYRPG_PROFILE_SCOPE("Game::playerAttack");
     if (!combatActive || !currentMonster || !player) return "";
 
     bool critical = rollCritical(player->dexterity);
@@ -310,6 +431,7 @@ QString Game::playerAttack()
 
 QString Game::playerUseSkill(Skill* skill)
 {
+    PYRPG_PROFILE_SCOPE("Game::playerUseSkill");
     if (!combatActive || !currentMonster || !player || !skill) return "";
 
     // Check mana
@@ -353,6 +475,7 @@ QString Game::playerUseSkill(Skill* skill)
 
 QString Game::playerUseItem(Item* item)
 {
+    PYRPG_PROFILE_SCOPE("Game::playerUseItem");
     if (!combatActive || !player || !item) return "";
 
     QString itemName = item->name;  // Save name before deletion
@@ -377,6 +500,7 @@ QString Game::playerUseItem(Item* item)
 
 QString Game::monsterAttack()
 {
+    PYRPG_PROFILE_SCOPE("Game::monsterAttack");
     if (!combatActive || !currentMonster || !player) return "";
 
     int baseDamage = currentMonster->attack;
@@ -421,6 +545,7 @@ QString Game::getCombatResult()
 
 void Game::endCombat()
 {
+    PYRPG_PROFILE_SCOPE("Game::endCombat");
     if (!combatActive) return;
 
     combatActive = false;
@@ -496,6 +621,7 @@ bool Game::rollCritical(int dexterity)
 
 void Game::giveCombatRewards()
 {
+    PYRPG_PROFILE_SCOPE("Game::giveCombatRewards");
     if (!player || !currentMonster) return;
 
     // Store old level to detect level ups
@@ -529,11 +655,11 @@ void Game::giveCombatRewards()
             combatLog += QString("\nFound loot: %1!").arg(loot->name);
             // Notify quest manager about item collection
             if (m_questManager) {
-                m_questManager->onItemCollected(loot->name);
+                m_questManager->onItemCollected(ContentId(loot->name));
             }
             // Unlock lore entry if item has associated lore (Phase 5)
             if (!loot->loreId.isEmpty() && m_codexManager) {
-                m_codexManager->unlockEntry(loot->loreId);
+                m_codexManager->unlockEntry(ContentId(loot->loreId));
             }
         }
     }
@@ -547,21 +673,23 @@ void Game::giveCombatRewards()
             combatLog += QString("\n*** LEGENDARY REWARD: %1 ***").arg(legendary->name);
             // Unlock lore entry if legendary has associated lore (Phase 5)
             if (!legendary->loreId.isEmpty() && m_codexManager) {
-                m_codexManager->unlockEntry(legendary->loreId);
+                m_codexManager->unlockEntry(ContentId(legendary->loreId));
             }
         }
     }
 
     combatLog += QString("\nGained %1 EXP and %2 gold!").arg(expGained).arg(goldGained);
 
+    ContentId enemyName(currentMonster->name);
+
     // Notify quest manager about combat end (for kill quests)
     if (m_questManager) {
-        m_questManager->onCombatEnd(currentMonster->name);
+        m_questManager->onCombatEnd(enemyName);
     }
 
     // Notify codex manager about enemy kill (for lore unlocks) - Phase 3
     if (m_codexManager) {
-        m_codexManager->onEnemyKilled(currentMonster->name);
+        m_codexManager->onEnemyKilled(enemyName);
     }
 }
 
@@ -581,6 +709,7 @@ void Game::checkCombatEndAfterAction()
 // Final Boss Methods
 void Game::startFinalBossCombat()
 {
+    PYRPG_PROFILE_SCOPE("Game::startFinalBossCombat");
     // Clean up existing monster
     if (currentMonster) {
         delete currentMonster;
@@ -9,6 +9,7 @@
 #include "DialogueManager.h"
 #include "StoryManager.h"
 #include "CodexManager.h"
+#include "SearchIndex.h"
 #include <QObject>
 #include <QTime>
 #include <QDateTime>
@@ -27,6 +28,13 @@ QuestManager* getQuestManager();
 DialogueManager* getDialogueManager();
 StoryManager* getStoryManager();
 CodexManager* getCodexManager();
+    // Full-text search over lore, quests, item definitions and dialogue, limited
+    // to content the player has unlocked or seen
+    QList<SearchDocument> searchContent(const QString &query, int maxResults = 50);
+    // Re-reads the content files (ContentDatabase::reload) and refreshes the
+    // managers. Content with errors is rejected and nothing changes. Quest
+    // definitions only apply to new games; quests in progress keep theirs.
+    bool reloadContent(QStringList *errors = nullptr);
 bool saveGame(const QString &filePath);
     bool loadGame(const QString &filePath);
 
@@ -58,6 +66,8 @@ int calculatePlaytimeMinutes() const;
     void clearCombatLogForTesting();
 
 signals:
+    // A new game or a load replaced the player; the previous one is deleted
+    void playerChanged(Player *player);
     void combatEnded(bool playerWon);
     void bossEncountered(const QString &bossName);
     void bossPhaseChanged(int newPhase);
@@ -74,16 +84,21 @@ private:
     DialogueManager *m_dialogueManager;
     StoryManager *m_storyManager;
     CodexManager *m_codexManager;
+    SearchIndex m_searchIndex;
+    bool m_searchIndexStale;  // Catalogs were reloaded since the index was built
     QTime m_gameStartTime;
 
     friend class TestModels;
     friend class TestUtils;
+    friend class BenchCore;
 
     // Combat helpers
     int calculateDamage(int baseDamage, int attackerLevel, int defenderDefense, bool isCritical = false);
     bool rollCritical(int dexterity);
     void giveCombatRewards();
     void checkCombatEndAfterAction();
+    void rebuildSearchIndex();
+    bool isSearchable(const SearchDocument &document) const;
 };
 
 #endif // GAME_H
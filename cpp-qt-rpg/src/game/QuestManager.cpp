@@ -1,4 +1,5 @@
 #include "QuestManager.h"
+#include "../diagnostics/Profiler.h"
 #include "factories/QuestFactory.h"
 #include "factories/ItemFactory.h"
 
@@ -17,6 +18,7 @@ QuestManager::~QuestManager()
 
 void QuestManager::loadQuests()
 {
+    PYRPG_PROFILE_SCOPE("QuestManager::loadQuests");
     qDebug() << "QuestManager::loadQuests() called";
     // Load all main quest definitions
     m_allQuests = QuestFactory::getAllMainQuests();
@@ -25,7 +27,7 @@ void QuestManager::loadQuests()
     // Build quick lookup map
     for (Quest* quest : m_allQuests) {
         if (quest) {
-            m_questMap[quest->questId] = quest;
+            m_questMap[ContentId(quest->questId)] = quest;
         }
     }
 
@@ -38,7 +40,7 @@ void QuestManager::loadQuests()
             qDebug() << "First quest:" << firstQuest->questId << "status:" << firstQuest->status;
             if (firstQuest && firstQuest->status == "available") {
                 qDebug() << "Calling acceptQuest() for" << firstQuest->questId;
-                acceptQuest(firstQuest->questId);
+                acceptQuest(ContentId(firstQuest->questId));
                 qDebug() << "acceptQuest() returned";
             }
         }
@@ -47,8 +49,8 @@ void QuestManager::loadQuests()
         // Sync loaded player quests with our quest definitions
         // Update quest definitions to match player's quest state
         for (Quest* playerQuest : m_player->quests) {
-            if (playerQuest && m_questMap.contains(playerQuest->questId)) {
-                Quest* defQuest = m_questMap[playerQuest->questId];
+            Quest* defQuest = playerQuest ? m_questMap.value(ContentId(playerQuest->questId), nullptr) : nullptr;
+            if (defQuest) {
                 // Copy state from player's quest to our definition
                 defQuest->status = playerQuest->status;
                 defQuest->objectives = playerQuest->objectives;
@@ -56,12 +58,14 @@ void QuestManager::loadQuests()
         }
     }
 
+    indexObjectives();
+
     // Check for newly unlocked quests
     checkQuestUnlocks();
     qDebug() << "QuestManager::loadQuests() completed";
 }
 
-bool QuestManager::acceptQuest(const QString &questId)
+bool QuestManager::acceptQuest(ContentId questId)
 {
     qDebug() << "QuestManager::acceptQuest() called with questId:" << questId;
     Quest* quest = m_questMap.value(questId, nullptr);
@@ -81,14 +85,12 @@ bool QuestManager::acceptQuest(const QString &questId)
     quest->status = "active";
 
     // Add to player's quest list if not already there
-    if (!m_player->getQuest(questId)) {
+    Quest* playerQuest = m_player->getQuest(questId.toString());
+    if (!playerQuest) {
         m_player->addQuest(new Quest(*quest)); // Add copy to player
     } else {
         // Update existing quest in player's list
-        Quest* playerQuest = m_player->getQuest(questId);
-        if (playerQuest) {
-            playerQuest->status = "active";
-        }
+        playerQuest->status = "active";
     }
 
     qDebug() << "QuestManager::acceptQuest() EMITTING questAccepted signal";
@@ -97,7 +99,7 @@ bool QuestManager::acceptQuest(const QString &questId)
     return true;
 }
 
-void QuestManager::updateQuestProgress(const QString &questId, int objIndex, int progress)
+void QuestManager::updateQuestProgress(ContentId questId, int objIndex, int progress)
 {
     Quest* quest = m_questMap.value(questId, nullptr);
     if (!quest || !m_player) {
@@ -105,7 +107,7 @@ void QuestManager::updateQuestProgress(const QString &questId, int objIndex, int
     }
 
     // Also update player's copy
-    Quest* playerQuest = m_player->getQuest(questId);
+    Quest* playerQuest = m_player->getQuest(questId.toString());
     if (!playerQuest) {
         return;
     }
@@ -122,8 +124,9 @@ void QuestManager::updateQuestProgress(const QString &questId, int objIndex, int
     }
 }
 
-void QuestManager::completeQuest(const QString &questId)
+void QuestManager::completeQuest(ContentId questId)
 {
+    PYRPG_PROFILE_SCOPE("QuestManager::completeQuest");
     Quest* quest = m_questMap.value(questId, nullptr);
     if (!quest || !m_player) {
         return;
@@ -141,7 +144,7 @@ void QuestManager::completeQuest(const QString &questId)
 
     // Change status
     quest->status = "completed";
-    Quest* playerQuest = m_player->getQuest(questId);
+    Quest* playerQuest = m_player->getQuest(questId.toString());
     if (playerQuest) {
         playerQuest->status = "completed";
     }
@@ -156,41 +159,28 @@ void QuestManager::completeQuest(const QString &questId)
     checkQuestUnlocks();
 }
 
-Quest* QuestManager::getQuestById(const QString &questId) const
+Quest* QuestManager::getQuestById(ContentId questId) const
 {
     return m_questMap.value(questId, nullptr);
 }
 
-void QuestManager::onCombatEnd(const QString &enemyName)
+void QuestManager::onCombatEnd(ContentId enemyName)
 {
+    PYRPG_PROFILE_SCOPE("QuestManager::onCombatEnd");
     if (!m_player) {
         return;
     }
 
-    // Get active quests from player
-    QList<Quest*> activeQuests = m_player->getActiveQuests();
-
-    // Check each active quest for matching kill objectives
-    for (Quest* playerQuest : activeQuests) {
-        if (!playerQuest) continue;
-
-        for (int i = 0; i < playerQuest->objectives.size(); ++i) {
-            QuestObjective &obj = playerQuest->objectives[i];
-
-            // Check if this objective matches the killed enemy
-            if ((obj.type == "kill_enemies" || obj.type == "defeat_boss") &&
-                QString::compare(obj.targetId, enemyName, Qt::CaseInsensitive) == 0 &&
-                !obj.completed) {
-
-                // Update progress
-                updateQuestProgress(playerQuest->questId, i, 1);
-            }
-        }
+    // Only the kill objectives naming this enemy
+    const QList<ObjectiveRef> objectives = m_killObjectives.value(enemyName.folded());
+    for (const ObjectiveRef &objective : objectives) {
+        advanceObjective(objective);
     }
 }
 
 void QuestManager::onLevelUp(int newLevel)
 {
+    PYRPG_PROFILE_SCOPE("QuestManager::onLevelUp");
     if (!m_player) {
         return;
     }
@@ -211,7 +201,7 @@ void QuestManager::onLevelUp(int newLevel)
                 if (newLevel >= obj.required) {
                     // Set progress to required amount
                     int progressNeeded = obj.required - obj.current;
-                    updateQuestProgress(playerQuest->questId, i, progressNeeded);
+                    updateQuestProgress(ContentId(playerQuest->questId), i, progressNeeded);
                 }
             }
         }
@@ -221,31 +211,17 @@ void QuestManager::onLevelUp(int newLevel)
     checkQuestUnlocks();
 }
 
-void QuestManager::onItemCollected(const QString &itemName)
+void QuestManager::onItemCollected(ContentId itemName)
 {
+    PYRPG_PROFILE_SCOPE("QuestManager::onItemCollected");
     if (!m_player) {
         return;
     }
 
-    // Get active quests from player
-    QList<Quest*> activeQuests = m_player->getActiveQuests();
-
-    // Check each active quest for item collection objectives
-    for (Quest* playerQuest : activeQuests) {
-        if (!playerQuest) continue;
-
-        for (int i = 0; i < playerQuest->objectives.size(); ++i) {
-            QuestObjective &obj = playerQuest->objectives[i];
-
-            // Check if this objective matches the collected item
-            if (obj.type == "collect_item" &&
-                obj.targetId == itemName &&
-                !obj.completed) {
-
-                // Update progress
-                updateQuestProgress(playerQuest->questId, i, 1);
-            }
-        }
+    // Only the collection objectives naming this item
+    const QList<ObjectiveRef> objectives = m_itemObjectives.value(itemName);
+    for (const ObjectiveRef &objective : objectives) {
+        advanceObjective(objective);
     }
 }
 
@@ -289,6 +265,37 @@ QList<Quest*> QuestManager::getLockedQuests() const
 
 // Private helper methods
 
+void QuestManager::indexObjectives()
+{
+    m_killObjectives.clear();
+    m_itemObjectives.clear();
+    for (Quest* quest : m_allQuests) {
+        if (!quest) continue;
+
+        ContentId questId(quest->questId);
+        for (int i = 0; i < quest->objectives.size(); ++i) {
+            const QuestObjective &obj = quest->objectives[i];
+            if (obj.type == "kill_enemies" || obj.type == "defeat_boss") {
+                m_killObjectives[ContentId(obj.targetId).folded()].append({questId, i});
+            } else if (obj.type == "collect_item") {
+                m_itemObjectives[ContentId(obj.targetId)].append({questId, i});
+            }
+        }
+    }
+}
+
+void QuestManager::advanceObjective(const ObjectiveRef &objective)
+{
+    // Progress is tracked on the player's copy of active quests
+    Quest* playerQuest = m_player->getQuest(objective.questId.toString());
+    if (!playerQuest || !playerQuest->isActive() ||
+        objective.index >= playerQuest->objectives.size() ||
+        playerQuest->objectives[objective.index].completed) {
+        return;
+    }
+    updateQuestProgress(objective.questId, objective.index, 1);
+}
+
 void QuestManager::checkQuestUnlocks()
 {
     if (!m_player) {
@@ -319,7 +326,7 @@ void QuestManager::checkQuestUnlocks()
         // If all requirements met, unlock quest
         if (prereqsMet) {
             quest->status = "available";
-            emit questAvailable(quest->questId);
+            emit questAvailable(ContentId(quest->questId));
         }
     }
 }
@@ -3,8 +3,9 @@
 
 #include "../models/Quest.h"
 #include "../models/Player.h"
+#include "ContentId.h"
 #include <QObject>
-#include <QMap>
+#include <QHash>
 #include <QString>
 #include <QDebug>
 
@@ -18,35 +19,48 @@ public:
 
     // Quest management
     void loadQuests();
-    bool acceptQuest(const QString &questId);
-    void updateQuestProgress(const QString &questId, int objIndex, int progress);
-    void completeQuest(const QString &questId);
-    Quest* getQuestById(const QString &questId) const;
+    bool acceptQuest(ContentId questId);
+    void updateQuestProgress(ContentId questId, int objIndex, int progress);
+    void completeQuest(ContentId questId);
+    Quest* getQuestById(ContentId questId) const;
 
-    // Event handlers for automatic quest updates
-    void onCombatEnd(const QString &enemyName);
+    // Event handlers for automatic quest updates; enemies match case-insensitively
+    void onCombatEnd(ContentId enemyName);
     void onLevelUp(int newLevel);
-    void onItemCollected(const QString &itemName);
+    void onItemCollected(ContentId itemName);
 
     // Quest queries
     QList<Quest*> getActiveQuests() const;
     QList<Quest*> getAvailableQuests() const;
     QList<Quest*> getCompletedQuests() const;
     QList<Quest*> getLockedQuests() const;
+    QList<Quest*> getAllQuests() const { return m_allQuests; }
 
 signals:
     // Signals for UI updates
-    void questAvailable(const QString &questId);
-    void questAccepted(const QString &questId);
-    void questProgressed(const QString &questId, int objectiveIndex);
-    void questCompleted(const QString &questId, int expReward, int goldReward);
+    void questAvailable(ContentId questId);
+    void questAccepted(ContentId questId);
+    void questProgressed(ContentId questId, int objectiveIndex);
+    void questCompleted(ContentId questId, int expReward, int goldReward);
 
 private:
+    struct ObjectiveRef {
+        ContentId questId;
+        int index;
+    };
+
     Player* m_player;                   // Reference to player (not owned)
     QList<Quest*> m_allQuests;          // All quest definitions (owned)
-    QMap<QString, Quest*> m_questMap;   // Quick lookup map
+    QHash<ContentId, Quest*> m_questMap;  // Quick lookup map
+    // Objectives by target, so an event only visits the objectives it can
+    // advance: kill_enemies/defeat_boss by folded enemy name, collect_item by
+    // item name. Built from the definitions once loadQuests() has synced them.
+    QHash<ContentId, QList<ObjectiveRef>> m_killObjectives;
+    QHash<ContentId, QList<ObjectiveRef>> m_itemObjectives;
 
     // Helper methods
+    void indexObjectives();
+    void advanceObjective(const ObjectiveRef &objective);
     void checkQuestUnlocks();
     bool checkObjectivesComplete(Quest* quest);
     void giveQuestRewards(Quest* quest);
@@ -0,0 +1,140 @@
+#include "SearchIndex.h"
+#include "../diagnostics/Profiler.h"
+#include <algorithm>
+
+SearchIndex::SearchIndex()
+    : m_termsDirty(false)
+{
+}
+
+QStringList SearchIndex::tokenize(const QString &text)
+{
+    QStringList tokens;
+    QString current;
+    for (QChar ch : text) {
+        if (ch.isLetterOrNumber()) {
+            current.append(ch.toLower());
+        } else if (!current.isEmpty()) {
+            tokens.append(current);
+            current.clear();
+        }
+    }
+    if (!current.isEmpty()) {
+        tokens.append(current);
+    }
+    return tokens;
+}
+
+int SearchIndex::addDocument(const SearchDocument &document)
+{
+    const int id = m_documents.size();
+    m_documents.append(document);
+
+    // One posting per distinct term; a title occurrence wins over the body
+    QHash<QString, bool> terms;
+    for (const QString &term : tokenize(document.title)) {
+        terms.insert(term, true);
+    }
+    for (const QString &term : tokenize(document.body)) {
+        if (!terms.contains(term)) {
+            terms.insert(term, false);
+        }
+    }
+
+    for (auto it = terms.cbegin(); it != terms.cend(); ++it) {
+        QVector<Posting> &postings = m_postings[it.key()];
+        if (postings.isEmpty()) {
+            m_termsDirty = true;
+        }
+        postings.append({id, it.value()});
+    }
+    return id;
+}
+
+void SearchIndex::clear()
+{
+    m_documents.clear();
+    m_postings.clear();
+    m_sortedTerms.clear();
+    m_termsDirty = false;
+}
+
+void SearchIndex::sortTerms() const
+{
+    m_sortedTerms.clear();
+    m_sortedTerms.reserve(m_postings.size());
+    for (auto it = m_postings.cbegin(); it != m_postings.cend(); ++it) {
+        m_sortedTerms.push_back(it.key());
+    }
+    std::sort(m_sortedTerms.begin(), m_sortedTerms.end());
+    m_termsDirty = false;
+}
+
+QList<int> SearchIndex::search(const QString &query, int maxResults, const Filter &filter) const
+{
+    PYRPG_PROFILE_SCOPE("SearchIndex::search");
+    const QStringList words = tokenize(query);
+    if (words.isEmpty() || maxResults <= 0) {
+        return {};
+    }
+    if (m_termsDirty) {
+        sortTerms();
+    }
+
+    // Documents matching every word so far, with their accumulated score
+    QHash<int, int> scores;
+    bool firstWord = true;
+
+    for (const QString &word : words) {
+        QHash<int, int> wordScores;
+        auto term = std::lower_bound(m_sortedTerms.cbegin(), m_sortedTerms.cend(), word);
+        for (; term != m_sortedTerms.cend() && term->startsWith(word); ++term) {
+            const bool exact = (*term == word);
+            const QVector<Posting> &postings = *m_postings.constFind(*term);
+            for (const Posting &posting : postings) {
+                if (!firstWord && !scores.contains(posting.document)) {
+                    continue;
+                }
+                int score = (exact ? 2 : 1) + (posting.inTitle ? 2 : 0);
+                int &best = wordScores[posting.document];
+                best = qMax(best, score);
+            }
+        }
+
+        if (firstWord) {
+            scores = wordScores;
+            firstWord = false;
+        } else {
+            for (auto it = scores.begin(); it != scores.end();) {
+                auto match = wordScores.constFind(it.key());
+                if (match == wordScores.cend()) {
+                    it = scores.erase(it);
+                } else {
+                    it.value() += match.value();
+                    ++it;
+                }
+            }
+        }
+        if (scores.isEmpty()) {
+            return {};
+        }
+    }
+
+    QList<QPair<int, int>> ranked;  // score, document
+    ranked.reserve(scores.size());
+    for (auto it = scores.cbegin(); it != scores.cend(); ++it) {
+        if (!filter || filter(m_documents[it.key()])) {
+            ranked.append({it.value(), it.key()});
+        }
+    }
+    std::sort(ranked.begin(), ranked.end(), [this](const QPair<int, int> &a, const QPair<int, int> &b) {
+        if (a.first != b.first) return a.first > b.first;
+        return m_documents[a.second].title < m_documents[b.second].title;
+    });
+
+    QList<int> results;
+    for (int i = 0; i < ranked.size() && i < maxResults; ++i) {
+        results.append(ranked[i].second);
+    }
+    return results;
+}
@@ -0,0 +1,69 @@
+#ifndef SEARCHINDEX_H
+#define SEARCHINDEX_H
+
+#include "ContentId.h"
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QHash>
+#include <QVector>
+#include <functional>
+#include <vector>
+
+// Searchable piece of game content
+struct SearchDocument
+{
+    enum Kind { Lore, Quest, Item, Dialogue };
+
+    Kind kind;
+    ContentId key;  // Lore entry id, quest id, item name or Player::dialogueNodeKey
+    QString title;
+    QString body;
+};
+
+// In-memory inverted index with prefix matching.
+//
+// Documents are tokenized once when added; each term keeps a posting list of
+// the documents containing it. A query matches documents that contain every
+// query word as a prefix of some term, found by binary search over the sorted
+// term list, so lookups cost O(matching postings) rather than a scan of the
+// catalog. Results are ranked by exact-term and title matches.
+class SearchIndex
+{
+public:
+    using Filter = std::function<bool(const SearchDocument &)>;
+
+    SearchIndex();
+
+    // Returns the document id
+    int addDocument(const SearchDocument &document);
+    void clear();
+
+    int documentCount() const { return m_documents.size(); }
+    int termCount() const { return m_postings.size(); }
+    const SearchDocument &document(int id) const { return m_documents[id]; }
+
+    // Document ids best first; documents rejected by filter are skipped
+    QList<int> search(const QString &query, int maxResults, const Filter &filter = Filter()) const;
+
+    // Lower-cased words of letters and digits
+    static QStringList tokenize(const QString &text);
+
+private:
+    struct Posting
+    {
+        int document;
+        bool inTitle;
+    };
+
+    QList<SearchDocument> m_documents;
+    QHash<QString, QVector<Posting>> m_postings;  // Postings ascending by document
+
+    // Rebuilt on the first query after documents change
+    mutable std::vector<QString> m_sortedTerms;
+    mutable bool m_termsDirty;
+
+    void sortTerms() const;
+};
+
+#endif // SEARCHINDEX_H
@@ -1,4 +1,5 @@
 #include "StoryManager.h"
+#include "../diagnostics/Profiler.h"
 #include "factories/StoryEventFactory.h"
 #include <QDebug>
 
@@ -13,15 +14,32 @@ StoryManager::~StoryManager()
     // Events are managed by factory static cache, don't delete them here
     m_allEvents.clear();
     m_eventMap.clear();
+    m_questStartEvents.clear();
+    m_questCompleteEvents.clear();
+    m_levelEvents.clear();
 }
 
 void StoryManager::loadEvents()
 {
+    PYRPG_PROFILE_SCOPE("StoryManager::loadEvents");
+    // Starts over, so this also picks up a content reload
+    m_allEvents.clear();
+    m_eventMap.clear();
+    m_questStartEvents.clear();
+    m_questCompleteEvents.clear();
+    m_levelEvents.clear();
     QList<StoryEvent*> events = StoryEventFactory::getAllEvents();
     for (StoryEvent* event : events) {
         if (event) {
-            m_eventMap[event->eventId] = event;
+            m_eventMap[ContentId(event->eventId)] = event;
             m_allEvents.append(event);
+            if (event->triggerType == "quest_start") {
+                m_questStartEvents[ContentId(event->triggerId)].append(event);
+            } else if (event->triggerType == "quest_complete") {
+                m_questCompleteEvents[ContentId(event->triggerId)].append(event);
+            } else if (event->triggerType == "level_reached") {
+                m_levelEvents.append(event);
+            }
         }
     }
     qDebug() << "Loaded" << m_allEvents.size() << "story events";
@@ -29,17 +47,15 @@ void StoryManager::loadEvents()
 
 void StoryManager::checkEventTriggers()
 {
-    for (StoryEvent* event : m_allEvents) {
-        if (event->triggerType == "level_reached") {
-            int requiredLevel = event->triggerId.toInt();
-            if (m_player->level >= requiredLevel) {
-                triggerEvent(event->eventId);
-            }
+    for (StoryEvent* event : m_levelEvents) {
+        int requiredLevel = event->triggerId.toInt();
+        if (m_player->level >= requiredLevel) {
+            triggerEvent(ContentId(event->eventId));
         }
     }
 }
 
-void StoryManager::triggerEvent(const QString &eventId)
+void StoryManager::triggerEvent(ContentId eventId)
 {
     qDebug() << "StoryManager::triggerEvent() called with eventId:" << eventId;
     StoryEvent* event = m_eventMap.value(eventId, nullptr);
@@ -49,7 +65,7 @@ void StoryManager::triggerEvent(const QString &eventId)
     }
 
     // Check if already viewed
-    if (m_player->hasViewedEvent(eventId)) {
+    if (m_player->hasViewedEvent(event->eventId)) {
         qDebug() << "Story event already viewed:" << eventId;
         return;
     }
@@ -78,34 +94,32 @@ void StoryManager::triggerEvent(const QString &eventId)
     qDebug() << "eventTriggered signal emitted";
 
     // Mark as viewed
-    m_player->markEventViewed(eventId);
+    m_player->markEventViewed(event->eventId);
     qDebug() << "Event marked as viewed";
 }
 
-void StoryManager::onQuestStarted(const QString &questId)
+void StoryManager::onQuestStarted(ContentId questId)
 {
+    PYRPG_PROFILE_SCOPE("StoryManager::onQuestStarted");
     qDebug() << "StoryManager::onQuestStarted() called with questId:" << questId;
-    qDebug() << "Looking for events with triggerType='quest_start' and triggerId='" << questId << "'";
-    for (StoryEvent* event : m_allEvents) {
-        qDebug() << "  Checking event:" << event->eventId << "triggerType:" << event->triggerType << "triggerId:" << event->triggerId;
-        if (event->triggerType == "quest_start" && event->triggerId == questId) {
-            qDebug() << "  MATCH FOUND! Calling triggerEvent(" << event->eventId << ")";
-            triggerEvent(event->eventId);
-        }
+    const QList<StoryEvent*> events = m_questStartEvents.value(questId);
+    for (StoryEvent* event : events) {
+        qDebug() << "  Triggering" << event->eventId;
+        triggerEvent(ContentId(event->eventId));
     }
-    qDebug() << "StoryManager::onQuestStarted() completed";
 }
 
-void StoryManager::onQuestCompleted(const QString &questId)
+void StoryManager::onQuestCompleted(ContentId questId)
 {
-    for (StoryEvent* event : m_allEvents) {
-        if (event->triggerType == "quest_complete" && event->triggerId == questId) {
-            triggerEvent(event->eventId);
-        }
+    PYRPG_PROFILE_SCOPE("StoryManager::onQuestCompleted");
+    const QList<StoryEvent*> events = m_questCompleteEvents.value(questId);
+    for (StoryEvent* event : events) {
+        triggerEvent(ContentId(event->eventId));
     }
 }
 
 void StoryManager::onLevelReached(int level)
 {
+    PYRPG_PROFILE_SCOPE("StoryManager::onLevelReached");
     checkEventTriggers();
 }
@@ -3,9 +3,10 @@
 
 #include "models/StoryEvent.h"
 #include "models/Player.h"
+#include "ContentId.h"
 #include <QObject>
 #include <QList>
-#include <QMap>
+#include <QHash>
 #include <QString>
 
 class StoryManager : public QObject
@@ -19,11 +20,11 @@ public:
     // Event management
     void loadEvents();
     void checkEventTriggers();
-    void triggerEvent(const QString &eventId);
+    void triggerEvent(ContentId eventId);
 
     // Event handlers (connected to quest/game signals)
-    void onQuestStarted(const QString &questId);
-    void onQuestCompleted(const QString &questId);
+    void onQuestStarted(ContentId questId);
+    void onQuestCompleted(ContentId questId);
     void onLevelReached(int level);
 
 signals:
@@ -32,7 +33,11 @@ signals:
 private:
     Player* m_player;  // Reference, not owned
     QList<StoryEvent*> m_allEvents;  // All events, owned by factory
-    QMap<QString, StoryEvent*> m_eventMap;  // Quick lookup
+    QHash<ContentId, StoryEvent*> m_eventMap;  // Quick lookup
+    // Events by trigger, in content order
+    QHash<ContentId, QList<StoryEvent*>> m_questStartEvents;     // By quest id
+    QHash<ContentId, QList<StoryEvent*>> m_questCompleteEvents;  // By quest id
+    QList<StoryEvent*> m_levelEvents;
 };
 
 #endif // STORYMANAGER_H
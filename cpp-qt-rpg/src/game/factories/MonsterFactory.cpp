@@ -1,103 +1,41 @@
 #include "MonsterFactory.h"
 #include "MonsterTypeRegistry.h"
+#include "../ContentDatabase.h"
 #include <QRandomGenerator>
 #include <QStringList>
 
+namespace {
+
+// Stats the template leaves out keep the Monster constructor's defaults
+Monster* fromTemplate(const ContentDatabase::MonsterTemplate &monsterTemplate, int level)
+{
+    Monster* m = new Monster(monsterTemplate.name, level, monsterTemplate.spriteType);
+    if (monsterTemplate.health.isSet) {
+        m->health = monsterTemplate.health.at(level);
+        m->maxHealth = m->health;
+    }
+    if (monsterTemplate.attack.isSet) m->attack = monsterTemplate.attack.at(level);
+    if (monsterTemplate.defense.isSet) m->defense = monsterTemplate.defense.at(level);
+    if (monsterTemplate.magicAttack.isSet) m->magicAttack = monsterTemplate.magicAttack.at(level);
+    if (monsterTemplate.experience.isSet) m->expReward = monsterTemplate.experience.at(level);
+    if (monsterTemplate.gold.isSet) m->goldReward = monsterTemplate.gold.at(level);
+    return m;
+}
+
+} // namespace
+
+// Monsters, bosses and encounter weights are defined in content/monsters.json
+
 Monster* MonsterFactory::createMonster(const QString &monsterType, int playerLevel)
 {
-    int level = playerLevel + QRandomGenerator::global()->bounded(-1, 2); // ±1 level variation
+    const ContentDatabase &content = ContentDatabase::instance();
+    int variance = content.levelVariance();
+    int level = playerLevel + QRandomGenerator::global()->bounded(-variance, variance + 1);
     if (level < 1) level = 1;
 
-    if (monsterType == "Goblin" || monsterType == "goblin") {
-        Monster* m = new Monster("Goblin", level, "goblin");
-        m->health = 40 + (level * 10);
-        m->maxHealth = m->health;
-        m->attack = 6 + (level * 2);
-        m->defense = 2 + level;
-        m->expReward = level * 20;
-        m->goldReward = level * 8;
-        return m;
-    }
-    else if (monsterType == "Orc" || monsterType == "orc") {
-        Monster* m = new Monster("Orc", level, "orc");
-        m->health = 60 + (level * 15);
-        m->maxHealth = m->health;
-        m->attack = 10 + (level * 3);
-        m->defense = 5 + (level * 2);
-        m->expReward = level * 30;
-        m->goldReward = level * 12;
-        return m;
-    }
-    else if (monsterType == "Golem" || monsterType == "golem") {
-        Monster* m = new Monster("Stone Golem", level, "golem");
-        m->health = 80 + (level * 20);
-        m->maxHealth = m->health;
-        m->attack = 8 + (level * 2);
-        m->defense = 10 + (level * 3);
-        m->expReward = level * 35;
-        m->goldReward = level * 10;
-        return m;
-    }
-    else if (monsterType == "Skeleton") {
-        Monster* m = new Monster("Skeleton Warrior", level, "skeleton");
-        m->health = 50 + (level * 12);
-        m->maxHealth = m->health;
-        m->attack = 8 + (level * 2);
-        m->defense = 3 + level;
-        m->expReward = level * 25;
-        m->goldReward = level * 15;
-        return m;
-    }
-    else if (monsterType == "Bandit") {
-        Monster* m = new Monster("Bandit", level, "bandit");
-        m->health = 45 + (level * 11);
-        m->maxHealth = m->health;
-        m->attack = 9 + (level * 2);
-        m->defense = 4 + level;
-        m->expReward = level * 22;
-        m->goldReward = level * 20; // Bandits drop more gold
-        return m;
-    }
-    else if (monsterType == "Wolf") {
-        Monster* m = new Monster("Wild Wolf", level, "wolf");
-        m->health = 35 + (level * 9);
-        m->maxHealth = m->health;
-        m->attack = 7 + (level * 2);
-        m->defense = 2 + level;
-        m->expReward = level * 18;
-        m->goldReward = level * 5;
-        return m;
-    }
-    else if (monsterType == "Spider") {
-        Monster* m = new Monster("Giant Spider", level, "spider");
-        m->health = 30 + (level * 8);
-        m->maxHealth = m->health;
-        m->attack = 6 + (level * 2);
-        m->defense = 1 + level;
-        m->magicAttack = 4 + level;
-        m->expReward = level * 20;
-        m->goldReward = level * 6;
-        return m;
-    }
-    else if (monsterType == "Slime") {
-        Monster* m = new Monster("Slime", level, "slime");
-        m->health = 25 + (level * 10);
-        m->maxHealth = m->health;
-        m->attack = 4 + level;
-        m->defense = 8 + (level * 2); // High defense, low attack
-        m->expReward = level * 15;
-        m->goldReward = level * 4;
-        return m;
-    }
-    else if (monsterType == "Shadow Wolf" || monsterType == "shadow_wolf") {
-        Monster* m = new Monster("Shadow Wolf", level, "wolf");
-        m->health = 35 + (level * 9);
-        m->maxHealth = m->health;
-        m->attack = 7 + (level * 2);
-        m->defense = 2 + level;
-        m->expReward = level * 18;
-        m->goldReward = level * 5;
-        return m;
+    const ContentDatabase::MonsterTemplate *monsterTemplate = content.monster(monsterType);
+    if (monsterTemplate) {
+        return fromTemplate(*monsterTemplate, level);
     }
 
     // Default fallback
@@ -106,61 +44,44 @@ Monster* MonsterFactory::createMonster(const QString &monsterType, int playerLev
 
 Monster* MonsterFactory::createRandomMonster(int playerLevel)
 {
-    QStringList commonMonsters = {"Goblin", "Wolf", "Slime", "Spider"};
-    QStringList uncommonMonsters = {"Bandit", "Skeleton", "Orc"};
-    QStringList rareMonsters = {"Golem"};
+    const QList<ContentDatabase::EncounterTier> &tiers = ContentDatabase::instance().encounterTiers();
 
-    int roll = QRandomGenerator::global()->bounded(100);
-
-    QString monsterType;
-    if (roll < 60) {
-        // 60% common
-        monsterType = commonMonsters.at(QRandomGenerator::global()->bounded(commonMonsters.size()));
-    }
-    else if (roll < 90) {
-        // 30% uncommon
-        monsterType = uncommonMonsters.at(QRandomGenerator::global()->bounded(uncommonMonsters.size()));
+    int totalWeight = 0;
+    for (const ContentDatabase::EncounterTier &tier : tiers) {
+        totalWeight += tier.weight;
     }
-    else {
-        // 10% rare
-        monsterType = rareMonsters.at(QRandomGenerator::global()->bounded(rareMonsters.size()));
+
+    // Pick a tier by weight, then a monster in it
+    int roll = QRandomGenerator::global()->bounded(totalWeight);
+    const ContentDatabase::EncounterTier *chosen = &tiers.last();
+    for (const ContentDatabase::EncounterTier &tier : tiers) {
+        if (roll < tier.weight) {
+            chosen = &tier;
+            break;
+        }
+        roll -= tier.weight;
     }
 
+    QString monsterType = chosen->monsterIds.at(QRandomGenerator::global()->bounded(chosen->monsterIds.size()));
     return createMonster(monsterType, playerLevel);
 }
 
 Monster* MonsterFactory::createBoss(int playerLevel, const QString &bossType)
 {
-    int bossLevel = playerLevel + 2;
+    const ContentDatabase &content = ContentDatabase::instance();
+    int bossLevel = playerLevel + content.bossLevelOffset();
 
     // Support quest-specific boss
-    if (bossType == "Shadow Lord" || bossType == "shadow_lord") {
-        Monster* boss = new Monster("Shadow Lord", bossLevel, "boss");
-        boss->health = 150 + (bossLevel * 30);
-        boss->maxHealth = boss->health;
-        boss->attack = 15 + (bossLevel * 4);
-        boss->defense = 10 + (bossLevel * 3);
-        boss->magicAttack = 8 + (bossLevel * 2);
-        boss->expReward = bossLevel * 100;
-        boss->goldReward = bossLevel * 50;
-        return boss;
+    const ContentDatabase::MonsterTemplate *boss = content.boss(bossType);
+    if (!boss) {
+        boss = content.defaultBoss();
     }
-
-    // Default to existing behavior
-    Monster* boss = new Monster("Orc Chieftain", bossLevel, "boss");
-    boss->health = 150 + (bossLevel * 30);
-    boss->maxHealth = boss->health;
-    boss->attack = 15 + (bossLevel * 4);
-    boss->defense = 10 + (bossLevel * 3);
-    boss->magicAttack = 8 + (bossLevel * 2);
-    boss->expReward = bossLevel * 100;
-    boss->goldReward = bossLevel * 50;
-    return boss;
+    return fromTemplate(*boss, bossLevel);
 }
 
 FinalBoss* MonsterFactory::createFinalBoss(int playerLevel, const QString &bossType)
 {
-    QString finalBossName = "The Eternal Shadow";
+    QString finalBossName = ContentDatabase::instance().finalBossName();
     if (!bossType.isEmpty()) {
         finalBossName = bossType;
     }
@@ -177,3 +98,18 @@ QStringList MonsterFactory::getAllValidMonsterTypes()
 {
     return MonsterTypeRegistry::getAllValidTypeNames();
 }
+
+QStringList MonsterFactory::getAllSpriteTypes()
+{
+    const ContentDatabase &content = ContentDatabase::instance();
+    QStringList types;
+    for (const QList<ContentDatabase::MonsterTemplate> *list : {&content.monsters(), &content.bosses()}) {
+        for (const ContentDatabase::MonsterTemplate &monsterTemplate : *list) {
+            if (!types.contains(monsterTemplate.spriteType)) {
+                types.append(monsterTemplate.spriteType);
+            }
+        }
+    }
+    types.append("final_boss");  // FinalBoss sets its own type
+    return types;
+}
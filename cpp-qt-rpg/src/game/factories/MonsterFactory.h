@@ -16,6 +16,9 @@ public:
     // Validation methods
     static bool isValidMonsterType(const QString &monsterType);
     static QStringList getAllValidMonsterTypes();
+
+    // Every Monster::enemyType the factory hands out; sprites live at :/assets/<type>.png
+    static QStringList getAllSpriteTypes();
 };
 
 #endif // MONSTERFACTORY_H
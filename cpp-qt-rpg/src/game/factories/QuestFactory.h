@@ -12,9 +12,12 @@ public:
     // Create a specific quest by ID
     static Quest* createQuest(const QString &questId);
 
-    // Get all main story quests
+    // Get all main story quests (fresh copies; the caller owns and mutates them)
     static QList<Quest*> getAllMainQuests();
 
+    // Definitions the copies above are made from, owned by ContentDatabase
+    static const QList<Quest> &getMainQuestTemplates();
+
     // Get quests available for a player (based on level and prerequisites)
     static QList<Quest*> getAvailableQuests(Player* player);
 
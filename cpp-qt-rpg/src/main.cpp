@@ -1,7 +1,10 @@
 #include <QApplication>
-#include <QFile>
-#include <QTextStream>
+#include <QDebug>
 #include "MainWindow.h"
+#include "theme/StyleSheet.h"
+#include "diagnostics/Profiler.h"
+#include "diagnostics/Tracer.h"
+#include "diagnostics/StallWatchdog.h"
 
 int main(int argc, char *argv[])
 {
@@ -12,17 +15,43 @@ int main(int argc, char *argv[])
     app.setOrganizationName("Gemini");
     app.setApplicationVersion("1.0");
 
-    // Load and apply the stylesheet from the Qt Resource System
-    QFile file(":/assets/styles.qss");
-    if (file.open(QFile::ReadOnly | QFile::Text)) {
-        QTextStream stream(&file);
-        QString styleSheet = stream.readAll();
-        app.setStyleSheet(styleSheet);
-        file.close();
+    // One generated stylesheet for the whole app; widgets select rules by role (see StyleSheet.h)
+    Theme::applyApplicationTheme(app);
+
+    // PYRPG_TRACE=<file.json> records a trace from startup and writes it on exit,
+    // unless F4 stopped (and wrote) the capture first
+    QString startupTracePath = qEnvironmentVariable("PYRPG_TRACE");
+    if (!startupTracePath.isEmpty() && !Profiler::isEnabled()) {
+        qWarning() << "PYRPG_TRACE ignored: built without PYRPG_PROFILING";
+    } else if (!startupTracePath.isEmpty()) {
+        TraceInputFilter *traceInputFilter = new TraceInputFilter(&app);
+        app.installEventFilter(traceInputFilter);
+        Tracer::instance().setEnabled(true);
+        QObject::connect(&app, &QCoreApplication::aboutToQuit, [&app, traceInputFilter, startupTracePath]() {
+            app.removeEventFilter(traceInputFilter);
+            Tracer &tracer = Tracer::instance();
+            if (!tracer.isCapturing()) {
+                return;
+            }
+            tracer.setEnabled(false);
+            if (!tracer.writeChromeTrace(startupTracePath)) {
+                qWarning() << "Failed to write trace to" << startupTracePath;
+            }
+        });
     }
 
     MainWindow window;
     window.show();
 
-    return app.exec();
+    // Record event-loop hitches from real sessions (see StallWatchdog.h)
+    StallWatchdog *stallWatchdog = nullptr;
+    int stallThresholdMs = StallWatchdog::configuredThresholdMs();
+    if (stallThresholdMs > 0) {
+        stallWatchdog = new StallWatchdog(stallThresholdMs);
+        stallWatchdog->start(QThread::LowPriority);
+    }
+
+    int result = app.exec();
+    delete stallWatchdog;
+    return result;
 }
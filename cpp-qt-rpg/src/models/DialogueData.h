@@ -5,6 +5,7 @@
 #include <QList>
 #include <QMap>
 #include <QDataStream>
+#include "../diagnostics/AllocationTracker.h"
 
 // Effect applied when a dialogue choice is selected
 struct DialogueEffect {
@@ -41,6 +42,7 @@ struct DialogueNode {
 // Complete dialogue tree with all nodes
 class DialogueTree {
 public:
+    PYRPG_TRACK_ALLOCATIONS("models.DialogueTree")
     QString id;                        // "elder_intro"
     QString npcName;                   // "Village Elder"
     QString startNodeId;               // "greeting"
@@ -3,10 +3,12 @@
 
 #include <QString>
 #include <QDataStream>
+#include "../diagnostics/AllocationTracker.h"
 
 class Item
 {
 public:
+    PYRPG_TRACK_ALLOCATIONS("models.Item")
     Item();
     Item(const QString &name, const QString &itemType, const QString &rarity = "common",
          const QString &slot = "", int attackBonus = 0, int defenseBonus = 0,
@@ -2,9 +2,12 @@
 #define LOREENTRY_H
 
 #include <QString>
+#include "../diagnostics/AllocationTracker.h"
 
 // Lore codex entry for world-building
 struct LoreEntry {
+    PYRPG_TRACK_ALLOCATIONS("models.LoreEntry")
+
     QString entryId;              // "bestiary_goblin", "world_ancient_war"
     QString category;             // "Bestiary", "Items", "World", "Characters", "Locations"
     QString title;                // "Goblin"
@@ -3,10 +3,12 @@
 
 #include "Character.h"
 #include <QString>
+#include "../diagnostics/AllocationTracker.h"
 
 class Monster : public Character
 {
 public:
+    PYRPG_TRACK_ALLOCATIONS("models.Monster")
     Monster(const QString &name, int level, const QString &enemyType = "normal");
 
     QString enemyType;
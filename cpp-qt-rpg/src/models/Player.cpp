@@ -1,6 +1,53 @@
 #include "Player.h"
 #include <algorithm>
 #include <QDebug>
+#include <QtEndian>
+
+namespace {
+
+// Writes a pointer list in the same layout as QList<T> (quint32 count, then
+// elements), skipping null entries, without copying into a temporary list.
+template <typename T>
+void writePointerList(QDataStream &out, const QList<T*> &list)
+{
+    quint32 count = 0;
+    for (const T *element : list) {
+        if (element != nullptr) {
+            count++;
+        }
+    }
+    out << count;
+    for (const T *element : list) {
+        if (element != nullptr) {
+            out << *element;
+        }
+    }
+}
+
+// Reads a QList<T> layout and appends each element straight into its final
+// heap allocation. Stops at the first stream error.
+template <typename T>
+void readPointerList(QDataStream &in, QList<T*> &list)
+{
+    quint32 count = 0;
+    in >> count;
+    if (in.status() != QDataStream::Ok) {
+        return;
+    }
+    // Bound the reservation so a corrupt count cannot trigger a huge allocation
+    list.reserve(list.size() + qMin<quint32>(count, 4096));
+    for (quint32 i = 0; i < count; ++i) {
+        T *element = new T();
+        in >> *element;
+        if (in.status() != QDataStream::Ok) {
+            delete element;
+            break;
+        }
+        list.append(element);
+    }
+}
+
+} // namespace
 
 Player::Player(const QString &name, const QString &characterClass)
     : Character(name, 1, 100, 100), // Base stats for a new player
@@ -62,64 +109,89 @@ Player::~Player()
     equipment.clear();
 }
 
-QDataStream &operator<<(QDataStream &out, const Player &p)
+void Player::writeSaveSection(QDataStream &out, SaveSection section, quint32 formatVersion) const
 {
-    // Version 5: Added game completion tracking
-    out << quint32(5);
-
-    // Serialize base class
-    out << static_cast<const Character&>(p);
-    // Serialize Player members
-    out << p.characterClass;
-    out << p.mana << p.maxMana << p.strength << p.dexterity << p.intelligence << p.vitality;
-    out << p.gold << p.experience << p.experienceToLevel << p.skillPoints << p.statPoints;
-
-    // Serialize equipment: only non-null items
-    QMap<QString, Item> eq;
-    for (auto it = p.equipment.begin(); it != p.equipment.end(); ++it) {
-        if (it.value() != nullptr) {
-            eq[it.key()] = *it.value();
+    switch (section) {
+    case SaveSection::Core:
+        // Version 1 had no version prefix and no character class
+        if (formatVersion >= 2) {
+            out << formatVersion;
         }
-    }
-    out << eq;
 
-    // Serialize inventory
-    QList<Item> inv;
-    for (Item* item : p.inventory) {
-        if (item != nullptr) {
-            inv.append(*item);
+        // Serialize base class
+        out << static_cast<const Character&>(*this);
+        // Serialize Player members
+        if (formatVersion >= 2) {
+            out << characterClass;
+        }
+        out << mana << maxMana << strength << dexterity << intelligence << vitality;
+        out << gold << experience << experienceToLevel << skillPoints << statPoints;
+        break;
+
+    case SaveSection::Inventory: {
+        // Serialize equipment: only non-null items
+        // Containers are streamed straight from the live pointers; the layout
+        // (count followed by elements) matches QMap<QString, Item>/QList<T>.
+        quint32 equippedCount = 0;
+        for (auto it = equipment.cbegin(); it != equipment.cend(); ++it) {
+            if (it.value() != nullptr) {
+                equippedCount++;
+            }
         }
+        out << equippedCount;
+        for (auto it = equipment.cbegin(); it != equipment.cend(); ++it) {
+            if (it.value() != nullptr) {
+                out << it.key() << *it.value();
+            }
+        }
+
+        // Serialize inventory
+        writePointerList(out, inventory);
+        break;
     }
-    out << inv;
 
-    // Serialize skills
-    QList<Skill> skillList;
-    for (Skill* skill : p.skills) {
-        if (skill != nullptr) {
-            skillList.append(*skill);
+    case SaveSection::Skills:
+        writePointerList(out, skills);
+        break;
+
+    case SaveSection::Quests:
+        // Serialize quests (version 3+)
+        if (formatVersion >= 3) {
+            writePointerList(out, quests);
+        }
+        break;
+
+    case SaveSection::Narrative:
+        // Serialize narrative tracking (version 4+)
+        if (formatVersion >= 4) {
+            out << viewedDialogueIds;
+            out << viewedEventIds;
+            out << unlockedLoreEntries;
         }
-    }
-    out << skillList;
 
-    // Serialize quests (version 3+)
-    QList<Quest> questList;
-    for (Quest* quest : p.quests) {
-        if (quest != nullptr) {
-            questList.append(*quest);
+        // Serialize game completion tracking (version 5+)
+        if (formatVersion >= 5) {
+            out << hasDefeatedFinalBoss;
+            out << gameCompletionTime;
+            out << finalGameLevel;
         }
+        break;
     }
-    out << questList;
-
-    // Serialize narrative tracking (version 4+)
-    out << p.viewedDialogueIds;
-    out << p.viewedEventIds;
-    out << p.unlockedLoreEntries;
+}
 
-    // Serialize game completion tracking (version 5+)
-    out << p.hasDefeatedFinalBoss;
-    out << p.gameCompletionTime;
-    out << p.finalGameLevel;
+void Player::writeSaveData(QDataStream &out, quint32 formatVersion) const
+{
+    // Sections are written in stream order; concatenating them yields the full save layout
+    writeSaveSection(out, SaveSection::Core, formatVersion);
+    writeSaveSection(out, SaveSection::Inventory, formatVersion);
+    writeSaveSection(out, SaveSection::Skills, formatVersion);
+    writeSaveSection(out, SaveSection::Quests, formatVersion);
+    writeSaveSection(out, SaveSection::Narrative, formatVersion);
+}
 
+QDataStream &operator<<(QDataStream &out, const Player &p)
+{
+    p.writeSaveData(out, Player::CURRENT_SAVE_VERSION);
     return out;
 }
 
@@ -130,23 +202,43 @@ QDataStream &operator>>(QDataStream &in, Player &p)
     quint32 possibleVersion;
     in >> possibleVersion;
 
-    // Check if this is a version number or old format data
-    // Version numbers will be small (1, 2, 3...), old Character data will be large
-    if (possibleVersion <= 100) {
+    // Versioned saves start with their version number. Legacy saves (version 1)
+    // started directly with the Character name, whose QString length prefix is a
+    // UTF-16 byte count (always even) or 0xFFFFFFFF for a null string. Odd
+    // versions can never collide; 2 and 4 stay ambiguous with 1-2 character
+    // legacy names and are read as versioned saves.
+    if (possibleVersion >= 1 && possibleVersion <= Player::CURRENT_SAVE_VERSION) {
         version = possibleVersion;
+
+        // Deserialize base class
+        in >> static_cast<Character&>(p);
     } else {
-        // This is old format (version 1) without version number
-        // possibleVersion is actually the first field of Character
-        // We need to handle this as legacy data
+        // Legacy format (version 1): possibleVersion is the name's length prefix
         version = 1;
-        // Note: In a real implementation, we'd need to carefully handle this
-        // For now, we'll assume all saves are version 2
-        qWarning() << "Attempting to load legacy save format - may not work correctly";
+        if (possibleVersion == 0xFFFFFFFF) {
+            p.name = QString();
+        } else if (possibleVersion % 2 != 0 || possibleVersion > 0x10000) {
+            qWarning() << "Unrecognized player save format, length prefix:" << possibleVersion;
+            in.setStatus(QDataStream::ReadCorruptData);
+            return in;
+        } else {
+            QByteArray raw(possibleVersion, Qt::Uninitialized);
+            if (in.readRawData(raw.data(), raw.size()) != raw.size()) {
+                in.setStatus(QDataStream::ReadPastEnd);
+                return in;
+            }
+            QString name(raw.size() / 2, Qt::Uninitialized);
+            for (int i = 0; i < name.size(); ++i) {
+                // QDataStream stores UTF-16 code units in the stream's byte order
+                const char *unit = raw.constData() + i * 2;
+                name[i] = QChar(in.byteOrder() == QDataStream::BigEndian
+                                    ? qFromBigEndian<quint16>(unit) : qFromLittleEndian<quint16>(unit));
+            }
+            p.name = name;
+        }
+        in >> p.level >> p.health >> p.maxHealth;
     }
 
-    // Deserialize base class
-    in >> static_cast<Character&>(p);
-
     // Deserialize Player members based on version
     if (version >= 2) {
         in >> p.characterClass;
@@ -154,11 +246,19 @@ QDataStream &operator>>(QDataStream &in, Player &p)
     in >> p.mana >> p.maxMana >> p.strength >> p.dexterity >> p.intelligence >> p.vitality;
     in >> p.gold >> p.experience >> p.experienceToLevel >> p.skillPoints >> p.statPoints;
 
-    // Deserialize equipment
-    QMap<QString, Item> eq;
-    in >> eq;
-    for (auto it = eq.begin(); it != eq.end(); ++it) {
-        p.equipment[it.key()] = new Item(it.value());
+    // Deserialize equipment directly into the owning slots
+    quint32 equippedCount = 0;
+    in >> equippedCount;
+    for (quint32 i = 0; i < equippedCount && in.status() == QDataStream::Ok; ++i) {
+        QString slot;
+        Item *item = new Item();
+        in >> slot >> *item;
+        if (in.status() != QDataStream::Ok) {
+            delete item;
+            break;
+        }
+        delete p.equipment.value(slot, nullptr);
+        p.equipment[slot] = item;
     }
     // Ensure slots are initialized if not present
     if (!p.equipment.contains("weapon")) p.equipment["weapon"] = nullptr;
@@ -166,26 +266,14 @@ QDataStream &operator>>(QDataStream &in, Player &p)
     if (!p.equipment.contains("accessory")) p.equipment["accessory"] = nullptr;
 
     // Deserialize inventory
-    QList<Item> inv;
-    in >> inv;
-    for (const Item &item : inv) {
-        p.inventory.append(new Item(item));
-    }
+    readPointerList(in, p.inventory);
 
     // Deserialize skills
-    QList<Skill> skillList;
-    in >> skillList;
-    for (const Skill &skill : skillList) {
-        p.skills.append(new Skill(skill));
-    }
+    readPointerList(in, p.skills);
 
     // Deserialize quests (version 3+)
     if (version >= 3) {
-        QList<Quest> questList;
-        in >> questList;
-        for (const Quest &quest : questList) {
-            p.quests.append(new Quest(quest));
-        }
+        readPointerList(in, p.quests);
     }
     // For version < 3, p.quests remains empty (default constructed)
 
@@ -410,6 +498,21 @@ void Player::markDialogueViewed(const QString &dialogueId)
     }
 }
 
+QString Player::dialogueNodeKey(const QString &dialogueId, const QString &nodeId)
+{
+    return dialogueId + "/" + nodeId;
+}
+
+bool Player::hasViewedDialogueNode(const QString &dialogueId, const QString &nodeId) const
+{
+    return viewedDialogueIds.contains(dialogueNodeKey(dialogueId, nodeId));
+}
+
+void Player::markDialogueNodeViewed(const QString &dialogueId, const QString &nodeId)
+{
+    markDialogueViewed(dialogueNodeKey(dialogueId, nodeId));
+}
+
 void Player::markEventViewed(const QString &eventId)
 {
     if (!viewedEventIds.contains(eventId)) {
@@ -8,10 +8,12 @@
 #include <QList>
 #include <QMap>
 #include <QDataStream>
+#include "../diagnostics/AllocationTracker.h"
 
 class Player : public Character
 {
 public:
+    PYRPG_TRACK_ALLOCATIONS("models.Player")
     explicit Player(const QString &name, const QString &characterClass = "Hero");
     ~Player();  // Destructor to clean up dynamically allocated memory
 
@@ -27,7 +29,7 @@ public:
     QList<Quest*> quests;
 
     // Narrative tracking (Phase 3)
-    QList<QString> viewedDialogueIds;      // Track completed unique dialogues
+    QList<QString> viewedDialogueIds;      // Track completed unique dialogues, and each node shown (see dialogueNodeKey)
     QList<QString> viewedEventIds;         // Track viewed story events
     QList<QString> unlockedLoreEntries;    // Track discovered lore
 
@@ -62,6 +64,10 @@ public:
     bool hasUnlockedLore(const QString &entryId) const;
     QList<QString> getUnlockedLoreEntries() const;
     void markDialogueViewed(const QString &dialogueId);
+    // Nodes are kept in viewedDialogueIds under "dialogueId/nodeId", so saves need no new format version
+    static QString dialogueNodeKey(const QString &dialogueId, const QString &nodeId);
+    bool hasViewedDialogueNode(const QString &dialogueId, const QString &nodeId) const;
+    void markDialogueNodeViewed(const QString &dialogueId, const QString &nodeId);
     void markEventViewed(const QString &eventId);
     void unlockLore(const QString &entryId);
 
@@ -76,6 +82,24 @@ public:
     int getTotalAttack() const;
     int getTotalDefense() const;
 
+    // Version 5: Added game completion tracking
+    static const quint32 CURRENT_SAVE_VERSION = 5;
+
+    // Serialization sections, in stream order. Concatenating every section
+    // produces exactly what operator<< writes (used by SaveHistory chunking).
+    enum class SaveSection {
+        Core,       // version, character stats and progression
+        Inventory,  // equipment and inventory items
+        Skills,
+        Quests,
+        Narrative   // viewed dialogues/events, lore and completion tracking
+    };
+    void writeSaveSection(QDataStream &out, SaveSection section,
+                          quint32 formatVersion = CURRENT_SAVE_VERSION) const;
+
+    // Writes the whole player in an older or current format (used by pyrpg-savetool)
+    void writeSaveData(QDataStream &out, quint32 formatVersion = CURRENT_SAVE_VERSION) const;
+
     friend QDataStream &operator<<(QDataStream &out, const Player &p);
     friend QDataStream &operator>>(QDataStream &in, Player &p);
 };
@@ -4,6 +4,7 @@
 #include <QString>
 #include <QList>
 #include <QDataStream>
+#include "../diagnostics/AllocationTracker.h"
 
 // Quest objective structure
 struct QuestObjective {
@@ -32,6 +33,7 @@ struct QuestRewards {
 class Quest
 {
 public:
+    PYRPG_TRACK_ALLOCATIONS("models.Quest")
     // Constructors
     Quest();
     Quest(const QString &id, const QString &title, const QString &description = "",
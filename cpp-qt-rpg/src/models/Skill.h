@@ -3,10 +3,12 @@
 
 #include <QString>
 #include <QDataStream>
+#include "../diagnostics/AllocationTracker.h"
 
 class Skill
 {
 public:
+    PYRPG_TRACK_ALLOCATIONS("models.Skill")
     Skill(const QString &name = "", const QString &skillType = "", int damage = 0, int manaCost = 0, const QString &description = "");
 
     QString name;
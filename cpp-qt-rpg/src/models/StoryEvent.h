@@ -3,9 +3,12 @@
 
 #include <QString>
 #include <QList>
+#include "../diagnostics/AllocationTracker.h"
 
 // Story event/cutscene for narrative moments
 struct StoryEvent {
+    PYRPG_TRACK_ALLOCATIONS("models.StoryEvent")
+
     QString eventId;               // "intro_cutscene", "quest_01_complete"
     QString title;                 // "A Dark Omen"
     QString eventText;             // Multi-line narrative text
@@ -0,0 +1,344 @@
+#include "SaveHistory.h"
+#include "../models/Player.h"
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <algorithm>
+#include <functional>
+
+namespace {
+
+const QString HISTORY_MAGIC = "PYRPG_HISTORY";
+const quint32 HISTORY_VERSION = 1;
+
+// Stream order of the chunks making up one snapshot
+const QList<Player::SaveSection> SNAPSHOT_SECTIONS = {
+    Player::SaveSection::Core,
+    Player::SaveSection::Inventory,
+    Player::SaveSection::Skills,
+    Player::SaveSection::Quests,
+    Player::SaveSection::Narrative
+};
+
+} // namespace
+
+SaveHistory::SaveHistory(const QString &savesDirectory)
+    : m_historyDir(savesDirectory + "/history")
+{
+}
+
+QString SaveHistory::chunksDirectory() const
+{
+    return m_historyDir + "/chunks";
+}
+
+QString SaveHistory::slotDirectory(int slotNumber) const
+{
+    return m_historyDir + QString("/slot_%1").arg(slotNumber);
+}
+
+QString SaveHistory::chunkFilePath(const QByteArray &hash) const
+{
+    return chunksDirectory() + "/" + QString::fromLatin1(hash) + ".chunk";
+}
+
+QString SaveHistory::manifestFilePath(int slotNumber, const QString &snapshotId) const
+{
+    return slotDirectory(slotNumber) + "/" + snapshotId + ".snap";
+}
+
+QByteArray SaveHistory::storeChunk(const QByteArray &data)
+{
+    QByteArray hash = QCryptographicHash::hash(data, QCryptographicHash::Sha1).toHex();
+    QString filePath = chunkFilePath(hash);
+
+    // Identical content is already stored: this is where snapshots share space
+    if (QFile::exists(filePath)) {
+        return hash;
+    }
+
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Could not open history chunk for writing:" << filePath;
+        return QByteArray();
+    }
+    file.write(qCompress(data));
+    if (!file.commit()) {
+        qWarning() << "Could not write history chunk:" << filePath;
+        return QByteArray();
+    }
+    return hash;
+}
+
+QByteArray SaveHistory::readChunk(const QByteArray &hash) const
+{
+    QFile file(chunkFilePath(hash));
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Missing history chunk:" << hash;
+        return QByteArray();
+    }
+    QByteArray data = qUncompress(file.readAll());
+    file.close();
+
+    // Guard against corrupted chunks silently producing a bad save
+    if (QCryptographicHash::hash(data, QCryptographicHash::Sha1).toHex() != hash) {
+        qWarning() << "History chunk failed verification:" << hash;
+        return QByteArray();
+    }
+    return data;
+}
+
+QList<QByteArray> SaveHistory::serializeSections(const Player *player)
+{
+    QList<QByteArray> sections;
+    for (Player::SaveSection section : SNAPSHOT_SECTIONS) {
+        QByteArray data;
+        QDataStream out(&data, QIODevice::WriteOnly);
+        out.setVersion(QDataStream::Qt_6_0);
+        player->writeSaveSection(out, section);
+        sections.append(data);
+    }
+    return sections;
+}
+
+QString SaveHistory::recordSnapshot(const Player *player, int slotNumber)
+{
+    if (!player) {
+        qWarning() << "Cannot record snapshot: player is null";
+        return QString();
+    }
+    return recordSnapshot(player->name, player->level, serializeSections(player), slotNumber);
+}
+
+QString SaveHistory::recordSnapshot(const QString &characterName, int level,
+                                    const QList<QByteArray> &sections, int slotNumber)
+{
+    if (sections.size() != SNAPSHOT_SECTIONS.size()) {
+        qWarning() << "Cannot record snapshot: expected" << SNAPSHOT_SECTIONS.size() << "sections";
+        return QString();
+    }
+
+    QDir dir;
+    if (!dir.mkpath(chunksDirectory()) || !dir.mkpath(slotDirectory(slotNumber))) {
+        qWarning() << "Failed to create save history directories";
+        return QString();
+    }
+
+    QList<QByteArray> chunkHashes;
+    for (const QByteArray &data : sections) {
+        QByteArray hash = storeChunk(data);
+        if (hash.isEmpty()) {
+            return QString();
+        }
+        chunkHashes.append(hash);
+    }
+
+    // Timestamped ids sort chronologically; add a suffix on collision. Ids are
+    // compared without the ".snap" extension (snapshotIdsNewestFirst), so
+    // "X" < "X-001" < "X-002" and a collision sorts after the id it follows.
+    QDateTime now = QDateTime::currentDateTime();
+    QString baseId = now.toUTC().toString("yyyyMMdd-HHmmsszzz");
+    QString snapshotId = baseId;
+    for (int i = 1; QFile::exists(manifestFilePath(slotNumber, snapshotId)); ++i) {
+        snapshotId = QString("%1-%2").arg(baseId).arg(i, 3, 10, QChar('0'));
+    }
+
+    QSaveFile file(manifestFilePath(slotNumber, snapshotId));
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Could not open snapshot manifest for writing:" << file.fileName();
+        return QString();
+    }
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_6_0);
+    out << HISTORY_MAGIC;
+    out << HISTORY_VERSION;
+    out << characterName;
+    out << level;
+    out << now;
+    out << chunkHashes;
+
+    if (!file.commit()) {
+        qWarning() << "Could not write snapshot manifest:" << file.fileName();
+        return QString();
+    }
+    return snapshotId;
+}
+
+bool SaveHistory::readManifest(const QString &filePath, SaveSnapshotInfo &info, QList<QByteArray> &chunkHashes) const
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_6_0);
+
+    QString magic;
+    quint32 version;
+    in >> magic >> version;
+    if (magic != HISTORY_MAGIC || version > HISTORY_VERSION) {
+        qWarning() << "Invalid snapshot manifest:" << filePath;
+        return false;
+    }
+
+    in >> info.characterName >> info.level >> info.saveTime >> chunkHashes;
+    info.snapshotId = QFileInfo(filePath).completeBaseName();
+    return in.status() == QDataStream::Ok;
+}
+
+QStringList SaveHistory::snapshotIdsNewestFirst(int slotNumber) const
+{
+    // Not QDir::Name on the file names: '-' sorts before '.', which would put
+    // "X-001.snap" ahead of "X.snap"
+    QStringList ids;
+    const QStringList manifests = QDir(slotDirectory(slotNumber)).entryList({"*.snap"}, QDir::Files);
+    for (const QString &fileName : manifests) {
+        ids.append(fileName.chopped(5));
+    }
+    std::sort(ids.begin(), ids.end(), std::greater<QString>());
+    return ids;
+}
+
+QList<SaveSnapshotInfo> SaveHistory::listSnapshots(int slotNumber) const
+{
+    QList<SaveSnapshotInfo> snapshots;
+
+    const QStringList ids = snapshotIdsNewestFirst(slotNumber);
+    for (const QString &snapshotId : ids) {
+        SaveSnapshotInfo info;
+        QList<QByteArray> chunkHashes;
+        if (readManifest(manifestFilePath(slotNumber, snapshotId), info, chunkHashes)) {
+            info.slotNumber = slotNumber;
+            snapshots.append(info);
+        }
+    }
+    return snapshots;
+}
+
+int SaveHistory::snapshotCount(int slotNumber) const
+{
+    return QDir(slotDirectory(slotNumber)).entryList({"*.snap"}, QDir::Files).size();
+}
+
+QByteArray SaveHistory::loadSnapshotData(int slotNumber, const QString &snapshotId) const
+{
+    SaveSnapshotInfo info;
+    QList<QByteArray> chunkHashes;
+    if (!readManifest(manifestFilePath(slotNumber, snapshotId), info, chunkHashes)) {
+        qWarning() << "Snapshot not found:" << slotNumber << snapshotId;
+        return QByteArray();
+    }
+
+    if (chunkHashes.size() != SNAPSHOT_SECTIONS.size()) {
+        qWarning() << "Snapshot has unexpected chunk count:" << snapshotId;
+        return QByteArray();
+    }
+
+    // Sections are stored in stream order, so concatenation is the full Player stream
+    QByteArray data;
+    for (const QByteArray &hash : chunkHashes) {
+        QByteArray chunk = readChunk(hash);
+        if (chunk.isEmpty()) {
+            return QByteArray();
+        }
+        data.append(chunk);
+    }
+    return data;
+}
+
+Player* SaveHistory::loadSnapshot(int slotNumber, const QString &snapshotId) const
+{
+    QByteArray data = loadSnapshotData(slotNumber, snapshotId);
+    if (data.isEmpty()) {
+        return nullptr;
+    }
+
+    QDataStream in(data);
+    in.setVersion(QDataStream::Qt_6_0);
+
+    Player *player = new Player("");
+    in >> *player;
+    if (in.status() != QDataStream::Ok) {
+        qWarning() << "Failed to decode snapshot:" << snapshotId;
+        delete player;
+        return nullptr;
+    }
+    return player;
+}
+
+int SaveHistory::pruneSnapshots(int slotNumber, int keepLatest)
+{
+    const QStringList ids = snapshotIdsNewestFirst(slotNumber);
+
+    int removed = 0;
+    for (int i = std::max(keepLatest, 0); i < ids.size(); ++i) {
+        if (QFile::remove(manifestFilePath(slotNumber, ids[i]))) {
+            removed++;
+        }
+    }
+
+    if (removed > 0) {
+        collectGarbage();
+    }
+    return removed;
+}
+
+bool SaveHistory::referencedChunks(QSet<QByteArray> &referenced) const
+{
+    QDir historyDir(m_historyDir);
+    const QStringList slotDirs = historyDir.entryList({"slot_*"}, QDir::Dirs | QDir::NoDotAndDotDot);
+    for (const QString &slotDir : slotDirs) {
+        QDir dir(historyDir.filePath(slotDir));
+        const QStringList manifests = dir.entryList({"*.snap"}, QDir::Files);
+        for (const QString &fileName : manifests) {
+            SaveSnapshotInfo info;
+            QList<QByteArray> chunkHashes;
+            if (!readManifest(dir.filePath(fileName), info, chunkHashes)) {
+                qWarning() << "Could not read snapshot manifest:" << dir.filePath(fileName);
+                return false;
+            }
+            for (const QByteArray &hash : chunkHashes) {
+                referenced.insert(hash);
+            }
+        }
+    }
+    return true;
+}
+
+void SaveHistory::collectGarbage()
+{
+    // Mark: every chunk referenced by any slot's manifest; sweep: the rest.
+    // A manifest that cannot be read may still reference chunks, so nothing is
+    // swept rather than risk deleting history that could be recovered.
+    QSet<QByteArray> referenced;
+    if (!referencedChunks(referenced)) {
+        qWarning() << "Skipping save history garbage collection";
+        return;
+    }
+
+    QDir dir(chunksDirectory());
+    const QStringList chunks = dir.entryList({"*.chunk"}, QDir::Files);
+    for (const QString &fileName : chunks) {
+        QByteArray hash = QFileInfo(fileName).completeBaseName().toLatin1();
+        if (!referenced.contains(hash)) {
+            dir.remove(fileName);
+        }
+    }
+}
+
+qint64 SaveHistory::chunkStorageBytes() const
+{
+    qint64 total = 0;
+    QDir dir(chunksDirectory());
+    const QFileInfoList chunks = dir.entryInfoList({"*.chunk"}, QDir::Files);
+    for (const QFileInfo &info : chunks) {
+        total += info.size();
+    }
+    return total;
+}
@@ -0,0 +1,80 @@
+#ifndef SAVEHISTORY_H
+#define SAVEHISTORY_H
+
+#include <QString>
+#include <QList>
+#include <QByteArray>
+#include <QDateTime>
+#include <QSet>
+#include <QStringList>
+
+class Player;
+
+struct SaveSnapshotInfo {
+    QString snapshotId;
+    int slotNumber;
+    QString characterName;
+    int level;
+    QDateTime saveTime;
+};
+
+// Content-addressed history of save slots.
+// Each snapshot is a small manifest referencing one chunk per Player::SaveSection.
+// Chunks are stored once under their SHA-1, so consecutive snapshots share every
+// section that did not change (e.g. narrative flags between two fights).
+//
+// Layout under <savesDirectory>/history:
+//   chunks/<sha1>.chunk        qCompress'd section bytes
+//   slot_<N>/<snapshotId>.snap  manifest (header + ordered chunk hashes)
+class SaveHistory
+{
+public:
+    explicit SaveHistory(const QString &savesDirectory);
+
+    // The player's save stream split into the sections a snapshot stores, in
+    // stream order; concatenated they are exactly what operator<< writes
+    static QList<QByteArray> serializeSections(const Player *player);
+
+    // Records the player's current state for a slot. Returns the new snapshot id,
+    // or an empty string on failure.
+    QString recordSnapshot(const Player *player, int slotNumber);
+    // Same, from sections already produced by serializeSections()
+    QString recordSnapshot(const QString &characterName, int level,
+                           const QList<QByteArray> &sections, int slotNumber);
+
+    // Newest first
+    QList<SaveSnapshotInfo> listSnapshots(int slotNumber) const;
+    // Number of snapshots of a slot, without reading them
+    int snapshotCount(int slotNumber) const;
+
+    // Rebuilds a Player from a snapshot. Caller owns the returned object.
+    Player* loadSnapshot(int slotNumber, const QString &snapshotId) const;
+
+    // Rebuilds the full Player stream (as written by operator<<) for a snapshot
+    QByteArray loadSnapshotData(int slotNumber, const QString &snapshotId) const;
+
+    // Keeps the newest keepLatest snapshots of a slot and garbage-collects
+    // chunks no longer referenced by any slot. Returns the number of snapshots removed.
+    int pruneSnapshots(int slotNumber, int keepLatest);
+
+    // Total bytes used by stored chunks (shared across all slots)
+    qint64 chunkStorageBytes() const;
+
+private:
+    QString m_historyDir;
+
+    QString chunksDirectory() const;
+    QString slotDirectory(int slotNumber) const;
+    QString chunkFilePath(const QByteArray &hash) const;
+    QString manifestFilePath(int slotNumber, const QString &snapshotId) const;
+
+    QByteArray storeChunk(const QByteArray &data);
+    QByteArray readChunk(const QByteArray &hash) const;
+    bool readManifest(const QString &filePath, SaveSnapshotInfo &info, QList<QByteArray> &chunkHashes) const;
+    QStringList snapshotIdsNewestFirst(int slotNumber) const;
+    // False if any manifest could not be read, in which case referenced is incomplete
+    bool referencedChunks(QSet<QByteArray> &referenced) const;
+    void collectGarbage();
+};
+
+#endif // SAVEHISTORY_H
@@ -1,4 +1,5 @@
 #include "SaveManager.h"
+#include "../diagnostics/Profiler.h"
 #include "../models/Player.h"
 #include "../game/factories/ItemFactory.h"
 #include <QFile>
@@ -15,11 +16,30 @@ SaveManager::SaveManager()
 
 bool SaveManager::saveGame(Player *player, const QString &filePath)
 {
+    return saveGame(player, filePath, Player::CURRENT_SAVE_VERSION);
+}
+
+bool SaveManager::saveGame(Player *player, const QString &filePath, quint32 playerFormatVersion)
+{
+    PYRPG_PROFILE_SCOPE("SaveManager::saveGame");
     if (!player) {
         qWarning() << "Cannot save game: player is null";
         return false;
     }
 
+    // Write full player data
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_6_0);
+    player->writeSaveData(out, playerFormatVersion);
+
+    return writeSaveFile(filePath, player->name, player->level, {data});
+}
+
+bool SaveManager::writeSaveFile(const QString &filePath, const QString &characterName, int level,
+                                const QList<QByteArray> &sections) const
+{
+    PYRPG_PROFILE_SCOPE("SaveManager::writeSaveFile");
     QFile file(filePath);
     if (!file.open(QIODevice::WriteOnly)) {
         qWarning() << "Could not open file for writing:" << filePath;
@@ -29,22 +49,35 @@ bool SaveManager::saveGame(Player *player, const QString &filePath)
     QDataStream out(&file);
     out.setVersion(QDataStream::Qt_6_0);
 
-    // Write metadata header for quick loading
-    out << QString("PYRPG_SAVE");  // Magic identifier
-    out << quint32(2);  // Save file format version
-    out << player->name;  // Character name
-    out << player->level;  // Character level
-    out << QDateTime::currentDateTime();  // Save time
+    writeSaveHeader(out, characterName, level);
 
-    // Write full player data
-    out << *player;
+    // The sections concatenated are the full player data
+    for (const QByteArray &section : sections) {
+        out.writeRawData(section.constData(), int(section.size()));
+    }
 
+    // A full disk shows up as a stream or file error, possibly only once buffers are flushed
     file.close();
+    if (out.status() != QDataStream::Ok || file.error() != QFileDevice::NoError) {
+        qWarning() << "Could not write save file:" << filePath << file.errorString();
+        return false;
+    }
     return true;
 }
 
+void SaveManager::writeSaveHeader(QDataStream &out, const QString &characterName, int level)
+{
+    // Write metadata header for quick loading
+    out << QString("PYRPG_SAVE");  // Magic identifier
+    out << quint32(2);  // Save file format version
+    out << characterName;  // Character name
+    out << level;  // Character level
+    out << QDateTime::currentDateTime();  // Save time
+}
+
 Player* SaveManager::loadGame(const QString &filePath)
 {
+    PYRPG_PROFILE_SCOPE("SaveManager::loadGame");
     QFile file(filePath);
     if (!file.open(QIODevice::ReadOnly)) {
         qWarning() << "Could not open file for reading:" << filePath;
@@ -80,11 +113,53 @@ Player* SaveManager::loadGame(const QString &filePath)
     // Load full player data
     Player *player = new Player(""); // Create a dummy player
     in >> *player;
+    if (in.status() != QDataStream::Ok) {
+        qWarning() << "Corrupt or truncated save file:" << filePath;
+        delete player;
+        file.close();
+        return nullptr;
+    }
 
     file.close();
     return player;
 }
 
+quint32 SaveManager::getPlayerFormatVersion(const QString &filePath) const
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_6_0);
+
+    QString magic;
+    in >> magic;
+    if (magic != "PYRPG_SAVE") {
+        return 0;
+    }
+
+    // Skip the metadata header
+    quint32 saveVersion;
+    QString metaName;
+    int metaLevel;
+    QDateTime metaTime;
+    in >> saveVersion >> metaName >> metaLevel >> metaTime;
+
+    // Same detection as operator>>(QDataStream&, Player&): anything outside the
+    // versioned range is a legacy (version 1) stream starting with the name
+    quint32 possibleVersion = 0;
+    in >> possibleVersion;
+    if (in.status() != QDataStream::Ok) {
+        return 0;
+    }
+    if (possibleVersion >= 1 && possibleVersion <= Player::CURRENT_SAVE_VERSION) {
+        return possibleVersion;
+    }
+    return 1;
+}
+
 QString SaveManager::getSavesDirectory() const
 {
     QString dataDir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
@@ -113,6 +188,7 @@ QString SaveManager::getSlotFilePath(int slotNumber) const
 
 SaveSlotInfo SaveManager::getSlotInfo(int slotNumber) const
 {
+    PYRPG_PROFILE_SCOPE("SaveManager::getSlotInfo");
     SaveSlotInfo info;
     info.slotNumber = slotNumber;
     info.filePath = getSlotFilePath(slotNumber);
@@ -158,6 +234,7 @@ SaveSlotInfo SaveManager::getSlotInfo(int slotNumber) const
 
 std::vector<SaveSlotInfo> SaveManager::getSaveSlots() const
 {
+    PYRPG_PROFILE_SCOPE("SaveManager::getSaveSlots");
     std::vector<SaveSlotInfo> slot_list {};
     for (int i = 1; i <= MAX_SAVE_SLOTS; ++i) {
         slot_list.push_back(getSlotInfo(i));
@@ -177,8 +254,36 @@ bool SaveManager::saveToSlot(Player *player, int slotNumber)
         return false;
     }
 
+    if (!player) {
+        qWarning() << "Cannot save game: player is null";
+        return false;
+    }
+
+    // Serialized once for both the slot file and its history snapshot
+    const QList<QByteArray> sections = SaveHistory::serializeSections(player);
+
     QString filePath = getSlotFilePath(slotNumber);
-    return saveGame(player, filePath);
+    if (!writeSaveFile(filePath, player->name, player->level, sections)) {
+        return false;
+    }
+
+    // Keep a rolling, deduplicated backup of the slot
+    SaveHistory history(getSavesDirectory());
+    auto count = m_historyCounts.find(slotNumber);
+    if (count == m_historyCounts.end()) {
+        count = m_historyCounts.insert(slotNumber, history.snapshotCount(slotNumber));
+    }
+    QString snapshotId;
+    {
+        PYRPG_PROFILE_SCOPE("SaveHistory::recordSnapshot");
+        snapshotId = history.recordSnapshot(player->name, player->level, sections, slotNumber);
+    }
+    if (snapshotId.isEmpty()) {
+        qWarning() << "Failed to record save history for slot" << slotNumber;
+    } else if (++count.value() > MAX_HISTORY_PER_SLOT) {
+        count.value() -= history.pruneSnapshots(slotNumber, MAX_HISTORY_PER_SLOT);
+    }
+    return true;
 }
 
 Player* SaveManager::loadFromSlot(int slotNumber)
@@ -208,3 +313,43 @@ bool SaveManager::deleteSaveSlot(int slotNumber)
 
     return file.remove();
 }
+
+QList<SaveSnapshotInfo> SaveManager::getSlotHistory(int slotNumber) const
+{
+    if (slotNumber < 1 || slotNumber > MAX_SAVE_SLOTS) {
+        qWarning() << "Invalid slot number:" << slotNumber;
+        return QList<SaveSnapshotInfo>();
+    }
+
+    return SaveHistory(getSavesDirectory()).listSnapshots(slotNumber);
+}
+
+bool SaveManager::restoreSnapshot(int slotNumber, const QString &snapshotId)
+{
+    PYRPG_PROFILE_SCOPE("SaveManager::restoreSnapshot");
+    if (slotNumber < 1 || slotNumber > MAX_SAVE_SLOTS) {
+        qWarning() << "Invalid slot number:" << slotNumber;
+        return false;
+    }
+
+    Player *player = SaveHistory(getSavesDirectory()).loadSnapshot(slotNumber, snapshotId);
+    if (!player) {
+        return false;
+    }
+
+    // Write the slot file directly; the restored state already exists in history
+    bool success = ensureSavesDirectoryExists() && saveGame(player, getSlotFilePath(slotNumber));
+    delete player;
+    return success;
+}
+
+int SaveManager::pruneSlotHistory(int slotNumber, int keepLatest)
+{
+    if (slotNumber < 1 || slotNumber > MAX_SAVE_SLOTS) {
+        qWarning() << "Invalid slot number:" << slotNumber;
+        return 0;
+    }
+
+    m_historyCounts.remove(slotNumber);
+    return SaveHistory(getSavesDirectory()).pruneSnapshots(slotNumber, keepLatest);
+}
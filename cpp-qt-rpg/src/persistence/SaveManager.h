@@ -4,9 +4,12 @@
 #include <QString>
 #include <QList>
 #include <QDateTime>
+#include <QHash>
 #include <vector>
+#include "SaveHistory.h"
 
 class Player;
+class QDataStream;
 
 struct SaveSlotInfo {
     int slotNumber;
@@ -22,6 +25,8 @@ class SaveManager
 public:
     SaveManager();
     bool saveGame(Player *player, const QString &filePath);
+    // Writes the player in a specific Player format version (1-5), e.g. for downgrades
+    bool saveGame(Player *player, const QString &filePath, quint32 playerFormatVersion);
     Player* loadGame(const QString &filePath);
 
     // Save slot management
@@ -31,11 +36,27 @@ public:
     bool deleteSaveSlot(int slotNumber);
     QString getSlotFilePath(int slotNumber) const;
     SaveSlotInfo getSlotInfo(int slotNumber) const;
+    QString getSavesDirectory() const;
+
+    // Player format version stored in a save file (0 if the file is not a valid save)
+    quint32 getPlayerFormatVersion(const QString &filePath) const;
+
+    // Save history (deduplicated snapshots recorded on every slot save)
+    QList<SaveSnapshotInfo> getSlotHistory(int slotNumber) const;
+    bool restoreSnapshot(int slotNumber, const QString &snapshotId);
+    int pruneSlotHistory(int slotNumber, int keepLatest);
 
 private:
     static const int MAX_SAVE_SLOTS = 10;
-    QString getSavesDirectory() const;
+    static const int MAX_HISTORY_PER_SLOT = 500;
     bool ensureSavesDirectoryExists() const;
+    bool writeSaveFile(const QString &filePath, const QString &characterName, int level,
+                       const QList<QByteArray> &sections) const;
+    static void writeSaveHeader(QDataStream &out, const QString &characterName, int level);
+
+    // Snapshots per slot, counted once and then kept up to date, so saving does
+    // not list the slot's history each time
+    QHash<int, int> m_historyCounts;
 };
 
 #endif // SAVEMANAGER_H
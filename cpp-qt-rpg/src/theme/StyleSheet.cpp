@@ -0,0 +1,740 @@
+#include "StyleSheet.h"
+#include "Theme.h"
+#include "../diagnostics/Profiler.h"
+#include <QApplication>
+#include <QDebug>
+#include <QFont>
+#include <QList>
+#include <QPair>
+
+namespace {
+
+// Rules are written against @TOKEN@ placeholders so the sheet reads like plain QSS;
+// substituteTokens() fills them in from Theme.h.
+const char *BASE_RULES = R"(
+/* Palette supplies window and text colors; only widgets that differ need rules */
+QMainWindow, QDialog {
+    background-color: @BACKGROUND@;
+}
+
+/* Buttons - Unified styling with variants */
+QPushButton {
+    color: @FOREGROUND@;
+    background-color: @CARD@;
+    border: 1px solid @BORDER@;
+    border-radius: @RADIUS_MD@px;
+    padding: 8px 16px;
+    font-size: @FONT_MD@px;
+    font-weight: @WEIGHT_MEDIUM@;
+    min-width: 80px;
+    min-height: 32px;
+}
+QPushButton:hover {
+    background-color: @SECONDARY@;
+    border-color: @ACCENT@;
+}
+QPushButton:pressed {
+    background-color: @MUTED@;
+}
+QPushButton:disabled {
+    background-color: @MUTED@;
+    color: @MUTED_FOREGROUND@;
+    border-color: @BORDER@;
+}
+QPushButton#primary {
+    background-color: @PRIMARY@;
+    color: @PRIMARY_FOREGROUND@;
+    border: none;
+    font-weight: bold;
+}
+QPushButton#primary:hover {
+    background-color: @PRIMARY_DARK@;
+}
+QPushButton#destructive {
+    background-color: @DESTRUCTIVE@;
+    color: @DESTRUCTIVE_FOREGROUND@;
+    border: none;
+}
+QPushButton#destructive:hover {
+    background-color: @DESTRUCTIVE_DARK@;
+}
+
+/* GroupBox / Cards */
+QGroupBox {
+    color: @FOREGROUND@;
+    border: 1px solid @BORDER@;
+    border-radius: @RADIUS_LG@px;
+    margin-top: 1ex;
+    font-size: @FONT_LG@px;
+    font-weight: bold;
+    padding: @SPACING_MD@px;
+    background-color: @CARD@;
+}
+QGroupBox::title {
+    subcontrol-origin: margin;
+    subcontrol-position: top left;
+    padding: 0 10px;
+    color: @FOREGROUND@;
+    background-color: @CARD@;
+    border-radius: @RADIUS_SM@px;
+    margin-left: 10px;
+}
+
+QTextEdit {
+    background-color: @CARD@;
+    color: @FOREGROUND@;
+    border: 1px solid @BORDER@;
+    border-radius: @RADIUS_LG@px;
+    padding: 10px;
+    selection-background-color: @SECONDARY@;
+}
+
+QProgressBar {
+    border: 1px solid @BORDER@;
+    border-radius: @RADIUS_LG@px;
+    text-align: center;
+    font-weight: @WEIGHT_SEMIBOLD@;
+    font-size: @FONT_SM@px;
+    background-color: @MUTED@;
+    color: @FOREGROUND@;
+    height: 24px;
+}
+QProgressBar::chunk {
+    background-color: @PRIMARY@;
+    border-radius: 7px;
+}
+
+QLabel {
+    font-size: @FONT_MD@px;
+    background-color: transparent;
+    border: none;
+}
+
+QLineEdit {
+    background-color: @BACKGROUND@;
+    color: @FOREGROUND@;
+    border: 1px solid @BORDER@;
+    border-radius: @RADIUS_MD@px;
+    padding: 8px 12px;
+    font-size: @FONT_MD@px;
+}
+QLineEdit:focus {
+    border-color: @RING@;
+}
+
+QTabWidget::pane {
+    border: none;
+    background-color: @BACKGROUND@;
+}
+QTabBar::tab {
+    background-color: @CARD@;
+    color: @MUTED_FOREGROUND@;
+    padding: 12px 24px;
+    border: none;
+    border-bottom: 3px solid transparent;
+    font-size: @FONT_MD@px;
+    font-weight: @WEIGHT_MEDIUM@;
+    margin-right: 2px;
+}
+QTabBar::tab:hover {
+    background-color: @MUTED@;
+    color: @FOREGROUND@;
+}
+QTabBar::tab:selected {
+    background-color: @BACKGROUND@;
+    color: @PRIMARY@;
+    border-bottom-color: @PRIMARY@;
+}
+
+QScrollArea {
+    border: none;
+    background-color: transparent;
+}
+QScrollBar:vertical {
+    border: none;
+    background: @CARD@;
+    width: @SCROLLBAR_WIDTH@px;
+    margin: 0px;
+}
+QScrollBar::handle:vertical {
+    background: @BORDER@;
+    min-height: 20px;
+    border-radius: 5px;
+}
+QScrollBar::add-line:vertical, QScrollBar::sub-line:vertical {
+    height: 0px;
+}
+QScrollBar:horizontal {
+    border: none;
+    background: @CARD@;
+    height: 10px;
+    margin: 0px;
+}
+QScrollBar::handle:horizontal {
+    background: @BORDER@;
+    min-width: 20px;
+    border-radius: 5px;
+}
+QScrollBar::add-line:horizontal, QScrollBar::sub-line:horizontal {
+    width: 0px;
+}
+)";
+
+// Roles and object names set by the views and components
+const char *ROLE_RULES = R"(
+QLabel[themeRole="pageTitle"] {
+    font-size: @FONT_XL@px;
+    font-weight: bold;
+}
+QLabel[themeRole="sectionTitle"] {
+    font-size: @FONT_LG@px;
+    font-weight: bold;
+}
+QLabel[themeRole="gold"] {
+    font-size: @FONT_LG@px;
+    font-weight: bold;
+    color: @GOLD@;
+}
+QLabel[themeRole="hint"] {
+    color: @MUTED_FOREGROUND@;
+    font-size: @FONT_SM@px;
+}
+QLabel[themeRole="emptyState"] {
+    color: @MUTED_FOREGROUND@;
+    font-size: @FONT_MD@px;
+}
+QLabel[themeRole="cardTitle"] {
+    color: @PRIMARY@;
+    margin-bottom: @SPACING_SM@px;
+}
+QFrame[themeRole="card"] {
+    background-color: @CARD@;
+    border-radius: @RADIUS_MD@px;
+}
+QScrollArea[themeRole="pageScroll"], QListView[themeRole="pageScroll"] {
+    border: none;
+    background-color: @BACKGROUND@;
+}
+
+/* Validation feedback; state is the "validation" property */
+ValidationLabel {
+    font-size: @FONT_SM@px;
+    padding: @SPACING_XS@px;
+    border-radius: @RADIUS_SM@px;
+}
+ValidationLabel[validation="error"] {
+    color: @DESTRUCTIVE@;
+    background-color: @DESTRUCTIVE_TINT@;
+    border: 1px solid @DESTRUCTIVE@;
+}
+ValidationLabel[validation="success"] {
+    color: @SUCCESS@;
+    background-color: @SUCCESS_TINT@;
+    border: 1px solid @SUCCESS@;
+}
+ValidationLabel[validation="warning"] {
+    color: @WARNING@;
+    background-color: @WARNING_TINT@;
+    border: 1px solid @WARNING@;
+}
+
+/* Combat page */
+QLabel[themeRole="trackerTitle"] {
+    color: @ACCENT@;
+    font-size: @FONT_MD@px;
+    font-weight: bold;
+}
+QListView[themeRole="questTracker"] {
+    background-color: @MUTED@;
+    border: none;
+    border-radius: @RADIUS_SM@px;
+    color: @FOREGROUND@;
+    font-size: @FONT_SM@px;
+}
+QPushButton[themeRole="primaryAction"], QPushButton[themeRole="secondaryAction"], QPushButton[themeRole="accentAction"] {
+    border: none;
+    border-radius: @RADIUS_LG@px;
+    padding: 10px;
+    font-size: @FONT_LG@px;
+    font-weight: bold;
+}
+QPushButton[themeRole="primaryAction"] { background-color: @PRIMARY@; color: @PRIMARY_FOREGROUND@; }
+QPushButton[themeRole="primaryAction"]:hover { background-color: @PRIMARY_DARK@; }
+QPushButton[themeRole="secondaryAction"] { background-color: @SECONDARY@; color: @FOREGROUND@; }
+QPushButton[themeRole="secondaryAction"]:hover { background-color: @SECONDARY_DARK@; }
+QPushButton[themeRole="accentAction"] { background-color: @ACCENT@; color: @ACCENT_FOREGROUND@; }
+QPushButton[themeRole="accentAction"]:hover { background-color: @ACCENT_DARK@; }
+
+/* Inventory page */
+QFrame[themeRole="equipmentPanel"] {
+    background-color: @CARD@;
+    border-radius: @RADIUS_MD@px;
+    border: 2px solid @BORDER@;
+}
+QFrame[themeRole="equipmentSlot"] {
+    background-color: @MUTED@;
+    border-radius: @RADIUS_MD@px;
+    padding: 10px;
+}
+QLabel[themeRole="equipmentSlotValue"] {
+    font-size: @FONT_SM@px;
+}
+
+/* Shop page */
+QFrame[themeRole="shopCard"] {
+    background-color: @CARD@;
+    border: 2px solid @BORDER@;
+    border-radius: @RADIUS_LG@px;
+    padding: @SPACING_SM@px;
+}
+QFrame[themeRole="shopCard"]:hover {
+    border-color: @PRIMARY@;
+}
+QLabel[themeRole="shopItemName"] { font-weight: bold; font-size: 13px; }
+QLabel[themeRole="shopItemType"] { color: @MUTED_FOREGROUND@; font-size: 11px; }
+QLabel[themeRole="shopItemStats"] { color: @ACCENT@; font-size: @FONT_XS@px; }
+QLabel[themeRole="shopItemPrice"] { font-size: @FONT_SM@px; font-weight: bold; color: @GOLD@; }
+QPushButton[themeRole="buyButton"] {
+    background-color: @PRIMARY@;
+    color: @PRIMARY_FOREGROUND@;
+    font-size: 11px;
+    border: none;
+    border-radius: @RADIUS_SM@px;
+    min-width: 0px;
+}
+QPushButton[themeRole="buyButton"]:hover { background-color: @PRIMARY_LIGHT@; }
+QPushButton[themeRole="buyButton"]:disabled { background-color: @MUTED@; color: @MUTED_FOREGROUND@; }
+
+/* Item cards (item selection overlays); rarity colors are generated below */
+ItemCard {
+    background-color: @CARD@;
+    border: @BORDER_MEDIUM@px solid @BORDER@;
+    border-radius: @RADIUS_MD@px;
+    padding: @SPACING_SM@px;
+}
+ItemCard:hover {
+    background-color: @MUTED@;
+}
+ItemCard QLabel[themeRole="itemCardIcon"] { font-size: 32px; }
+ItemCard QLabel[themeRole="itemCardName"] { font-size: 13px; font-weight: @WEIGHT_BOLD@; }
+ItemCard QLabel[themeRole="itemCardStats"] { font-size: 11px; color: @MUTED_FOREGROUND@; }
+ItemCard QLabel[themeRole="itemCardRarity"] {
+    font-size: @FONT_XS@px;
+    background-color: rgba(0, 0, 0, 0.4);
+    padding: @SPACING_XS@px @SPACING_SM@px;
+    border-radius: @RADIUS_SM@px;
+    font-weight: @WEIGHT_MEDIUM@;
+}
+ItemCard QLabel[themeRole="itemCardPrice"] { font-size: @FONT_SM@px; font-weight: @WEIGHT_SEMIBOLD@; color: @ACCENT@; }
+ItemCard QPushButton[themeRole="itemCardAction"] {
+    background-color: @CARD@;
+    color: @PRIMARY@;
+    border: 1px solid @PRIMARY@;
+    border-radius: @RADIUS_SM@px;
+    padding: @SPACING_XS@px @SPACING_SM@px;
+    font-size: 11px;
+    font-weight: @WEIGHT_MEDIUM@;
+    min-width: 0px;
+    min-height: 0px;
+}
+ItemCard QPushButton[themeRole="itemCardAction"]:hover { background-color: @SECONDARY@; color: @SECONDARY_FOREGROUND@; }
+ItemCard QPushButton[themeRole="itemCardAction"]:pressed { background-color: @MUTED@; }
+ItemCard QPushButton[themeRole="itemCardAction"]:disabled {
+    background-color: @MUTED@;
+    color: @MUTED_FOREGROUND@;
+    border-color: @BORDER@;
+}
+
+/* Lore codex */
+QLabel[themeRole="loreTitle"] {
+    color: @PRIMARY@;
+    padding: @SPACING_SM@px;
+}
+QLineEdit[themeRole="loreSearch"] {
+    background-color: @CARD@;
+    color: @FOREGROUND@;
+    border: @BORDER_THIN@px solid @BORDER@;
+    border-radius: @RADIUS_SM@px;
+    padding: @SPACING_SM@px;
+    font-size: @FONT_MD@px;
+}
+QLineEdit[themeRole="loreSearch"]:focus { border-color: @ACCENT@; }
+QTabWidget[themeRole="loreCategories"]::pane { border: none; background-color: transparent; }
+QTabWidget[themeRole="loreCategories"] QTabBar::tab {
+    background-color: @CARD@;
+    color: @FOREGROUND@;
+    padding: @SPACING_MD@px @SPACING_SM@px;
+    border: @BORDER_THIN@px solid @BORDER@;
+    border-radius: @RADIUS_SM@px;
+    margin: @SPACING_XS@px;
+    min-width: 80px;
+}
+QTabWidget[themeRole="loreCategories"] QTabBar::tab:selected {
+    background-color: @ACCENT@;
+    color: @ACCENT_FOREGROUND@;
+    border-color: @ACCENT@;
+}
+QTabWidget[themeRole="loreCategories"] QTabBar::tab:hover { background-color: @SECONDARY@; }
+QListWidget[themeRole="loreEntries"] {
+    background-color: @CARD@;
+    color: @FOREGROUND@;
+    border: @BORDER_THIN@px solid @BORDER@;
+    border-radius: @RADIUS_MD@px;
+    padding: @SPACING_SM@px;
+}
+QListWidget[themeRole="loreEntries"]::item {
+    padding: @SPACING_SM@px;
+    border-radius: @RADIUS_SM@px;
+    margin: @SPACING_XS@px;
+}
+QListWidget[themeRole="loreEntries"]::item:selected { background-color: @ACCENT@; color: @ACCENT_FOREGROUND@; }
+QListWidget[themeRole="loreEntries"]::item:hover { background-color: @SECONDARY@; }
+QTextEdit[themeRole="loreDetails"] {
+    background-color: @CARD@;
+    color: @FOREGROUND@;
+    border: @BORDER_THIN@px solid @BORDER@;
+    border-radius: @RADIUS_MD@px;
+    padding: @SPACING_MD@px;
+}
+QPushButton[themeRole="backButton"] {
+    background-color: @SECONDARY@;
+    color: @SECONDARY_FOREGROUND@;
+    border: @BORDER_THIN@px solid @BORDER@;
+    border-radius: @RADIUS_SM@px;
+    padding: @SPACING_MD@px;
+}
+QPushButton[themeRole="backButton"]:hover { background-color: @MUTED@; border-color: @ACCENT@; }
+
+/* Combat log */
+LogDisplay {
+    border: @BORDER_MEDIUM@px solid @BORDER@;
+    border-radius: @RADIUS_MD@px;
+    background-color: @CARD@;
+}
+LogDisplay QScrollBar:vertical { width: @SCROLLBAR_WIDTH@px; background: @CARD@; }
+LogDisplay QScrollBar::handle:vertical { background: @BORDER@; border-radius: 5px; }
+LogDisplay QScrollBar::handle:vertical:hover { background: @MUTED_FOREGROUND@; }
+
+/* Quest log */
+QLabel[themeRole="questLogTitle"] {
+    font-size: @FONT_XL@px;
+    font-weight: @WEIGHT_BOLD@;
+    color: @PRIMARY@;
+}
+QListView[themeRole="questLogList"] {
+    background-color: @CARD@;
+    border: 2px solid @BORDER@;
+    border-radius: @RADIUS_MD@px;
+    color: @FOREGROUND@;
+    padding: @SPACING_SM@px;
+    font-size: @FONT_MD@px;
+}
+QListView[themeRole="questLogList"]::item {
+    padding: 8px;
+    border-radius: 4px;
+    margin: 2px 0px;
+}
+QListView[themeRole="questLogList"]::item:selected { background-color: @PRIMARY@; color: @PRIMARY_FOREGROUND@; }
+QListView[themeRole="questLogList"]::item:hover { background-color: @MUTED@; }
+QTextEdit[themeRole="questLogDetails"] {
+    background-color: @CARD@;
+    border: 2px solid @BORDER@;
+    border-radius: @RADIUS_MD@px;
+    padding: @SPACING_MD@px;
+    color: @FOREGROUND@;
+    font-size: @FONT_MD@px;
+}
+QPushButton[themeRole="questLogAccept"], QPushButton[themeRole="questLogBack"] {
+    border-radius: @RADIUS_SM@px;
+    padding: @SPACING_MD@px;
+    font-size: @FONT_MD@px;
+    font-weight: @WEIGHT_MEDIUM@;
+}
+QPushButton[themeRole="questLogAccept"] {
+    background-color: @PRIMARY@;
+    color: @PRIMARY_FOREGROUND@;
+    border: none;
+}
+QPushButton[themeRole="questLogAccept"]:hover { background-color: @ACCENT@; }
+QPushButton[themeRole="questLogAccept"]:pressed { background-color: @DESTRUCTIVE@; }
+QPushButton[themeRole="questLogBack"] {
+    background-color: @SECONDARY@;
+    color: @SECONDARY_FOREGROUND@;
+    border: 2px solid @BORDER@;
+}
+QPushButton[themeRole="questLogBack"]:hover { background-color: @MUTED@; }
+
+/* Main menu and new game screen */
+MainMenu {
+    background-color: @BACKGROUND@;
+}
+QLabel[themeRole="splashTitle"] {
+    font-size: 48px;
+    font-weight: bold;
+    color: @PRIMARY@;
+    font-family: 'Segoe UI', 'Inter', sans-serif;
+}
+QLabel[themeRole="splashSubtitle"] { font-size: 18px; color: @MUTED_FOREGROUND@; margin-top: 10px; }
+QLabel[themeRole="splashFooter"] { color: #6c757d; font-size: 12px; margin-top: 20px; }
+MainMenu QLabel[themeRole="splashFooter"] { margin-top: 40px; }
+QPushButton[themeRole="menuPrimary"], QPushButton[themeRole="menuSecondary"], QPushButton[themeRole="menuDestructive"] {
+    border-radius: 8px;
+    padding: 10px;
+    font-size: 16px;
+    font-weight: bold;
+}
+MainMenu QPushButton { min-width: 200px; }
+QPushButton[themeRole="menuPrimary"] { background-color: @PRIMARY@; color: @PRIMARY_FOREGROUND@; }
+QPushButton[themeRole="menuPrimary"]:hover { background-color: @PRIMARY_LIGHT@; }
+QPushButton[themeRole="menuPrimary"]:pressed { background-color: @PRIMARY_DARK@; }
+QPushButton[themeRole="menuSecondary"] { background-color: @SECONDARY@; color: @FOREGROUND@; }
+QPushButton[themeRole="menuSecondary"]:hover { background-color: @SECONDARY_LIGHT@; }
+QPushButton[themeRole="menuSecondary"]:pressed { background-color: @SECONDARY_DARK@; }
+QPushButton[themeRole="menuDestructive"] { background-color: @DESTRUCTIVE@; color: @DESTRUCTIVE_FOREGROUND@; }
+QPushButton[themeRole="menuDestructive"]:hover { background-color: @DESTRUCTIVE_LIGHT@; }
+QPushButton[themeRole="menuDestructive"]:pressed { background-color: @DESTRUCTIVE_DARK@; }
+QFrame[themeRole="newGameCard"] {
+    background-color: @CARD@;
+    border-radius: 12px;
+}
+QFrame[themeRole="newGamePreview"] {
+    background-color: @CARD@;
+    border: 2px solid @BORDER@;
+    border-radius: 12px;
+}
+QLabel[themeRole="newGamePreviewTitle"] { font-size: 12px; color: @PRIMARY@; font-weight: bold; }
+QLabel[themeRole="newGameFieldTitle"] { font-size: 16px; font-weight: bold; color: @FOREGROUND@; }
+QLineEdit[themeRole="newGameInput"], QComboBox[themeRole="newGameInput"] {
+    font-size: 14px;
+    padding: 12px;
+    border: 2px solid @BORDER@;
+    border-radius: 8px;
+    background-color: @CARD@;
+    color: @FOREGROUND@;
+}
+QLineEdit[themeRole="newGameInput"] { font-weight: 500; }
+QLineEdit[themeRole="newGameInput"]:focus { border-color: @PRIMARY@; background-color: @MUTED@; }
+
+/* Menu overlay */
+QWidget#menuOverlayContent {
+    background-color: @CARD@;
+    border: @BORDER_MEDIUM@px solid @ACCENT@;
+    border-radius: @RADIUS_XL@px;
+}
+QWidget#menuOverlayContent QLabel[themeRole="overlayTitle"] { color: @ACCENT@; }
+QWidget#menuOverlayContent QPushButton#closeButton {
+    background-color: @MUTED@;
+    color: @FOREGROUND@;
+    border: 1px solid @BORDER@;
+    border-radius: 16px;
+    font-size: @FONT_LG@px;
+    font-weight: bold;
+    min-width: 0px;
+    min-height: 0px;
+    padding: 0px;
+}
+QWidget#menuOverlayContent QPushButton#closeButton:hover { background-color: @DESTRUCTIVE@; }
+QTabWidget#menuOverlayTabs::pane {
+    border: 1px solid @BORDER@;
+    border-radius: @RADIUS_MD@px;
+    background-color: @CARD@;
+}
+QTabWidget#menuOverlayTabs > QTabBar::tab {
+    background-color: @SECONDARY@;
+    color: @MUTED_FOREGROUND@;
+    padding: 10px 20px;
+    margin-right: 2px;
+    border: 1px solid @BORDER@;
+    border-bottom: none;
+    border-top-left-radius: @RADIUS_SM@px;
+    border-top-right-radius: @RADIUS_SM@px;
+}
+QTabWidget#menuOverlayTabs > QTabBar::tab:selected {
+    background-color: @ACCENT@;
+    color: @ACCENT_FOREGROUND@;
+    border-color: @ACCENT@;
+}
+QTabWidget#menuOverlayTabs > QTabBar::tab:hover { background-color: @MUTED@; }
+QWidget#menuOverlayContent QPushButton#saveButton, QWidget#menuOverlayContent QPushButton#loadButton {
+    border-radius: @RADIUS_MD@px;
+    padding: 8px 16px;
+    font-size: @FONT_MD@px;
+    font-weight: @WEIGHT_MEDIUM@;
+}
+QWidget#menuOverlayContent QPushButton#saveButton {
+    background-color: @ACCENT@;
+    color: @ACCENT_FOREGROUND@;
+    border: 1px solid @ACCENT@;
+}
+QWidget#menuOverlayContent QPushButton#saveButton:hover { background-color: @ACCENT_LIGHT@; }
+QWidget#menuOverlayContent QPushButton#loadButton {
+    background-color: @SECONDARY@;
+    color: @FOREGROUND@;
+    border: 1px solid @BORDER@;
+}
+QWidget#menuOverlayContent QPushButton#loadButton:hover { background-color: @MUTED@; }
+QWidget#menuOverlayContent QComboBox#animationSpeedSelector {
+    background-color: @SECONDARY@;
+    color: @FOREGROUND@;
+    border: 1px solid @BORDER@;
+    border-radius: @RADIUS_SM@px;
+    padding: 4px 12px;
+    min-width: 120px;
+}
+QWidget#menuOverlayContent QPushButton#quitButton {
+    background-color: @DESTRUCTIVE@;
+    color: @DESTRUCTIVE_FOREGROUND@;
+    border: 1px solid @DESTRUCTIVE_DARK@;
+    border-radius: @RADIUS_LG@px;
+    font-size: @FONT_MD@px;
+    font-weight: bold;
+    padding: 10px;
+}
+QWidget#menuOverlayContent QPushButton#quitButton:hover { background-color: @DESTRUCTIVE_LIGHT@; }
+)";
+
+QString hex(const QColor &color)
+{
+    return color.name(QColor::HexRgb);
+}
+
+QString rgba(const QColor &color, qreal alpha)
+{
+    return QString("rgba(%1, %2, %3, %4)").arg(color.red()).arg(color.green()).arg(color.blue()).arg(alpha);
+}
+
+// Border and text color per item rarity; anything unrecognised falls back to common
+QString rarityRules()
+{
+    struct RarityColor { const char *rarity; QColor color; };
+    const RarityColor rarities[] = {
+        {"common", Theme::MUTED_FOREGROUND},
+        {"uncommon", Theme::ACCENT},
+        {"rare", Theme::PRIMARY},
+        {"epic", Theme::SECONDARY},
+        {"legendary", Theme::MUTED},
+    };
+
+    QString rules;
+    for (const RarityColor &entry : rarities) {
+        QColor border = qstrcmp(entry.rarity, "common") == 0 ? Theme::BORDER : entry.color;
+        rules += QString(
+            "ItemCard[rarity=\"%1\"] { border-color: %2; }\n"
+            "ItemCard[rarity=\"%1\"]:hover { border-color: %3; }\n"
+            "ItemCard[rarity=\"%1\"] QLabel[themeRole=\"itemCardName\"], "
+            "ItemCard[rarity=\"%1\"] QLabel[themeRole=\"itemCardRarity\"] { color: %3; }\n"
+        ).arg(QLatin1String(entry.rarity), hex(border), hex(entry.color));
+    }
+    return rules;
+}
+
+QString substituteTokens(QString sheet)
+{
+    const QList<QPair<QString, QString>> tokens = {
+        {"BACKGROUND", hex(Theme::BACKGROUND)},
+        {"FOREGROUND", hex(Theme::FOREGROUND)},
+        {"CARD", hex(Theme::CARD)},
+        {"PRIMARY", hex(Theme::PRIMARY)},
+        {"PRIMARY_FOREGROUND", hex(Theme::PRIMARY_FOREGROUND)},
+        {"PRIMARY_DARK", hex(Theme::PRIMARY.darker(110))},
+        {"PRIMARY_LIGHT", hex(Theme::PRIMARY.lighter(110))},
+        {"SECONDARY", hex(Theme::SECONDARY)},
+        {"SECONDARY_FOREGROUND", hex(Theme::SECONDARY_FOREGROUND)},
+        {"SECONDARY_DARK", hex(Theme::SECONDARY.darker(110))},
+        {"SECONDARY_LIGHT", hex(Theme::SECONDARY.lighter(110))},
+        {"MUTED", hex(Theme::MUTED)},
+        {"MUTED_FOREGROUND", hex(Theme::MUTED_FOREGROUND)},
+        {"ACCENT", hex(Theme::ACCENT)},
+        {"ACCENT_FOREGROUND", hex(Theme::ACCENT_FOREGROUND)},
+        {"ACCENT_DARK", hex(Theme::ACCENT.darker(110))},
+        {"ACCENT_LIGHT", hex(Theme::ACCENT.lighter(110))},
+        {"DESTRUCTIVE", hex(Theme::DESTRUCTIVE)},
+        {"DESTRUCTIVE_FOREGROUND", hex(Theme::DESTRUCTIVE_FOREGROUND)},
+        {"DESTRUCTIVE_DARK", hex(Theme::DESTRUCTIVE.darker(110))},
+        {"DESTRUCTIVE_LIGHT", hex(Theme::DESTRUCTIVE.lighter(110))},
+        {"DESTRUCTIVE_TINT", rgba(Theme::DESTRUCTIVE, 0.1)},
+        {"SUCCESS", hex(Theme::SUCCESS)},
+        {"SUCCESS_TINT", rgba(Theme::SUCCESS, 0.1)},
+        {"WARNING", hex(Theme::WARNING)},
+        {"WARNING_TINT", rgba(Theme::WARNING, 0.1)},
+        {"GOLD", hex(Theme::GOLD)},
+        {"BORDER", hex(Theme::BORDER)},
+        {"RING", hex(Theme::RING)},
+        {"SPACING_XS", QString::number(Theme::SPACING_XS)},
+        {"SPACING_SM", QString::number(Theme::SPACING_SM)},
+        {"SPACING_MD", QString::number(Theme::SPACING_MD)},
+        {"RADIUS_SM", QString::number(Theme::BORDER_RADIUS_SM)},
+        {"RADIUS_MD", QString::number(Theme::BORDER_RADIUS_MD)},
+        {"RADIUS_LG", QString::number(Theme::BORDER_RADIUS_LG)},
+        {"RADIUS_XL", QString::number(Theme::BORDER_RADIUS_XL)},
+        {"BORDER_THIN", QString::number(Theme::BORDER_WIDTH_THIN)},
+        {"BORDER_MEDIUM", QString::number(Theme::BORDER_WIDTH_MEDIUM)},
+        {"SCROLLBAR_WIDTH", QString::number(Theme::SCROLLBAR_WIDTH)},
+        {"FONT_XS", QString::number(Theme::FONT_SIZE_XS)},
+        {"FONT_SM", QString::number(Theme::FONT_SIZE_SM)},
+        {"FONT_MD", QString::number(Theme::FONT_SIZE_MD)},
+        {"FONT_LG", QString::number(Theme::FONT_SIZE_LG)},
+        {"FONT_XL", QString::number(Theme::FONT_SIZE_XL)},
+        {"WEIGHT_MEDIUM", QString::number(Theme::FONT_WEIGHT_MEDIUM)},
+        {"WEIGHT_SEMIBOLD", QString::number(Theme::FONT_WEIGHT_SEMIBOLD)},
+        {"WEIGHT_BOLD", QString::number(Theme::FONT_WEIGHT_BOLD)},
+    };
+    for (const auto &token : tokens) {
+        sheet.replace(QLatin1Char('@') + token.first + QLatin1Char('@'), token.second);
+    }
+    if (sheet.contains(QLatin1Char('@'))) {
+        qWarning() << "Theme stylesheet has unresolved tokens";
+    }
+    return sheet;
+}
+
+QString buildStyleSheet()
+{
+    PYRPG_PROFILE_SCOPE("Theme::buildStyleSheet");
+    return substituteTokens(QString::fromUtf8(BASE_RULES) + QString::fromUtf8(ROLE_RULES)) + rarityRules();
+}
+
+} // namespace
+
+namespace Theme {
+
+QString applicationStyleSheet()
+{
+    static const QString styleSheet = buildStyleSheet();
+    return styleSheet;
+}
+
+QPalette applicationPalette()
+{
+    QPalette palette;
+    palette.setColor(QPalette::Window, BACKGROUND);
+    palette.setColor(QPalette::WindowText, FOREGROUND);
+    palette.setColor(QPalette::Base, CARD);
+    palette.setColor(QPalette::AlternateBase, MUTED);
+    palette.setColor(QPalette::Text, FOREGROUND);
+    palette.setColor(QPalette::PlaceholderText, MUTED_FOREGROUND);
+    palette.setColor(QPalette::Button, CARD);
+    palette.setColor(QPalette::ButtonText, FOREGROUND);
+    palette.setColor(QPalette::Highlight, SECONDARY);
+    palette.setColor(QPalette::HighlightedText, FOREGROUND);
+    palette.setColor(QPalette::ToolTipBase, CARD);
+    palette.setColor(QPalette::ToolTipText, FOREGROUND);
+    palette.setColor(QPalette::Link, ACCENT);
+    palette.setColor(QPalette::Mid, BORDER);
+    palette.setColor(QPalette::Disabled, QPalette::WindowText, MUTED_FOREGROUND);
+    palette.setColor(QPalette::Disabled, QPalette::Text, MUTED_FOREGROUND);
+    palette.setColor(QPalette::Disabled, QPalette::ButtonText, MUTED_FOREGROUND);
+    return palette;
+}
+
+void applyApplicationTheme(QApplication &app)
+{
+    PYRPG_PROFILE_SCOPE("Theme::applyApplicationTheme");
+    QFont font = app.font();
+    font.setFamilies(FONT_FAMILY.split(", "));
+    app.setFont(font);
+    app.setPalette(applicationPalette());
+    app.setStyleSheet(applicationStyleSheet());
+}
+
+} // namespace Theme
@@ -0,0 +1,39 @@
+#ifndef STYLESHEET_H
+#define STYLESHEET_H
+
+#include <QWidget>
+#include <QStyle>
+#include <QPalette>
+#include <QString>
+
+class QApplication;
+
+namespace Theme {
+    // Dynamic property matched by the application stylesheet, e.g. QLabel[themeRole="pageTitle"].
+    // Widgets opt into a look by role instead of carrying their own stylesheet, so Qt parses
+    // the rules once and shares them across every widget.
+    constexpr const char *ROLE_PROPERTY = "themeRole";
+
+    // Set before the widget is first shown; use repolish() if a role changes afterwards
+    inline void setRole(QWidget *widget, const char *role)
+    {
+        widget->setProperty(ROLE_PROPERTY, QString::fromLatin1(role));
+    }
+
+    // Re-evaluates the stylesheet after a property that a selector depends on changed
+    inline void repolish(QWidget *widget)
+    {
+        widget->style()->unpolish(widget);
+        widget->style()->polish(widget);
+        widget->update();
+    }
+
+    // The whole application stylesheet, generated from Theme.h once per process
+    QString applicationStyleSheet();
+    // Base window/text colors; widgets without a color rule draw from this palette
+    QPalette applicationPalette();
+    // Installs the font, palette and stylesheet on the application
+    void applyApplicationTheme(QApplication &app);
+}
+
+#endif // STYLESHEET_H
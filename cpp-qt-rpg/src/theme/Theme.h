@@ -30,6 +30,10 @@ namespace Theme {
     const QColor INPUT = QColor("#3e3754");
     const QColor RING = QColor("#dc3545");
 
+    const QColor GOLD = QColor("#e5c07b");     // Gold amounts and prices
+    const QColor SUCCESS = QColor("#28a745");
+    const QColor WARNING = QColor("#ffc107");
+
     // Standard Spacing Values (in pixels)
     constexpr int SPACING_XS = 4;      // Extra small spacing
     constexpr int SPACING_SM = 8;      // Small spacing (small buttons, tight spacing)
@@ -0,0 +1,218 @@
+// pyrpg-assettool: pre-scales sprites at build time and writes the manifest SpriteCache reads.
+//
+// Usage:
+//   pyrpg-assettool --source-dir <assets> --output-dir <dir> --qrc <file.qrc> [--stamp <file>] <spec.json>
+//
+// The spec lists every sprite and the logical sizes the UI shows it at, e.g.
+//   { "resourcePrefix": ":/assets/", "scales": [1, 2],
+//     "sprites": [ { "source": "warrior.png", "sizes": [100, 140] } ] }
+//
+// For each sprite, size and scale the tool writes <dir>/<name>_<size>@<scale>x.png,
+// fitted into a size*scale square with the aspect ratio kept. It also writes
+// <dir>/manifest.json, which maps each source resource path (":/assets/warrior.png")
+// to its variants, and a .qrc that bundles the output under ":/<dir name>/".
+// Sources may be any format Qt reads (some of ours are JPEGs named .png); the
+// output is always maximally compressed PNG, small enough to decode in microseconds.
+//
+// Outputs whose bytes did not change keep their timestamps so rcc has nothing to
+// redo; the build compares against --stamp instead, which is touched on every
+// successful run.
+
+#include <QBuffer>
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+#include <QImageReader>
+#include <QImageWriter>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QStringList>
+#include <QTextStream>
+
+namespace {
+
+// Writes only when the bytes differ, so unchanged outputs keep their timestamps
+// and rcc does not rebuild the resource bundle for nothing
+bool writeIfChanged(const QString &filePath, const QByteArray &contents, QTextStream &err)
+{
+    QFile existing(filePath);
+    if (existing.open(QIODevice::ReadOnly) && existing.readAll() == contents) {
+        return true;
+    }
+    existing.close();
+
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly) || file.write(contents) != contents.size() || !file.commit()) {
+        err << "Failed to write " << filePath << "\n";
+        return false;
+    }
+    return true;
+}
+
+QByteArray encodePng(const QImage &image)
+{
+    // Sources without alpha (the JPEGs) are written as RGB; quality 0 selects maximum zlib compression
+    QImage output = image.hasAlphaChannel() ? image.convertToFormat(QImage::Format_ARGB32)
+                                            : image.convertToFormat(QImage::Format_RGB32);
+    QByteArray bytes;
+    QBuffer buffer(&bytes);
+    buffer.open(QIODevice::WriteOnly);
+    QImageWriter writer(&buffer, "png");
+    writer.setQuality(0);
+    writer.write(output);
+    return bytes;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("pyrpg-assettool");
+    app.setApplicationVersion("1.0");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Pre-scale Pyrpg-Qt sprites and generate their manifest and resource file.");
+    parser.addHelpOption();
+    parser.addVersionOption();
+
+    QCommandLineOption sourceDirOption("source-dir", "Directory the spec's source paths are relative to.", "dir");
+    QCommandLineOption outputDirOption("output-dir", "Directory for the scaled sprites and manifest.json.", "dir");
+    QCommandLineOption qrcOption("qrc", "Resource file to generate for the output directory.", "file");
+    QCommandLineOption stampOption("stamp", "File touched after a successful run, for the build to depend on.", "file");
+    parser.addOption(sourceDirOption);
+    parser.addOption(outputDirOption);
+    parser.addOption(qrcOption);
+    parser.addOption(stampOption);
+    parser.addPositionalArgument("spec", "Sprite spec (JSON).");
+    parser.process(app);
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    const QStringList args = parser.positionalArguments();
+    if (args.size() != 1 || !parser.isSet(sourceDirOption) || !parser.isSet(outputDirOption) || !parser.isSet(qrcOption)) {
+        err << "Expected --source-dir, --output-dir, --qrc and exactly one spec argument.\n";
+        return 2;
+    }
+
+    QFile specFile(args.first());
+    if (!specFile.open(QIODevice::ReadOnly)) {
+        err << "Cannot read spec " << args.first() << "\n";
+        return 2;
+    }
+    QJsonParseError parseError;
+    QJsonDocument spec = QJsonDocument::fromJson(specFile.readAll(), &parseError);
+    if (spec.isNull() || !spec.isObject()) {
+        err << "Invalid spec " << args.first() << ": " << parseError.errorString() << "\n";
+        return 2;
+    }
+
+    const QJsonObject root = spec.object();
+    const QString resourcePrefix = root.value("resourcePrefix").toString(":/assets/");
+    QList<int> scales;
+    for (const QJsonValue &scale : root.value("scales").toArray()) {
+        scales.append(scale.toInt());
+    }
+    if (scales.isEmpty()) {
+        scales = {1};
+    }
+
+    QDir sourceDir(parser.value(sourceDirOption));
+    QDir outputDir(QDir(parser.value(outputDirOption)).absolutePath());
+    if (!outputDir.mkpath(".")) {
+        err << "Cannot create " << outputDir.path() << "\n";
+        return 1;
+    }
+    // Resource paths mirror the qrc: files are listed relative to the qrc's directory
+    QFileInfo qrcInfo(parser.value(qrcOption));
+    QDir qrcDir = qrcInfo.absoluteDir();
+    const QString resourceDir = ":/" + qrcDir.relativeFilePath(outputDir.absolutePath()) + "/";
+
+    QJsonArray manifestSprites;
+    QStringList qrcFiles;
+    int failed = 0;
+    qint64 sourceBytes = 0;
+    qint64 outputBytes = 0;
+
+    for (const QJsonValue &entryValue : root.value("sprites").toArray()) {
+        const QJsonObject entry = entryValue.toObject();
+        const QString source = entry.value("source").toString();
+        const QString sourcePath = sourceDir.filePath(source);
+
+        QImageReader reader(sourcePath);
+        reader.setDecideFormatFromContent(true);
+        QImage image = reader.read();
+        if (image.isNull()) {
+            err << "FAILED " << sourcePath << ": " << reader.errorString() << "\n";
+            failed++;
+            continue;
+        }
+        sourceBytes += QFileInfo(sourcePath).size();
+
+        const QString baseName = QFileInfo(source).completeBaseName();
+        for (const QJsonValue &sizeValue : entry.value("sizes").toArray()) {
+            const int size = sizeValue.toInt();
+            for (int scale : std::as_const(scales)) {
+                const QSize box(size * scale, size * scale);
+                // Never upscale; SpriteCache scales the rare oversized request itself
+                QImage scaled = image.size().boundedTo(box) == image.size()
+                    ? image
+                    : image.scaled(box, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+
+                const QString fileName = QString("%1_%2@%3x.png").arg(baseName).arg(size).arg(scale);
+                QByteArray png = encodePng(scaled);
+                if (png.isEmpty() || !writeIfChanged(outputDir.filePath(fileName), png, err)) {
+                    failed++;
+                    continue;
+                }
+                outputBytes += png.size();
+
+                manifestSprites.append(QJsonObject{
+                    {"source", resourcePrefix + source},
+                    {"size", size},
+                    {"scale", scale},
+                    {"path", resourceDir + fileName}
+                });
+                qrcFiles.append(qrcDir.relativeFilePath(outputDir.filePath(fileName)));
+            }
+        }
+    }
+
+    QJsonObject manifest{{"version", 1}, {"sprites", manifestSprites}};
+    if (!writeIfChanged(outputDir.filePath("manifest.json"), QJsonDocument(manifest).toJson(), err)) {
+        return 1;
+    }
+    qrcFiles.append(qrcDir.relativeFilePath(outputDir.filePath("manifest.json")));
+
+    QByteArray qrc = "<!DOCTYPE RCC>\n<RCC version=\"1.0\">\n<qresource prefix=\"/\">\n";
+    for (const QString &file : std::as_const(qrcFiles)) {
+        qrc += "    <file>" + file.toUtf8() + "</file>\n";
+    }
+    qrc += "</qresource>\n</RCC>\n";
+    if (!writeIfChanged(qrcInfo.absoluteFilePath(), qrc, err)) {
+        return 1;
+    }
+
+    out << "Wrote " << manifestSprites.size() << " sprite variants (" << outputBytes / 1024 << " KiB from "
+        << sourceBytes / 1024 << " KiB of sources)\n";
+    if (failed > 0) {
+        return 1;
+    }
+
+    if (parser.isSet(stampOption)) {
+        QFile stamp(parser.value(stampOption));
+        if (!stamp.open(QIODevice::WriteOnly | QIODevice::Truncate)
+            || !stamp.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime)) {
+            err << "Failed to write " << stamp.fileName() << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
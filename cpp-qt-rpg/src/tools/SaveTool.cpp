@@ -0,0 +1,244 @@
+// pyrpg-savetool: validates, upgrades or downgrades archived save files in parallel.
+//
+// Usage:
+//   pyrpg-savetool [--mode validate|upgrade|downgrade] [--target-version N]
+//                  [--threads N] [--dry-run] <directory>
+//
+// Every *.dat file under <directory> is loaded through SaveManager::loadGame and,
+// for upgrade/downgrade, rewritten through SaveManager::saveGame in the target
+// Player format version. Files are replaced atomically so an interrupted run never
+// leaves a half-written save behind.
+
+#include "persistence/SaveManager.h"
+#include "models/Player.h"
+#include <QAtomicInt>
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QRunnable>
+#include <QSaveFile>
+#include <QStringList>
+#include <QTextStream>
+#include <QThreadPool>
+
+namespace {
+
+enum class Mode { Validate, Upgrade, Downgrade };
+
+struct RunStats {
+    QAtomicInt processed;
+    QAtomicInt rewritten;
+    QAtomicInt unchanged;
+    QAtomicInt failed;
+    QMutex failureMutex;
+    QStringList failures;
+
+    void addFailure(const QString &filePath, const QString &reason)
+    {
+        failed.fetchAndAddRelaxed(1);
+        QMutexLocker locker(&failureMutex);
+        failures.append(QString("%1: %2").arg(filePath, reason));
+    }
+};
+
+class SaveFileJob : public QRunnable
+{
+public:
+    SaveFileJob(const QString &filePath, Mode mode, quint32 targetVersion, bool dryRun, RunStats *stats)
+        : m_filePath(filePath), m_mode(mode), m_targetVersion(targetVersion), m_dryRun(dryRun), m_stats(stats)
+    {
+    }
+
+    void run() override
+    {
+        process();
+        m_stats->processed.fetchAndAddRelaxed(1);
+    }
+
+private:
+    QString m_filePath;
+    Mode m_mode;
+    quint32 m_targetVersion;
+    bool m_dryRun;
+    RunStats *m_stats;
+
+    void process()
+    {
+        // SaveManager's only state is its per-instance cache of slot history counts,
+        // and a job touches only its own file, so one instance per job shares nothing
+        SaveManager saveManager;
+
+        quint32 sourceVersion = saveManager.getPlayerFormatVersion(m_filePath);
+        if (sourceVersion == 0) {
+            m_stats->addFailure(m_filePath, "not a pyrpg save");
+            return;
+        }
+
+        Player *player = saveManager.loadGame(m_filePath);
+        if (!player) {
+            m_stats->addFailure(m_filePath, QString("failed to load (format v%1)").arg(sourceVersion));
+            return;
+        }
+
+        bool needsRewrite = (m_mode == Mode::Upgrade && sourceVersion < m_targetVersion)
+                         || (m_mode == Mode::Downgrade && sourceVersion > m_targetVersion);
+        if (!needsRewrite || m_dryRun) {
+            if (needsRewrite) {
+                m_stats->rewritten.fetchAndAddRelaxed(1);
+            } else {
+                m_stats->unchanged.fetchAndAddRelaxed(1);
+            }
+            delete player;
+            return;
+        }
+
+        // Legacy (v1) names of 1-2 characters are indistinguishable from a version prefix
+        if (m_targetVersion == 1 && player->name.size() <= 2) {
+            m_stats->addFailure(m_filePath, "name too short to downgrade to format v1 unambiguously");
+            delete player;
+            return;
+        }
+
+        QString tempPath = m_filePath + ".migrating";
+        bool saved = saveManager.saveGame(player, tempPath, m_targetVersion);
+        delete player;
+
+        if (!saved) {
+            QFile::remove(tempPath);
+            m_stats->addFailure(m_filePath, "failed to write migrated save");
+            return;
+        }
+
+        // Verify the rewritten file before replacing the original
+        Player *verified = saveManager.loadGame(tempPath);
+        if (!verified) {
+            QFile::remove(tempPath);
+            m_stats->addFailure(m_filePath, "migrated save failed verification");
+            return;
+        }
+        delete verified;
+
+        // QSaveFile renames over the original on commit(), so the target always
+        // holds either the old save or the complete new one
+        QFile migrated(tempPath);
+        QSaveFile target(m_filePath);
+        bool replaced = migrated.open(QIODevice::ReadOnly) && target.open(QIODevice::WriteOnly);
+        if (replaced) {
+            QByteArray data = migrated.readAll();
+            replaced = target.write(data) == data.size() && target.commit();
+        }
+        migrated.close();
+        QFile::remove(tempPath);
+        if (!replaced) {
+            m_stats->addFailure(m_filePath, "failed to replace original with migrated save");
+            return;
+        }
+        m_stats->rewritten.fetchAndAddRelaxed(1);
+    }
+};
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("pyrpg-savetool");
+    app.setApplicationVersion("1.0");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Validate, upgrade or downgrade Pyrpg-Qt save files in bulk.");
+    parser.addHelpOption();
+    parser.addVersionOption();
+
+    QCommandLineOption modeOption("mode", "validate (default), upgrade or downgrade.", "mode", "validate");
+    QCommandLineOption targetOption("target-version",
+                                    QString("Player format version to write (1-%1, default %1).")
+                                        .arg(Player::CURRENT_SAVE_VERSION),
+                                    "version", QString::number(Player::CURRENT_SAVE_VERSION));
+    QCommandLineOption threadsOption("threads", "Worker threads (default: all cores).", "count");
+    QCommandLineOption dryRunOption("dry-run", "Report what would change without writing files.");
+    parser.addOption(modeOption);
+    parser.addOption(targetOption);
+    parser.addOption(threadsOption);
+    parser.addOption(dryRunOption);
+    parser.addPositionalArgument("directory", "Directory to scan recursively for *.dat saves.");
+    parser.process(app);
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    const QStringList args = parser.positionalArguments();
+    if (args.size() != 1) {
+        err << "Expected exactly one directory argument.\n";
+        return 2;
+    }
+
+    Mode mode;
+    QString modeName = parser.value(modeOption);
+    if (modeName == "validate") {
+        mode = Mode::Validate;
+    } else if (modeName == "upgrade") {
+        mode = Mode::Upgrade;
+    } else if (modeName == "downgrade") {
+        mode = Mode::Downgrade;
+    } else {
+        err << "Unknown mode: " << modeName << "\n";
+        return 2;
+    }
+
+    bool ok = false;
+    quint32 targetVersion = parser.value(targetOption).toUInt(&ok);
+    if (!ok || targetVersion < 1 || targetVersion > Player::CURRENT_SAVE_VERSION) {
+        err << "Invalid target version: " << parser.value(targetOption) << "\n";
+        return 2;
+    }
+
+    QThreadPool *pool = QThreadPool::globalInstance();
+    if (parser.isSet(threadsOption)) {
+        int threads = parser.value(threadsOption).toInt(&ok);
+        if (!ok || threads < 1) {
+            err << "Invalid thread count: " << parser.value(threadsOption) << "\n";
+            return 2;
+        }
+        pool->setMaxThreadCount(threads);
+    }
+
+    // Saves are small, so per-file work is dominated by I/O and decoding;
+    // queueing every file up front keeps all workers busy.
+    RunStats stats;
+    int queued = 0;
+    QElapsedTimer timer;
+    timer.start();
+
+    QDirIterator it(args.first(), {"*.dat"}, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        pool->start(new SaveFileJob(it.next(), mode, targetVersion, parser.isSet(dryRunOption), &stats));
+        queued++;
+    }
+    pool->waitForDone();
+
+    double seconds = timer.elapsed() / 1000.0;
+    double throughput = seconds > 0.0 ? queued / seconds : 0.0;
+
+    out << "Processed " << stats.processed.loadRelaxed() << " of " << queued << " saves"
+        << " in " << QString::number(seconds, 'f', 2) << " s"
+        << " (" << QString::number(throughput, 'f', 1) << " saves/s, "
+        << pool->maxThreadCount() << " threads)\n";
+    out << "  " << (mode == Mode::Validate ? "valid:     " : "unchanged: ") << stats.unchanged.loadRelaxed() << "\n";
+    if (mode != Mode::Validate) {
+        out << "  " << (parser.isSet(dryRunOption) ? "would rewrite: " : "rewritten: ")
+            << stats.rewritten.loadRelaxed() << "\n";
+    }
+    out << "  failed:    " << stats.failed.loadRelaxed() << "\n";
+
+    stats.failures.sort();
+    for (const QString &failure : std::as_const(stats.failures)) {
+        err << "FAILED " << failure << "\n";
+    }
+
+    return stats.failed.loadRelaxed() > 0 ? 1 : 0;
+}
@@ -2,6 +2,7 @@
 #define CHARACTERCUSTOMIZATIONPAGE_H
 
 #include <QWidget>
+#include "../diagnostics/AllocationTracker.h"
 
 class CharacterPreviewWidget;
 class CustomizationSection;
@@ -13,6 +14,7 @@ class CharacterCustomizationPage : public QWidget
 {
     Q_OBJECT
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.pages")
     explicit CharacterCustomizationPage(QWidget *parent = nullptr);
 
 private:
@@ -1,26 +1,24 @@
 #include "CombatPage.h"
+#include "../diagnostics/Profiler.h"
 #include "../theme/Theme.h"
+#include "../theme/StyleSheet.h"
 #include "../models/Player.h"
 #include "../models/Monster.h"
-#include "../components/ParticleSystem.h"
+#include "../components/QuestListModel.h"
+#include "../components/LogDisplay.h"
 #include <QHBoxLayout>
 #include <QVBoxLayout>
 #include <QGridLayout>
 #include <QLabel>
-#include <QProgressBar>
 #include <QPushButton>
-#include <QTextEdit>
+#include <QListView>
 #include <QFrame>
 #include <QFont>
 
-CombatPage::CombatPage(QWidget *parent) : QWidget(parent), m_inCombat(false)
+CombatPage::CombatPage(QWidget *parent)
+    : QWidget(parent), m_inCombat(false), m_questTrackerPanel(nullptr), m_questTracker(nullptr), m_activeQuests(nullptr)
 {
     setupUi();
-
-    // Initialize particle system after UI is set up
-    m_particleSystem = new ParticleSystem(this);
-    m_particleSystem->setGeometry(rect());
-    m_particleSystem->raise(); // Ensure particles appear on top
 }
 
 void CombatPage::setupUi()
@@ -42,7 +40,7 @@ void CombatPage::setupUi()
 QWidget* CombatPage::createArenaCard()
 {
     QFrame *card = new QFrame();
-    card->setStyleSheet(QString("background-color: %1; border-radius: %2px;").arg(Theme::CARD.name()).arg(Theme::BORDER_RADIUS_MD));
+    Theme::setRole(card, "card");
     m_cardLayout = new QVBoxLayout(card);
 
     QLabel *title = new QLabel("⚔️ Battle Arena");
@@ -50,63 +48,11 @@ QWidget* CombatPage::createArenaCard()
     titleFont.setPointSize(18);
     titleFont.setBold(true);
     title->setFont(titleFont);
-    title->setStyleSheet(QString("color: %1; margin-bottom: %2px;").arg(Theme::PRIMARY.name()).arg(Theme::SPACING_SM));
+    Theme::setRole(title, "cardTitle");
     m_cardLayout->addWidget(title);
 
-    QFrame *spritesContainer = new QFrame();
-    spritesContainer->setFrameShape(QFrame::Box);
-    spritesContainer->setStyleSheet(QString(
-        "QFrame { border: 2px solid %1; border-radius: %2px; background-color: %3; padding: %4px; }"
-    ).arg(Theme::BORDER.name()).arg(Theme::BORDER_RADIUS_MD).arg(Theme::CARD.name()).arg(Theme::SPACING_MD));
-    QHBoxLayout *spritesLayout = new QHBoxLayout(spritesContainer);
-    spritesLayout->setSpacing(Theme::SPACING_MD);
-
-    m_heroSpriteLabel = new QLabel("🛡️ HERO");
-    m_heroSpriteLabel->setAlignment(Qt::AlignCenter);
-    m_heroSpriteLabel->setMinimumSize(100, 100);
-    m_enemySpriteLabel = new QLabel("👹 ENEMY");
-    m_enemySpriteLabel->setAlignment(Qt::AlignCenter);
-    m_enemySpriteLabel->setMinimumSize(100, 100);
-
-    spritesLayout->addWidget(m_heroSpriteLabel);
-    spritesLayout->addWidget(new QLabel("⚔️"));
-    spritesLayout->addWidget(m_enemySpriteLabel);
-    m_cardLayout->addWidget(spritesContainer);
-
-    // Monster name/level display
-    m_monsterNameLabel = new QLabel("Unknown Monster");
-    m_monsterNameLabel->setAlignment(Qt::AlignCenter);
-    m_monsterNameLabel->setStyleSheet(QString("font-size: 16px; font-weight: bold; color: %1;").arg(Theme::FOREGROUND.name()));
-    m_cardLayout->addWidget(m_monsterNameLabel);
-
-    // Hero stats
-    m_cardLayout->addWidget(new QLabel("❤️ Hero Health"));
-    m_heroHealthBar = new QProgressBar();
-    m_heroHealthBar->setRange(0, 100);
-    m_heroHealthBar->setValue(100);
-    m_heroHealthBar->setTextVisible(true);
-    m_heroHealthBar->setFormat("100 / 100 HP");
-    m_heroHealthBar->setStyleSheet("QProgressBar { border: 2px solid grey; border-radius: 5px; text-align: center; } QProgressBar::chunk { background-color: #dc3545; }");
-    m_cardLayout->addWidget(m_heroHealthBar);
-
-    m_cardLayout->addWidget(new QLabel("💙 Hero Mana"));
-    m_heroManaBar = new QProgressBar();
-    m_heroManaBar->setRange(0, 100);
-    m_heroManaBar->setValue(100);
-    m_heroManaBar->setTextVisible(true);
-    m_heroManaBar->setFormat("100 / 100 MP");
-    m_heroManaBar->setStyleSheet("QProgressBar { border: 2px solid grey; border-radius: 5px; text-align: center; } QProgressBar::chunk { background-color: #3b82f6; }");
-    m_cardLayout->addWidget(m_heroManaBar);
-
-    // Enemy stats
-    m_cardLayout->addWidget(new QLabel("💀 Enemy Health"));
-    m_enemyHealthBar = new QProgressBar();
-    m_enemyHealthBar->setRange(0, 100);
-    m_enemyHealthBar->setValue(100);
-    m_enemyHealthBar->setTextVisible(true);
-    m_enemyHealthBar->setFormat("100 / 100 HP");
-    m_enemyHealthBar->setStyleSheet("QProgressBar { border: 2px solid grey; border-radius: 5px; text-align: center; } QProgressBar::chunk { background-color: #ef4444; }");
-    m_cardLayout->addWidget(m_enemyHealthBar);
+    m_canvas = new CombatCanvas();
+    m_cardLayout->addWidget(m_canvas, 1);
 
     // Actions layout will be added in setCombatMode
     m_actionsLayout = nullptr;
@@ -116,39 +62,19 @@ QWidget* CombatPage::createArenaCard()
 
 void CombatPage::updateCombatState(Player *player, Monster *monster, const QString &log)
 {
+    PYRPG_PROFILE_SCOPE("CombatPage::updateCombatState");
     if (player) {
-        m_heroHealthBar->setMaximum(player->maxHealth);
-        m_heroHealthBar->setValue(player->health);
-        m_heroHealthBar->setFormat(QString("%1 / %2 HP").arg(player->health).arg(player->maxHealth));
-
-        m_heroManaBar->setMaximum(player->maxMana);
-        m_heroManaBar->setValue(player->mana);
-        m_heroManaBar->setFormat(QString("%1 / %2 MP").arg(player->mana).arg(player->maxMana));
-
-        // Try to load character sprite
-        QString spritePath = QString(":/assets/%1.png").arg(player->characterClass.toLower());
-        QPixmap sprite(spritePath);
-        if (!sprite.isNull()) {
-            m_heroSpriteLabel->setPixmap(sprite.scaled(100, 100, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-        }
+        m_canvas->setHero(QString(":/assets/%1.png").arg(player->characterClass.toLower()),
+                          player->health, player->maxHealth, player->mana, player->maxMana);
     }
     if (monster) {
-        m_enemyHealthBar->setMaximum(monster->maxHealth);
-        m_enemyHealthBar->setValue(monster->health);
-        m_enemyHealthBar->setFormat(QString("%1 / %2 HP").arg(monster->health).arg(monster->maxHealth));
-
-        // Update monster name and level
-        m_monsterNameLabel->setText(QString("%1 (Level %2)").arg(monster->name).arg(monster->level));
-
-        // Try to load monster sprite based on enemyType
-        QString spritePath = QString(":/assets/%1.png").arg(monster->enemyType);
-        QPixmap sprite(spritePath);
-        if (!sprite.isNull()) {
-            m_enemySpriteLabel->setPixmap(sprite.scaled(100, 100, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-        }
+        // Monster sprite based on enemyType
+        m_canvas->setEnemy(QString(":/assets/%1.png").arg(monster->enemyType),
+                           QString("%1 (Level %2)").arg(monster->name).arg(monster->level),
+                           monster->health, monster->maxHealth);
     }
     if (!log.isEmpty()) {
-        m_battleLog->append(log);
+        m_battleLog->addEntry(log, "combat");
     }
 }
 
@@ -171,7 +97,7 @@ void CombatPage::setCombatActive(bool active)
 QWidget* CombatPage::createLogCard()
 {
     QFrame *card = new QFrame();
-    card->setStyleSheet(QString("background-color: %1; border-radius: %2px;").arg(Theme::CARD.name()).arg(Theme::BORDER_RADIUS_MD));
+    Theme::setRole(card, "card");
     QVBoxLayout *layout = new QVBoxLayout(card);
 
     QLabel *title = new QLabel("📜 Battle Log");
@@ -179,17 +105,61 @@ QWidget* CombatPage::createLogCard()
     titleFont.setPointSize(18);
     titleFont.setBold(true);
     title->setFont(titleFont);
-    title->setStyleSheet(QString("color: %1; margin-bottom: %2px;").arg(Theme::PRIMARY.name()).arg(Theme::SPACING_SM));
+    Theme::setRole(title, "cardTitle");
     layout->addWidget(title);
 
-    m_battleLog = new QTextEdit();
-    m_battleLog->setReadOnly(true);
-    m_battleLog->setText("A wild enemy appears!\nPrepare for battle!");
+    m_battleLog = new LogDisplay(BATTLE_LOG_CAPACITY);
+    m_battleLog->addEntry("A wild enemy appears!\nPrepare for battle!", "combat");
     layout->addWidget(m_battleLog);
 
+    layout->addWidget(createQuestTracker());
+
     return card;
 }
 
+QWidget* CombatPage::createQuestTracker()
+{
+    m_questTrackerPanel = new QWidget();
+    QVBoxLayout *layout = new QVBoxLayout(m_questTrackerPanel);
+    layout->setContentsMargins(0, Theme::SPACING_SM, 0, 0);
+    layout->setSpacing(Theme::SPACING_XS);
+
+    QLabel *title = new QLabel("🎯 Active Quests");
+    Theme::setRole(title, "trackerTitle");
+    layout->addWidget(title);
+
+    // Read-only: rows update in place as quest progress signals arrive
+    m_questTracker = new QListView();
+    m_questTracker->setSelectionMode(QAbstractItemView::NoSelection);
+    m_questTracker->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_questTracker->setFocusPolicy(Qt::NoFocus);
+    m_questTracker->setUniformItemSizes(true);
+    m_questTracker->setMaximumHeight(90);
+    Theme::setRole(m_questTracker, "questTracker");
+    layout->addWidget(m_questTracker);
+
+    m_questTrackerPanel->hide();
+    return m_questTrackerPanel;
+}
+
+void CombatPage::setQuestModel(QAbstractItemModel *questModel)
+{
+    if (!m_activeQuests) {
+        m_activeQuests = new ActiveQuestFilterModel(this);
+        m_questTracker->setModel(m_activeQuests);
+        connect(m_activeQuests, &QAbstractItemModel::rowsInserted, this, &CombatPage::updateQuestTrackerVisibility);
+        connect(m_activeQuests, &QAbstractItemModel::rowsRemoved, this, &CombatPage::updateQuestTrackerVisibility);
+        connect(m_activeQuests, &QAbstractItemModel::modelReset, this, &CombatPage::updateQuestTrackerVisibility);
+    }
+    m_activeQuests->setSourceModel(questModel);
+    updateQuestTrackerVisibility();
+}
+
+void CombatPage::updateQuestTrackerVisibility()
+{
+    m_questTrackerPanel->setVisible(m_activeQuests && m_activeQuests->rowCount() > 0);
+}
+
 QLayout* CombatPage::createCombatActionsLayout()
 {
     QGridLayout *actionsLayout = new QGridLayout();
@@ -225,37 +195,28 @@ QLayout* CombatPage::createNonCombatActionsLayout()
     titleFont.setPointSize(16);
     titleFont.setBold(true);
     title->setFont(titleFont);
-    title->setStyleSheet(QString("color: %1; margin-bottom: %2px;").arg(Theme::PRIMARY.name()).arg(Theme::SPACING_SM));
+    Theme::setRole(title, "cardTitle");
     title->setAlignment(Qt::AlignCenter);
     actionsLayout->addWidget(title);
 
     QLabel *shortcutsHint = new QLabel("Keyboard shortcuts: I (Inventory), S (Shop), L (Save/Load)");
-    shortcutsHint->setStyleSheet(QString("color: %1; font-size: 12px;").arg(Theme::MUTED_FOREGROUND.name()));
+    Theme::setRole(shortcutsHint, "hint");
     shortcutsHint->setAlignment(Qt::AlignCenter);
     actionsLayout->addWidget(shortcutsHint);
 
     QPushButton *exploreButton = new QPushButton("🏞️ Explore");
     exploreButton->setMinimumHeight(60);
-    exploreButton->setStyleSheet(QString(
-        "QPushButton { background-color: %1; color: %2; border-radius: 8px; padding: 10px; font-size: 16px; font-weight: bold; }"
-        "QPushButton:hover { background-color: %3; }"
-    ).arg(Theme::PRIMARY.name()).arg(Theme::PRIMARY_FOREGROUND.name()).arg(Theme::PRIMARY.darker(110).name()));
+    Theme::setRole(exploreButton, "primaryAction");
     connect(exploreButton, &QPushButton::clicked, this, &CombatPage::exploreClicked);
 
     QPushButton *restButton = new QPushButton("😴 Rest");
     restButton->setMinimumHeight(60);
-    restButton->setStyleSheet(QString(
-        "QPushButton { background-color: %1; color: %2; border-radius: 8px; padding: 10px; font-size: 16px; font-weight: bold; }"
-        "QPushButton:hover { background-color: %3; }"
-    ).arg(Theme::SECONDARY.name()).arg(Theme::FOREGROUND.name()).arg(Theme::SECONDARY.darker(110).name()));
+    Theme::setRole(restButton, "secondaryAction");
     connect(restButton, &QPushButton::clicked, this, &CombatPage::restClicked);
 
     QPushButton *menuButton = new QPushButton("📋 Menu");
     menuButton->setMinimumHeight(60);
-    menuButton->setStyleSheet(QString(
-        "QPushButton { background-color: %1; color: %2; border-radius: 8px; padding: 10px; font-size: 16px; font-weight: bold; }"
-        "QPushButton:hover { background-color: %3; }"
-    ).arg(Theme::ACCENT.name()).arg(Theme::ACCENT_FOREGROUND.name()).arg(Theme::ACCENT.darker(110).name()));
+    Theme::setRole(menuButton, "accentAction");
     connect(menuButton, &QPushButton::clicked, this, &CombatPage::menuClicked);
 
     actionsLayout->addWidget(exploreButton);
@@ -269,8 +230,10 @@ QLayout* CombatPage::createNonCombatActionsLayout()
 void CombatPage::setCombatMode(bool inCombat)
 {
     if (m_inCombat == inCombat && m_actionsLayout != nullptr) return;
+    PYRPG_PROFILE_SCOPE("CombatPage::setCombatMode");
 
     m_inCombat = inCombat;
+    m_canvas->setCombatMode(inCombat);
 
     // Clear all items from the card layout (except the fixed ones)
     // We need to be careful to only remove the dynamic actions layout
@@ -300,20 +263,12 @@ void CombatPage::setCombatMode(bool inCombat)
     // Create new actions based on mode
     if (inCombat) {
         m_actionsLayout = createCombatActionsLayout();
-        m_heroSpriteLabel->show();
-        m_heroManaBar->show();
-        m_enemySpriteLabel->show();
-        m_monsterNameLabel->show();
-        m_enemyHealthBar->show();
-        m_battleLog->setText("A wild enemy appears!\nPrepare for battle!");
+        m_battleLog->clearEntries();
+        m_battleLog->addEntry("A wild enemy appears!\nPrepare for battle!", "combat");
     } else {
         m_actionsLayout = createNonCombatActionsLayout();
-        m_heroSpriteLabel->hide();
-        m_heroManaBar->hide();
-        m_enemySpriteLabel->hide();
-        m_monsterNameLabel->hide();
-        m_enemyHealthBar->hide();
-        m_battleLog->setText("Welcome to the Realm of Legends!\nWhat would you like to do?");
+        m_battleLog->clearEntries();
+        m_battleLog->addEntry("Welcome to the Realm of Legends!\nWhat would you like to do?");
     }
 
     // Add the new layout to the card
@@ -326,29 +281,16 @@ void CombatPage::setCombatMode(bool inCombat)
 
     
 
-QLabel* CombatPage::getHeroSpriteLabel()
-{
-    return m_heroSpriteLabel;
-}
-
-    
-
-QLabel* CombatPage::getEnemySpriteLabel()
-{
-    return m_enemySpriteLabel;
-}
-
-ParticleSystem* CombatPage::getParticleSystem()
+CombatCanvas* CombatPage::getCombatCanvas()
 {
-    return m_particleSystem;
+    return m_canvas;
 }
 
 void CombatPage::addLogEntry(const QString &message, const QString &type)
 {
-    // Simple implementation - just append to the battle log
-    // The type parameter is optional and could be used for color-coding in the future
+    // The type selects the entry's border color; untyped entries are plain info
     if (m_battleLog) {
-        m_battleLog->append(message);
+        m_battleLog->addEntry(message, type.isEmpty() ? QString("info") : type);
     }
 }
 
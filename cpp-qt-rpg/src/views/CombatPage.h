@@ -2,32 +2,37 @@
 #define COMBATPAGE_H
 
 #include <QWidget>
+#include <QString>
+#include "../diagnostics/AllocationTracker.h"
+#include "../components/CombatCanvas.h"
 
-class QLabel;
-class QProgressBar;
 class QPushButton;
-class QTextEdit;
 class QVBoxLayout;
+class QListView;
+class QAbstractItemModel;
+class QSortFilterProxyModel;
 class Player;
 class Monster;
-class ParticleSystem;
+class LogDisplay;
 
 class CombatPage : public QWidget
 {
 Q_OBJECT
 Q_PROPERTY(bool inCombat READ isInCombat)
 public:
+PYRPG_TRACK_ALLOCATIONS("widgets.pages")
+static const int SPRITE_SIZE = CombatCanvas::SPRITE_SIZE;  // Hero and enemy sprites, logical pixels
 explicit CombatPage(QWidget *parent = nullptr);
 void updateCombatState(Player *player, Monster *monster, const QString &log);
 void setCombatActive(bool active);
 void setCombatMode(bool inCombat);
     bool isInCombat() const { return m_inCombat; }
     void addLogEntry(const QString &message, const QString &type = "");
+    // Shows active quests from a QuestListModel in the always-visible tracker
+    void setQuestModel(QAbstractItemModel *questModel);
 
-    // Accessors for AnimationManager
-    QLabel* getHeroSpriteLabel();
-    QLabel* getEnemySpriteLabel();
-    ParticleSystem* getParticleSystem();
+    // Arena that AnimationManager animates
+    CombatCanvas* getCombatCanvas();
 
 signals:
 void attackClicked();
@@ -45,14 +50,13 @@ private:
     QWidget* createLogCard();
     QLayout* createCombatActionsLayout();
     QLayout* createNonCombatActionsLayout();
+    QWidget* createQuestTracker();
+    void updateQuestTrackerVisibility();
 
-    // Arena widgets
-    QLabel *m_heroSpriteLabel;
-    QLabel *m_enemySpriteLabel;
-    QLabel *m_monsterNameLabel;
-    QProgressBar *m_heroHealthBar;
-    QProgressBar *m_heroManaBar;
-    QProgressBar *m_enemyHealthBar;
+    static const int BATTLE_LOG_CAPACITY = 500;  // Older lines are dropped
+
+    // Arena: sprites, bars, damage numbers and particles in one painted widget
+    CombatCanvas *m_canvas;
 
     // UI state
     QVBoxLayout *m_cardLayout;
@@ -60,10 +64,12 @@ private:
     bool m_inCombat;
 
     // Log widgets
-    QTextEdit *m_battleLog;
+    LogDisplay *m_battleLog;
 
-    // Particle effects
-    ParticleSystem *m_particleSystem;
+    // Quest tracker (active quests, filtered from the shared quest model)
+    QWidget *m_questTrackerPanel;
+    QListView *m_questTracker;
+    QSortFilterProxyModel *m_activeQuests;
 };
 
 #endif // COMBATPAGE_H
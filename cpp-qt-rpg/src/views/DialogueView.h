@@ -8,12 +8,14 @@
 #include <QVBoxLayout>
 #include <QList>
 #include <QKeyEvent>
+#include "../diagnostics/AllocationTracker.h"
 
 class DialogueView : public QDialog
 {
     Q_OBJECT
 
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.pages")
     explicit DialogueView(QWidget *parent = nullptr);
 
     // Display dialogue node
@@ -2,12 +2,15 @@
 #define INVENTORYPAGE_H
 
 #include <QWidget>
+#include "../diagnostics/AllocationTracker.h"
 
 class QLabel;
 class QKeyEvent;
-class QGridLayout;
-class QPushButton;
 class QFrame;
+class QListView;
+class QModelIndex;
+class InventoryModel;
+class InventoryItemDelegate;
 class Player;
 class Item;
 
@@ -15,8 +18,11 @@ class InventoryPage : public QWidget
 {
     Q_OBJECT
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.pages")
     explicit InventoryPage(QWidget *parent = nullptr);
     void updateInventory(Player *player);
+    // Rebuilds the grid for a player that replaced the previous one
+    void setPlayer(Player *player);
 
 signals:
     void backRequested();
@@ -31,22 +37,22 @@ private slots:
 
 private:
     void setupUi();
-    void clearInventory();
-    QWidget* createItemCard(Item *item);
-    QWidget* createEquipmentPanel(Player *player);
-    void updateSelectionDisplay();
+    QFrame* createEquipmentPanel();
+    QLabel* addEquipmentSlot(QLayout *layout, const QString &title);
+    // Updates the labels outside the item grid; rows are kept in sync by the model
+    void refreshSummary();
+    Item* selectedItem() const;
 
     Player *m_currentPlayer;
     QLabel *m_goldLabel;
-    QGridLayout *m_inventoryGridLayout;
+    QListView *m_inventoryView;
+    InventoryModel *m_model;
+    InventoryItemDelegate *m_delegate;
+    QLabel *m_emptyLabel;
     QFrame *m_equipmentPanel;
     QLabel *m_weaponSlot;
     QLabel *m_armorSlot;
     QLabel *m_accessorySlot;
-
-    QList<Item*> m_items;
-    QList<QWidget*> m_itemCards;
-    int m_selectedIndex;
 };
 
 #endif // INVENTORYPAGE_H
\ No newline at end of file
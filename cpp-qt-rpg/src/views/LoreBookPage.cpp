@@ -1,10 +1,25 @@
 #include "LoreBookPage.h"
+#include "../diagnostics/Profiler.h"
 #include "../theme/Theme.h"
+#include "../theme/StyleSheet.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QFont>
 #include <QVariant>
 
+namespace {
+QString searchKindLabel(SearchDocument::Kind kind)
+{
+    switch (kind) {
+        case SearchDocument::Lore: return "Lore";
+        case SearchDocument::Quest: return "Quest";
+        case SearchDocument::Item: return "Item";
+        case SearchDocument::Dialogue: return "Dialogue";
+    }
+    return QString();
+}
+}
+
 LoreBookPage::LoreBookPage(QWidget *parent)
     : QWidget(parent)
     , m_codexManager(nullptr)
@@ -26,12 +41,20 @@ void LoreBookPage::setupUi()
     titleFont.setPixelSize(Theme::FONT_SIZE_XXL);
     titleFont.setBold(true);
     m_titleLabel->setFont(titleFont);
-    m_titleLabel->setStyleSheet(QString("color: %1; padding: %2px;")
-                                .arg(Theme::PRIMARY.name())
-                                .arg(Theme::SPACING_SM));
+    Theme::setRole(m_titleLabel, "loreTitle");
     m_titleLabel->setAlignment(Qt::AlignCenter);
     mainLayout->addWidget(m_titleLabel);
 
+    // Search box (hidden until a search function is provided)
+    m_searchEdit = new QLineEdit(this);
+    m_searchEdit->setPlaceholderText("Search lore, quests, items and dialogue...");
+    m_searchEdit->setClearButtonEnabled(true);
+    m_searchEdit->setMinimumHeight(36);
+    Theme::setRole(m_searchEdit, "loreSearch");
+    m_searchEdit->setVisible(false);
+    connect(m_searchEdit, &QLineEdit::textChanged, this, &LoreBookPage::handleSearchTextChanged);
+    mainLayout->addWidget(m_searchEdit);
+
     // Content layout (tabs + list + details)
     QHBoxLayout *contentLayout = new QHBoxLayout();
     contentLayout->setSpacing(Theme::SPACING_MD);
@@ -46,39 +69,7 @@ void LoreBookPage::setupUi()
     m_categoryTabs->addTab(new QWidget(), "Characters");
     m_categoryTabs->addTab(new QWidget(), "Locations");
 
-    m_categoryTabs->setStyleSheet(QString(
-        "QTabWidget::pane {"
-        "    border: none;"
-        "}"
-        "QTabBar::tab {"
-        "    background-color: %1;"
-        "    color: %2;"
-        "    padding: %3px %4px;"
-        "    border: %5px solid %6;"
-        "    border-radius: %7px;"
-        "    margin: %8px;"
-        "    min-width: 80px;"
-        "}"
-        "QTabBar::tab:selected {"
-        "    background-color: %9;"
-        "    color: %10;"
-        "    border-color: %11;"
-        "}"
-        "QTabBar::tab:hover {"
-        "    background-color: %12;"
-        "}"
-    ).arg(Theme::CARD.name())
-     .arg(Theme::FOREGROUND.name())
-     .arg(Theme::SPACING_MD)
-     .arg(Theme::SPACING_SM)
-     .arg(Theme::BORDER_WIDTH_THIN)
-     .arg(Theme::BORDER.name())
-     .arg(Theme::BORDER_RADIUS_SM)
-     .arg(Theme::SPACING_XS)
-     .arg(Theme::ACCENT.name())
-     .arg(Theme::ACCENT_FOREGROUND.name())
-     .arg(Theme::ACCENT.name())
-     .arg(Theme::SECONDARY.name()));
+    Theme::setRole(m_categoryTabs, "loreCategories");
 
     connect(m_categoryTabs, &QTabWidget::currentChanged, this, &LoreBookPage::handleCategoryChanged);
     contentLayout->addWidget(m_categoryTabs);
@@ -91,38 +82,7 @@ void LoreBookPage::setupUi()
     listFont.setPixelSize(Theme::FONT_SIZE_MD);
     m_entryList->setFont(listFont);
 
-    m_entryList->setStyleSheet(QString(
-        "QListWidget {"
-        "    background-color: %1;"
-        "    color: %2;"
-        "    border: %3px solid %4;"
-        "    border-radius: %5px;"
-        "    padding: %6px;"
-        "}"
-        "QListWidget::item {"
-        "    padding: %7px;"
-        "    border-radius: %8px;"
-        "    margin: %9px;"
-        "}"
-        "QListWidget::item:selected {"
-        "    background-color: %10;"
-        "    color: %11;"
-        "}"
-        "QListWidget::item:hover {"
-        "    background-color: %12;"
-        "}"
-    ).arg(Theme::CARD.name())
-     .arg(Theme::FOREGROUND.name())
-     .arg(Theme::BORDER_WIDTH_THIN)
-     .arg(Theme::BORDER.name())
-     .arg(Theme::BORDER_RADIUS_MD)
-     .arg(Theme::SPACING_SM)
-     .arg(Theme::SPACING_SM)
-     .arg(Theme::BORDER_RADIUS_SM)
-     .arg(Theme::SPACING_XS)
-     .arg(Theme::ACCENT.name())
-     .arg(Theme::ACCENT_FOREGROUND.name())
-     .arg(Theme::SECONDARY.name()));
+    Theme::setRole(m_entryList, "loreEntries");
 
     connect(m_entryList, &QListWidget::itemClicked, this, &LoreBookPage::handleEntryClicked);
     contentLayout->addWidget(m_entryList);
@@ -134,20 +94,7 @@ void LoreBookPage::setupUi()
     detailsFont.setPixelSize(Theme::FONT_SIZE_MD);
     m_entryDetails->setFont(detailsFont);
 
-    m_entryDetails->setStyleSheet(QString(
-        "QTextEdit {"
-        "    background-color: %1;"
-        "    color: %2;"
-        "    border: %3px solid %4;"
-        "    border-radius: %5px;"
-        "    padding: %6px;"
-        "}"
-    ).arg(Theme::CARD.name())
-     .arg(Theme::FOREGROUND.name())
-     .arg(Theme::BORDER_WIDTH_THIN)
-     .arg(Theme::BORDER.name())
-     .arg(Theme::BORDER_RADIUS_MD)
-     .arg(Theme::SPACING_MD));
+    Theme::setRole(m_entryDetails, "loreDetails");
 
     m_entryDetails->setHtml(QString(
         "<div style='text-align: center; color: %1; padding: 50px;'>"
@@ -170,26 +117,7 @@ void LoreBookPage::setupUi()
     btnFont.setPixelSize(Theme::FONT_SIZE_MD);
     m_backButton->setFont(btnFont);
 
-    m_backButton->setStyleSheet(QString(
-        "QPushButton {"
-        "    background-color: %1;"
-        "    color: %2;"
-        "    border: %3px solid %4;"
-        "    border-radius: %5px;"
-        "    padding: %6px;"
-        "}"
-        "QPushButton:hover {"
-        "    background-color: %7;"
-        "    border-color: %8;"
-        "}"
-    ).arg(Theme::SECONDARY.name())
-     .arg(Theme::SECONDARY_FOREGROUND.name())
-     .arg(Theme::BORDER_WIDTH_THIN)
-     .arg(Theme::BORDER.name())
-     .arg(Theme::BORDER_RADIUS_SM)
-     .arg(Theme::SPACING_MD)
-     .arg(Theme::MUTED.name())
-     .arg(Theme::ACCENT.name()));
+    Theme::setRole(m_backButton, "backButton");
 
     connect(m_backButton, &QPushButton::clicked, this, &LoreBookPage::backRequested);
 
@@ -197,15 +125,55 @@ void LoreBookPage::setupUi()
     backLayout->addStretch();
     backLayout->addWidget(m_backButton);
     mainLayout->addLayout(backLayout);
-
-    // Apply theme to widget
-    setStyleSheet(QString("QWidget { background-color: %1; }").arg(Theme::BACKGROUND.name()));
 }
 
 void LoreBookPage::updateLore(CodexManager *codexManager)
 {
+    PYRPG_PROFILE_SCOPE("LoreBookPage::updateLore");
     m_codexManager = codexManager;
-    refreshEntryList(m_currentCategory);
+    if (!m_searchEdit->text().trimmed().isEmpty()) {
+        handleSearchTextChanged(m_searchEdit->text());  // Keep showing the player's last search
+    } else {
+        refreshEntryList(m_currentCategory);
+    }
+}
+
+void LoreBookPage::setSearchFunction(const SearchFunction &searchFunction)
+{
+    m_searchFunction = searchFunction;
+    m_searchEdit->setVisible(static_cast<bool>(m_searchFunction));
+}
+
+void LoreBookPage::handleSearchTextChanged(const QString &text)
+{
+    PYRPG_PROFILE_SCOPE("LoreBookPage::handleSearchTextChanged");
+    if (!m_searchFunction || text.trimmed().isEmpty()) {
+        m_searchResults.clear();
+        refreshEntryList(m_currentCategory);
+        return;
+    }
+
+    // Results as you type; the index answers prefix queries without scanning the catalog
+    m_searchResults = m_searchFunction(text);
+    m_entryList->clear();
+
+    if (m_searchResults.isEmpty()) {
+        QListWidgetItem *item = new QListWidgetItem("No matches");
+        item->setFlags(item->flags() & ~Qt::ItemIsEnabled);
+        QFont italicFont;
+        italicFont.setItalic(true);
+        item->setFont(italicFont);
+        item->setForeground(Theme::MUTED_FOREGROUND);
+        m_entryList->addItem(item);
+        return;
+    }
+
+    for (int i = 0; i < m_searchResults.size(); ++i) {
+        const SearchDocument &result = m_searchResults[i];
+        QListWidgetItem *item = new QListWidgetItem(QString("%1  [%2]").arg(result.title, searchKindLabel(result.kind)));
+        item->setData(Qt::UserRole + 1, i);
+        m_entryList->addItem(item);
+    }
 }
 
 void LoreBookPage::handleCategoryChanged(int index)
@@ -213,12 +181,14 @@ void LoreBookPage::handleCategoryChanged(int index)
     QStringList categories = {"Bestiary", "Items", "World", "Characters", "Locations"};
     if (index >= 0 && index < categories.size()) {
         m_currentCategory = categories[index];
+        m_searchEdit->clear();  // Browsing a category ends the search
         refreshEntryList(m_currentCategory);
     }
 }
 
 void LoreBookPage::refreshEntryList(const QString &category)
 {
+    PYRPG_PROFILE_SCOPE("LoreBookPage::refreshEntryList");
     m_entryList->clear();
     m_entryDetails->setHtml(QString(
         "<div style='text-align: center; color: %1; padding: 50px;'>"
@@ -255,7 +225,49 @@ void LoreBookPage::handleEntryClicked(QListWidgetItem *item)
 {
     if (!item) return;
 
-    LoreEntry *entry = static_cast<LoreEntry*>(item->data(Qt::UserRole).value<void*>());
+    QVariant resultIndex = item->data(Qt::UserRole + 1);
+    if (resultIndex.isValid()) {
+        int index = resultIndex.toInt();
+        if (index >= 0 && index < m_searchResults.size()) {
+            showSearchResult(m_searchResults[index]);
+        }
+        return;
+    }
+
+    showLoreEntry(static_cast<LoreEntry*>(item->data(Qt::UserRole).value<void*>()));
+}
+
+void LoreBookPage::showSearchResult(const SearchDocument &document)
+{
+    if (document.kind == SearchDocument::Lore && m_codexManager) {
+        showLoreEntry(m_codexManager->getEntry(document.key));
+        return;
+    }
+
+    QString html = QString(
+        "<div style='padding: %1px;'>"
+        "<h1 style='color: %2; border-bottom: 2px solid %3; padding-bottom: %4px;'>%5</h1>"
+        "<p style='font-style: italic; color: %6; margin-top: %7px;'>%8</p>"
+        "<div style='margin-top: %9px; line-height: 1.6;'>"
+        "%10"
+        "</div>"
+        "</div>"
+    ).arg(Theme::SPACING_MD)
+     .arg(Theme::PRIMARY.name())
+     .arg(Theme::ACCENT.name())
+     .arg(Theme::SPACING_SM)
+     .arg(document.title.toHtmlEscaped())
+     .arg(Theme::MUTED_FOREGROUND.name())
+     .arg(Theme::SPACING_MD)
+     .arg(searchKindLabel(document.kind))
+     .arg(Theme::SPACING_LG)
+     .arg(document.body.toHtmlEscaped().replace("\n", "<br/>"));
+
+    m_entryDetails->setHtml(html);
+}
+
+void LoreBookPage::showLoreEntry(LoreEntry *entry)
+{
     if (!entry) return;
 
     // Build HTML for entry details
@@ -276,7 +288,7 @@ void LoreBookPage::handleEntryClicked(QListWidgetItem *item)
      .arg(Theme::SPACING_MD)
      .arg(entry->shortDescription)
      .arg(Theme::SPACING_LG)
-     .arg(entry->fullText.replace("\n", "<br/>"));
+     .arg(QString(entry->fullText).replace("\n", "<br/>"));  // Copy: the entry is shared catalog data
 
     m_entryDetails->setHtml(html);
 }
@@ -8,17 +8,26 @@
 #include <QTextEdit>
 #include <QPushButton>
 #include <QKeyEvent>
+#include <QLineEdit>
+#include <functional>
 #include "../game/CodexManager.h"
+#include "../game/SearchIndex.h"
+#include "../diagnostics/AllocationTracker.h"
 
 class LoreBookPage : public QWidget
 {
     Q_OBJECT
 
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.pages")
     explicit LoreBookPage(QWidget *parent = nullptr);
 
+    using SearchFunction = std::function<QList<SearchDocument>(const QString &query)>;
+
     // Update lore display
     void updateLore(CodexManager *codexManager);
+    // Enables the search box; results replace the category list while a query is typed
+    void setSearchFunction(const SearchFunction &searchFunction);
 
 signals:
     void backRequested();
@@ -29,14 +38,20 @@ protected:
 private slots:
     void handleCategoryChanged(int index);
     void handleEntryClicked(QListWidgetItem *item);
+    void handleSearchTextChanged(const QString &text);
 
 private:
     void setupUi();
     void refreshEntryList(const QString &category);
+    void showLoreEntry(LoreEntry *entry);
+    void showSearchResult(const SearchDocument &document);
 
     CodexManager *m_codexManager;
     QLabel *m_titleLabel;
     QTabWidget *m_categoryTabs;
+    QLineEdit *m_searchEdit;
+    SearchFunction m_searchFunction;
+    QList<SearchDocument> m_searchResults;
     QListWidget *m_entryList;
     QTextEdit *m_entryDetails;
     QPushButton *m_backButton;
@@ -1,5 +1,5 @@
 #include "MainMenu.h"
-#include "../theme/Theme.h"
+#include "../theme/StyleSheet.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QLabel>
@@ -14,7 +14,8 @@ MainMenu::MainMenu(QWidget *parent) : QWidget(parent)
 
 void MainMenu::setupUi()
 {
-    setStyleSheet(QString("background-color: %1;").arg(Theme::BACKGROUND.name()));
+    // A plain QWidget subclass only paints a stylesheet background when asked to
+    setAttribute(Qt::WA_StyledBackground);
 
     QVBoxLayout *mainLayout = new QVBoxLayout(this);
     mainLayout->setContentsMargins(20, 20, 20, 20);
@@ -23,12 +24,7 @@ void MainMenu::setupUi()
 
     // Title
     QLabel *title = new QLabel("🌟 R E A L M   O F   L E G E N D S 🌟");
-    title->setStyleSheet(QString(
-        "font-size: 48px;"
-        "font-weight: bold;"
-        "color: %1;"
-        "font-family: 'Segoe UI', 'Inter', sans-serif;"
-    ).arg(Theme::PRIMARY.name()));
+    Theme::setRole(title, "splashTitle");
     title->setAlignment(Qt::AlignCenter);
 
     QGraphicsDropShadowEffect *shadow = new QGraphicsDropShadowEffect();
@@ -41,7 +37,7 @@ void MainMenu::setupUi()
 
     // Subtitle
     QLabel *subtitle = new QLabel("Choose Your Path");
-    subtitle->setStyleSheet("font-size: 18px; color: #9a96a5; margin-top: 10px;");
+    Theme::setRole(subtitle, "splashSubtitle");
     subtitle->setAlignment(Qt::AlignCenter);
     mainLayout->addWidget(subtitle);
 
@@ -52,55 +48,19 @@ void MainMenu::setupUi()
 
     m_newGameButton = new QPushButton("🆕 New Game");
     m_newGameButton->setMinimumHeight(50);
-    m_newGameButton->setStyleSheet(QString(
-        "QPushButton {"
-        "    background-color: %1;"
-        "    color: %2;"
-        "    border-radius: 8px;"
-        "    padding: 10px;"
-        "    font-size: 16px;"
-        "    font-weight: bold;"
-        "    min-width: 200px;"
-        "}"
-        "QPushButton:hover { background-color: %3; }"
-        "QPushButton:pressed { background-color: %4; }"
-    ).arg(Theme::PRIMARY.name()).arg(Theme::PRIMARY_FOREGROUND.name()).arg(Theme::PRIMARY.lighter(110).name()).arg(Theme::PRIMARY.darker(110).name()));
+    Theme::setRole(m_newGameButton, "menuPrimary");
     connect(m_newGameButton, &QPushButton::clicked, this, &MainMenu::newGameRequested);
     menuLayout->addWidget(m_newGameButton);
 
     m_loadGameButton = new QPushButton("📁 Load Game");
     m_loadGameButton->setMinimumHeight(50);
-    m_loadGameButton->setStyleSheet(QString(
-        "QPushButton {"
-        "    background-color: %1;"
-        "    color: %2;"
-        "    border-radius: 8px;"
-        "    padding: 10px;"
-        "    font-size: 16px;"
-        "    font-weight: bold;"
-        "    min-width: 200px;"
-        "}"
-        "QPushButton:hover { background-color: %3; }"
-        "QPushButton:pressed { background-color: %4; }"
-    ).arg(Theme::SECONDARY.name()).arg(Theme::FOREGROUND.name()).arg(Theme::SECONDARY.lighter(110).name()).arg(Theme::SECONDARY.darker(110).name()));
+    Theme::setRole(m_loadGameButton, "menuSecondary");
     connect(m_loadGameButton, &QPushButton::clicked, this, &MainMenu::loadGameRequested);
     menuLayout->addWidget(m_loadGameButton);
 
     m_exitButton = new QPushButton("🚪 Exit");
     m_exitButton->setMinimumHeight(50);
-    m_exitButton->setStyleSheet(QString(
-        "QPushButton {"
-        "    background-color: %1;"
-        "    color: %2;"
-        "    border-radius: 8px;"
-        "    padding: 10px;"
-        "    font-size: 16px;"
-        "    font-weight: bold;"
-        "    min-width: 200px;"
-        "}"
-        "QPushButton:hover { background-color: %3; }"
-        "QPushButton:pressed { background-color: %4; }"
-    ).arg(Theme::DESTRUCTIVE.name()).arg(Theme::DESTRUCTIVE_FOREGROUND.name()).arg(Theme::DESTRUCTIVE.lighter(110).name()).arg(Theme::DESTRUCTIVE.darker(110).name()));
+    Theme::setRole(m_exitButton, "menuDestructive");
     connect(m_exitButton, &QPushButton::clicked, this, &MainMenu::exitRequested);
     menuLayout->addWidget(m_exitButton);
 
@@ -108,7 +68,7 @@ void MainMenu::setupUi()
 
     // Footer
     QLabel *footer = new QLabel("Built with Qt6 • C++17");
-    footer->setStyleSheet("color: #6c757d; font-size: 12px; margin-top: 40px;");
+    Theme::setRole(footer, "splashFooter");
     footer->setAlignment(Qt::AlignCenter);
     mainLayout->addWidget(footer);
 }
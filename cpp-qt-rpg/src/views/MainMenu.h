@@ -2,6 +2,7 @@
 #define MAINMENU_H
 
 #include <QWidget>
+#include "../diagnostics/AllocationTracker.h"
 
 class QPushButton;
 
@@ -9,6 +10,7 @@ class MainMenu : public QWidget
 {
     Q_OBJECT
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.pages")
     explicit MainMenu(QWidget *parent = nullptr);
 
 signals:
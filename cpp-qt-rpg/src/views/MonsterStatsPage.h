@@ -2,6 +2,7 @@
 #define MONSTERSTATSPAGE_H
 
 #include <QWidget>
+#include "../diagnostics/AllocationTracker.h"
 
 class QLabel;
 class QVBoxLayout;
@@ -10,6 +11,7 @@ class MonsterStatsPage : public QWidget
 {
     Q_OBJECT
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.pages")
     explicit MonsterStatsPage(QWidget *parent = nullptr);
 
 signals:
@@ -1,6 +1,7 @@
 #include "NewGameView.h"
 #include "../components/ValidationLabel.h" // Assuming this will be created
-#include "../theme/Theme.h"
+#include "../components/SpriteCache.h"
+#include "../theme/StyleSheet.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QLabel>
@@ -26,12 +27,7 @@ void NewGameView::setupUi()
 
     // Title
     m_mainTitle = new QLabel("🌟 R E A L M   O F   L E G E N D S 🌟");
-    m_mainTitle->setStyleSheet(QString(
-        "font-size: 48px;"
-        "font-weight: bold;"
-        "color: %1;"
-        "font-family: 'Segoe UI', 'Inter', sans-serif;"
-    ).arg(Theme::PRIMARY.name()));
+    Theme::setRole(m_mainTitle, "splashTitle");
     m_mainTitle->setAlignment(Qt::AlignCenter);
 
     QGraphicsDropShadowEffect *shadow = new QGraphicsDropShadowEffect();
@@ -44,7 +40,7 @@ void NewGameView::setupUi()
 
     // Subtitle
     m_subtitle = new QLabel("Forge Your Destiny");
-    m_subtitle->setStyleSheet("font-size: 18px; color: #9a96a5; margin-top: 10px;");
+    Theme::setRole(m_subtitle, "splashSubtitle");
     m_subtitle->setAlignment(Qt::AlignCenter);
     mainLayout->addWidget(m_subtitle);
 
@@ -52,7 +48,7 @@ void NewGameView::setupUi()
     m_createCard = new QFrame();
     m_createCard->setMinimumWidth(600);
     m_createCard->setMaximumWidth(800);
-    m_createCard->setStyleSheet(QString("background-color: %1; border-radius: 12px;").arg(Theme::CARD.name()));
+    Theme::setRole(m_createCard, "newGameCard");
     
     QHBoxLayout *createLayout = new QHBoxLayout(m_createCard);
     createLayout->setSpacing(30);
@@ -60,11 +56,11 @@ void NewGameView::setupUi()
     // Character Preview
     m_charPreview = new QFrame();
     m_charPreview->setFixedSize(200, 200);
-    m_charPreview->setStyleSheet(QString("background-color: %1; border: 2px solid %2; border-radius: 12px;").arg(Theme::CARD.name()).arg(Theme::BORDER.name()));
+    Theme::setRole(m_charPreview, "newGamePreview");
     QVBoxLayout* previewLayout = new QVBoxLayout(m_charPreview);
 
     QLabel* previewLabel = new QLabel("Character Preview");
-    previewLabel->setStyleSheet("font-size: 12px; color: #dc3545; font-weight: bold;");
+    Theme::setRole(previewLabel, "newGamePreviewTitle");
     previewLabel->setAlignment(Qt::AlignCenter);
     previewLayout->addWidget(previewLabel);
 
@@ -81,49 +77,26 @@ void NewGameView::setupUi()
 
     // Name Input
     QLabel *nameTitle = new QLabel("Choose Your Name");
-    nameTitle->setStyleSheet("font-size: 16px; font-weight: bold; color: #f1f0f2;");
+    Theme::setRole(nameTitle, "newGameFieldTitle");
     detailsLayout->addWidget(nameTitle);
 
     m_nameInput = new QLineEdit();
     m_nameInput->setPlaceholderText("Enter your hero's name...");
-    m_nameInput->setStyleSheet(QString(
-        "QLineEdit {"
-        "    font-size: 14px;"
-        "    padding: 12px;"
-        "    border: 2px solid %1;"
-        "    border-radius: 8px;"
-        "    background-color: %2;"
-        "    color: %3;"
-        "    font-weight: 500;"
-        "}"
-        "QLineEdit:focus {"
-        "    border-color: %4;"
-        "    background-color: %5;"
-        "}"
-    ).arg(Theme::BORDER.name()).arg(Theme::CARD.name()).arg(Theme::FOREGROUND.name()).arg(Theme::PRIMARY.name()).arg(Theme::MUTED.name()));
+    Theme::setRole(m_nameInput, "newGameInput");
     m_nameInput->setMaxLength(20);
     connect(m_nameInput, &QLineEdit::textChanged, this, &NewGameView::validateNameInput);
     detailsLayout->addWidget(m_nameInput);
 
     // Class Selection
     QLabel *classTitle = new QLabel("Choose Your Class");
-    classTitle->setStyleSheet("font-size: 16px; font-weight: bold; color: #f1f0f2;");
+    Theme::setRole(classTitle, "newGameFieldTitle");
     detailsLayout->addWidget(classTitle);
 
     m_classSelector = new QComboBox();
     m_classSelector->addItem("⚔️ Warrior - High strength and vitality");
     m_classSelector->addItem("🔮 Mage - Powerful magic and mana");
     m_classSelector->addItem("🗡️ Rogue - High dexterity and speed");
-    m_classSelector->setStyleSheet(QString(
-        "QComboBox {"
-        "    font-size: 14px;"
-        "    padding: 12px;"
-        "    border: 2px solid %1;"
-        "    border-radius: 8px;"
-        "    background-color: %2;"
-        "    color: %3;"
-        "}"
-    ).arg(Theme::BORDER.name()).arg(Theme::CARD.name()).arg(Theme::FOREGROUND.name()));
+    Theme::setRole(m_classSelector, "newGameInput");
     connect(m_classSelector, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &NewGameView::updateStatsPreview);
     connect(m_classSelector, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &NewGameView::updateCharacterPreview);
     detailsLayout->addWidget(m_classSelector);
@@ -134,7 +107,7 @@ void NewGameView::setupUi()
 
     // Stats Preview
     QLabel *statsTitle = new QLabel("Starting Stats");
-    statsTitle->setStyleSheet("font-size: 16px; font-weight: bold; color: #f1f0f2;");
+    Theme::setRole(statsTitle, "newGameFieldTitle");
     detailsLayout->addWidget(statsTitle);
 
     m_statsInfo = new QLabel();
@@ -144,18 +117,7 @@ void NewGameView::setupUi()
     // Start Button
     m_startButton = new QPushButton("✨ Begin Your Quest");
     m_startButton->setMinimumHeight(50);
-    m_startButton->setStyleSheet(QString(
-        "QPushButton {"
-        "    background-color: %1;"
-        "    color: %2;"
-        "    border-radius: 8px;"
-        "    padding: 10px;"
-        "    font-size: 16px;"
-        "    font-weight: bold;"
-        "}"
-        "QPushButton:hover { background-color: %3; }"
-        "QPushButton:pressed { background-color: %4; }"
-    ).arg(Theme::PRIMARY.name()).arg(Theme::PRIMARY_FOREGROUND.name()).arg(Theme::PRIMARY.lighter(110).name()).arg(Theme::PRIMARY.darker(110).name()));
+    Theme::setRole(m_startButton, "menuPrimary");
     connect(m_startButton, &QPushButton::clicked, this, &NewGameView::startGame);
     detailsLayout->addWidget(m_startButton);
 
@@ -164,7 +126,7 @@ void NewGameView::setupUi()
 
     // Footer
     m_footerLabel = new QLabel("Press Enter to create your character instantly");
-    m_footerLabel->setStyleSheet("color: #6c757d; font-size: 12px; margin-top: 20px;");
+    Theme::setRole(m_footerLabel, "splashFooter");
     m_footerLabel->setAlignment(Qt::AlignCenter);
     mainLayout->addWidget(m_footerLabel);
 
@@ -277,10 +239,10 @@ void NewGameView::updateCharacterPreview()
         spritePath = ":/assets/warrior.png";
     }
 
-    // Load and display the sprite
-    QPixmap sprite(spritePath);
+    // Display the shared, pre-scaled sprite
+    QPixmap sprite = SpriteCache::instance().pixmap(spritePath, QSize(PREVIEW_SPRITE_SIZE, PREVIEW_SPRITE_SIZE), devicePixelRatioF());
     if (!sprite.isNull()) {
-        m_characterSpriteLabel->setPixmap(sprite.scaled(140, 140, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+        m_characterSpriteLabel->setPixmap(sprite);
     } else {
         m_characterSpriteLabel->setText("👤"); // Fallback emoji
     }
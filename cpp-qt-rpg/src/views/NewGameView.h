@@ -2,6 +2,7 @@
 #define NEWGAMEVIEW_H
 
 #include <QWidget>
+#include "../diagnostics/AllocationTracker.h"
 
 class QLabel;
 class QLineEdit;
@@ -16,6 +17,8 @@ class NewGameView : public QWidget
 {
     Q_OBJECT
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.pages")
+    static const int PREVIEW_SPRITE_SIZE = 140;
     explicit NewGameView(QWidget *parent = nullptr);
 
 signals:
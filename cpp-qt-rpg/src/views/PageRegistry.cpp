@@ -0,0 +1,120 @@
+#include "PageRegistry.h"
+#include "../diagnostics/Profiler.h"
+#include <QStackedWidget>
+#include <QTimer>
+#include <QDebug>
+#include <QtGlobal>
+
+PageRegistry::PageRegistry(QStackedWidget *stack, QObject *parent)
+    : QObject(parent)
+    , m_stack(stack)
+    , m_evictionTimer(new QTimer(this))
+    , m_idleTimeout(0)
+    , m_current(stack->currentWidget())
+{
+    m_clock.start();
+    connect(m_stack, &QStackedWidget::currentChanged, this, &PageRegistry::handleCurrentChanged);
+    connect(m_evictionTimer, &QTimer::timeout, this, [this]() {
+        evictIdlePages(m_idleTimeout);
+    });
+}
+
+void PageRegistry::registerPage(int id, const Factory &factory, bool evictable)
+{
+    Entry &entry = m_entries[id];
+    entry.factory = factory;
+    entry.evictable = evictable;
+}
+
+QWidget *PageRegistry::page(int id)
+{
+    auto it = m_entries.find(id);
+    if (it == m_entries.end()) {
+        qWarning() << "PageRegistry: no page registered with id" << id;
+        return nullptr;
+    }
+    if (it->widget) {
+        return it->widget;
+    }
+
+    PYRPG_PROFILE_SCOPE("PageRegistry::page");
+    QWidget *widget = it->factory();
+    if (!widget) {
+        qWarning() << "PageRegistry: factory for page" << id << "returned null";
+        return nullptr;
+    }
+    PYRPG_TRACE_INSTANT(widget->metaObject()->className(), "page.create");
+    it->widget = widget;
+    it->lastShown = m_clock.elapsed();
+    m_stack->addWidget(widget);
+    emit pageCreated(id);
+    return widget;
+}
+
+QWidget *PageRegistry::existingPage(int id) const
+{
+    auto it = m_entries.constFind(id);
+    return it == m_entries.constEnd() ? nullptr : it->widget.data();
+}
+
+bool PageRegistry::isCurrent(int id) const
+{
+    QWidget *widget = existingPage(id);
+    return widget && m_stack->currentWidget() == widget;
+}
+
+QWidget *PageRegistry::show(int id)
+{
+    QWidget *widget = page(id);
+    if (widget) {
+        m_stack->setCurrentWidget(widget);
+    }
+    return widget;
+}
+
+void PageRegistry::setIdleTimeout(int msecs)
+{
+    m_idleTimeout = qMax(0, msecs);
+    if (m_idleTimeout == 0) {
+        m_evictionTimer->stop();
+        return;
+    }
+    // A page is evicted at most a quarter of the timeout late
+    m_evictionTimer->start(qMax(1000, m_idleTimeout / 4));
+}
+
+int PageRegistry::evictIdlePages(qint64 idleMsecs)
+{
+    qint64 now = m_clock.elapsed();
+    int evicted = 0;
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        Entry &entry = it.value();
+        if (!entry.evictable || !entry.widget || entry.widget == m_stack->currentWidget()) {
+            continue;
+        }
+        if (now - entry.lastShown < idleMsecs) {
+            continue;
+        }
+
+        PYRPG_TRACE_INSTANT(entry.widget->metaObject()->className(), "page.evict");
+        QWidget *widget = entry.widget;
+        entry.widget = nullptr;
+        m_stack->removeWidget(widget);
+        widget->deleteLater();
+        ++evicted;
+        emit pageEvicted(it.key());
+    }
+    return evicted;
+}
+
+void PageRegistry::handleCurrentChanged(int index)
+{
+    qint64 now = m_clock.elapsed();
+    // Idle time counts from when a page stops being shown
+    for (Entry &entry : m_entries) {
+        if (entry.widget && (entry.widget == m_current || entry.widget == m_stack->widget(index))) {
+            entry.lastShown = now;
+        }
+    }
+    m_current = m_stack->widget(index);
+}
@@ -0,0 +1,76 @@
+#ifndef PAGEREGISTRY_H
+#define PAGEREGISTRY_H
+
+#include <QObject>
+#include <QHash>
+#include <QPointer>
+#include <QWidget>
+#include <QElapsedTimer>
+#include <functional>
+
+class QStackedWidget;
+class QTimer;
+
+// Pages of a QStackedWidget that are built on first use.
+//
+// Each page is registered with a factory that constructs it and wires its
+// signals; the registry adds the result to the stack the first time the page
+// is asked for. Pages registered as evictable are removed and deleted again
+// once they have not been shown for the idle period, and rebuilt by their
+// factory on the next visit, so they must not hold state that outlives a visit.
+class PageRegistry : public QObject
+{
+    Q_OBJECT
+
+public:
+    using Factory = std::function<QWidget *()>;
+
+    explicit PageRegistry(QStackedWidget *stack, QObject *parent = nullptr);
+
+    void registerPage(int id, const Factory &factory, bool evictable = false);
+
+    // Builds the page on first call
+    QWidget *page(int id);
+    template <typename T>
+    T *page(int id) { return static_cast<T *>(page(id)); }
+
+    // Null until the page has been built (or after it was evicted)
+    QWidget *existingPage(int id) const;
+    template <typename T>
+    T *existingPage(int id) const { return static_cast<T *>(existingPage(id)); }
+
+    bool isBuilt(int id) const { return existingPage(id) != nullptr; }
+    bool isCurrent(int id) const;
+    // Builds the page if needed and makes it the stack's current widget
+    QWidget *show(int id);
+
+    // Checks for idle pages every so often; 0 turns eviction off
+    void setIdleTimeout(int msecs);
+    int idleTimeout() const { return m_idleTimeout; }
+    // Deletes evictable pages that are not current and were last shown more
+    // than idleMsecs ago; returns how many were evicted
+    int evictIdlePages(qint64 idleMsecs);
+
+signals:
+    void pageCreated(int id);
+    void pageEvicted(int id);
+
+private:
+    struct Entry {
+        Factory factory;
+        bool evictable = false;
+        QPointer<QWidget> widget;
+        qint64 lastShown = 0;
+    };
+
+    void handleCurrentChanged(int index);
+
+    QStackedWidget *m_stack;
+    QHash<int, Entry> m_entries;
+    QElapsedTimer m_clock;
+    QTimer *m_evictionTimer;
+    int m_idleTimeout;
+    QPointer<QWidget> m_current;
+};
+
+#endif // PAGEREGISTRY_H
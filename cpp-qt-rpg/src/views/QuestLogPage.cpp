@@ -1,11 +1,21 @@
 #include "QuestLogPage.h"
+#include "../diagnostics/Profiler.h"
 #include "../theme/Theme.h"
+#include "../theme/StyleSheet.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QKeyEvent>
 
 QuestLogPage::QuestLogPage(QWidget *parent)
-    : QWidget(parent), m_questManager(nullptr), m_currentPlayer(nullptr), m_selectedQuest(nullptr)
+    : QWidget(parent), m_questManager(nullptr), m_currentPlayer(nullptr), m_selectedQuest(nullptr),
+      m_questModel(new QuestListModel(this))
+{
+    setupUi();
+}
+
+QuestLogPage::QuestLogPage(QuestListModel *questModel, QWidget *parent)
+    : QWidget(parent), m_questManager(nullptr), m_currentPlayer(nullptr), m_selectedQuest(nullptr),
+      m_questModel(questModel)
 {
     setupUi();
 }
@@ -23,47 +33,19 @@ void QuestLogPage::setupUi()
 
     // Title
     m_titleLabel = new QLabel("Quest Log");
-    m_titleLabel->setStyleSheet(QString(
-        "font-size: %1px; font-weight: %2; color: %3;"
-    ).arg(Theme::FONT_SIZE_XL)
-     .arg(Theme::FONT_WEIGHT_BOLD)
-     .arg(Theme::PRIMARY.name()));
+    Theme::setRole(m_titleLabel, "questLogTitle");
     listLayout->addWidget(m_titleLabel);
 
-    // Quest list widget
-    m_questList = new QListWidget();
-    m_questList->setStyleSheet(QString(
-        "QListWidget {"
-        "    background-color: %1;"
-        "    border: 2px solid %2;"
-        "    border-radius: %3px;"
-        "    color: %4;"
-        "    padding: %5px;"
-        "    font-size: %6px;"
-        "}"
-        "QListWidget::item {"
-        "    padding: 8px;"
-        "    border-radius: 4px;"
-        "    margin: 2px 0px;"
-        "}"
-        "QListWidget::item:selected {"
-        "    background-color: %7;"
-        "    color: %8;"
-        "}"
-        "QListWidget::item:hover {"
-        "    background-color: %9;"
-        "}"
-    ).arg(Theme::CARD.name())
-     .arg(Theme::BORDER.name())
-     .arg(Theme::BORDER_RADIUS_MD)
-     .arg(Theme::FOREGROUND.name())
-     .arg(Theme::SPACING_SM)
-     .arg(Theme::FONT_SIZE_MD)
-     .arg(Theme::PRIMARY.name())
-     .arg(Theme::PRIMARY_FOREGROUND.name())
-     .arg(Theme::MUTED.name()));
-
-    connect(m_questList, &QListWidget::itemClicked, this, &QuestLogPage::handleQuestClicked);
+    // Quest list view over the live quest model
+    m_questList = new QListView();
+    m_questList->setModel(m_questModel);
+    m_questList->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_questList->setUniformItemSizes(true);
+    Theme::setRole(m_questList, "questLogList");
+
+    connect(m_questList, &QListView::clicked, this, &QuestLogPage::handleQuestClicked);
+    // The manager going away (new game, load) resets the model; drop stale details
+    connect(m_questModel, &QAbstractItemModel::modelReset, this, &QuestLogPage::clearDetails);
     listLayout->addWidget(m_questList, 1);
 
     // Buttons layout
@@ -72,30 +54,7 @@ void QuestLogPage::setupUi()
     // Accept button (hidden by default)
     m_acceptButton = new QPushButton("Accept Quest (A)");
     m_acceptButton->setMinimumHeight(40);
-    m_acceptButton->setStyleSheet(QString(
-        "QPushButton {"
-        "    background-color: %1;"
-        "    color: %2;"
-        "    border: none;"
-        "    border-radius: %3px;"
-        "    padding: %4px;"
-        "    font-size: %5px;"
-        "    font-weight: %6;"
-        "}"
-        "QPushButton:hover {"
-        "    background-color: %7;"
-        "}"
-        "QPushButton:pressed {"
-        "    background-color: %8;"
-        "}"
-    ).arg(Theme::PRIMARY.name())
-     .arg(Theme::PRIMARY_FOREGROUND.name())
-     .arg(Theme::BORDER_RADIUS_SM)
-     .arg(Theme::SPACING_MD)
-     .arg(Theme::FONT_SIZE_MD)
-     .arg(Theme::FONT_WEIGHT_MEDIUM)
-     .arg(Theme::ACCENT.name())
-     .arg(Theme::DESTRUCTIVE.name()));
+    Theme::setRole(m_acceptButton, "questLogAccept");
     m_acceptButton->setVisible(false);
     connect(m_acceptButton, &QPushButton::clicked, this, &QuestLogPage::handleAcceptQuest);
     buttonsLayout->addWidget(m_acceptButton);
@@ -103,27 +62,7 @@ void QuestLogPage::setupUi()
     // Back button
     m_backButton = new QPushButton("Back (Esc)");
     m_backButton->setMinimumHeight(40);
-    m_backButton->setStyleSheet(QString(
-        "QPushButton {"
-        "    background-color: %1;"
-        "    color: %2;"
-        "    border: 2px solid %3;"
-        "    border-radius: %4px;"
-        "    padding: %5px;"
-        "    font-size: %6px;"
-        "    font-weight: %7;"
-        "}"
-        "QPushButton:hover {"
-        "    background-color: %8;"
-        "}"
-    ).arg(Theme::SECONDARY.name())
-     .arg(Theme::SECONDARY_FOREGROUND.name())
-     .arg(Theme::BORDER.name())
-     .arg(Theme::BORDER_RADIUS_SM)
-     .arg(Theme::SPACING_MD)
-     .arg(Theme::FONT_SIZE_MD)
-     .arg(Theme::FONT_WEIGHT_MEDIUM)
-     .arg(Theme::MUTED.name()));
+    Theme::setRole(m_backButton, "questLogBack");
     connect(m_backButton, &QPushButton::clicked, this, &QuestLogPage::handleBackClicked);
     buttonsLayout->addWidget(m_backButton);
 
@@ -133,21 +72,7 @@ void QuestLogPage::setupUi()
     // RIGHT SIDE: Quest details
     m_questDetails = new QTextEdit();
     m_questDetails->setReadOnly(true);
-    m_questDetails->setStyleSheet(QString(
-        "QTextEdit {"
-        "    background-color: %1;"
-        "    border: 2px solid %2;"
-        "    border-radius: %3px;"
-        "    padding: %4px;"
-        "    color: %5;"
-        "    font-size: %6px;"
-        "}"
-    ).arg(Theme::CARD.name())
-     .arg(Theme::BORDER.name())
-     .arg(Theme::BORDER_RADIUS_MD)
-     .arg(Theme::SPACING_MD)
-     .arg(Theme::FOREGROUND.name())
-     .arg(Theme::FONT_SIZE_MD));
+    Theme::setRole(m_questDetails, "questLogDetails");
     m_questDetails->setHtml("<p style='color: " + Theme::MUTED_FOREGROUND.name() + ";'>Select a quest to view details.</p>");
 
     mainLayout->addWidget(m_questDetails, 2);  // Stretch factor 2
@@ -155,97 +80,21 @@ void QuestLogPage::setupUi()
 
 void QuestLogPage::updateQuests(QuestManager* questManager, Player* player)
 {
+    PYRPG_PROFILE_SCOPE("QuestLogPage::updateQuests");
     m_questManager = questManager;
     m_currentPlayer = player;
-    m_selectedQuest = nullptr;
-
-    clearQuests();
 
-    if (!m_questManager || !m_currentPlayer) {
-        return;
-    }
-
-    // Add ACTIVE quests section
-    QList<Quest*> activeQuests = m_questManager->getActiveQuests();
-    if (!activeQuests.isEmpty()) {
-        QListWidgetItem *header = new QListWidgetItem("=== ACTIVE QUESTS ===");
-        header->setForeground(QBrush(Theme::ACCENT));
-        header->setFlags(Qt::ItemIsEnabled);  // Not selectable
-        m_questList->addItem(header);
-
-        for (Quest* quest : activeQuests) {
-            if (quest) {
-                QString itemText = QString("%1  %2").arg(quest->title).arg(getStatusBadge(quest));
-                QListWidgetItem *item = new QListWidgetItem(itemText);
-                item->setData(Qt::UserRole, QVariant::fromValue(static_cast<void*>(quest)));
-                m_questList->addItem(item);
-            }
-        }
-    }
-
-    // Add AVAILABLE quests section
-    QList<Quest*> availableQuests = m_questManager->getAvailableQuests();
-    if (!availableQuests.isEmpty()) {
-        QListWidgetItem *header = new QListWidgetItem("=== AVAILABLE QUESTS ===");
-        header->setForeground(QBrush(Theme::PRIMARY));
-        header->setFlags(Qt::ItemIsEnabled);
-        m_questList->addItem(header);
-
-        for (Quest* quest : availableQuests) {
-            if (quest) {
-                QString itemText = QString("%1  %2").arg(quest->title).arg(getStatusBadge(quest));
-                QListWidgetItem *item = new QListWidgetItem(itemText);
-                item->setData(Qt::UserRole, QVariant::fromValue(static_cast<void*>(quest)));
-                m_questList->addItem(item);
-            }
-        }
-    }
-
-    // Add COMPLETED quests section
-    QList<Quest*> completedQuests = m_questManager->getCompletedQuests();
-    if (!completedQuests.isEmpty()) {
-        QListWidgetItem *header = new QListWidgetItem("=== COMPLETED QUESTS ===");
-        header->setForeground(QBrush(Theme::MUTED_FOREGROUND));
-        header->setFlags(Qt::ItemIsEnabled);
-        m_questList->addItem(header);
-
-        for (Quest* quest : completedQuests) {
-            if (quest) {
-                QString itemText = QString("%1  %2").arg(quest->title).arg(getStatusBadge(quest));
-                QListWidgetItem *item = new QListWidgetItem(itemText);
-                item->setData(Qt::UserRole, QVariant::fromValue(static_cast<void*>(quest)));
-                item->setForeground(QBrush(Theme::MUTED_FOREGROUND));
-                m_questList->addItem(item);
-            }
-        }
-    }
-
-    // Add LOCKED quests section (optional - shows future quests)
-    QList<Quest*> lockedQuests = m_questManager->getLockedQuests();
-    if (!lockedQuests.isEmpty()) {
-        QListWidgetItem *header = new QListWidgetItem("=== LOCKED QUESTS ===");
-        header->setForeground(QBrush(Theme::MUTED_FOREGROUND));
-        header->setFlags(Qt::ItemIsEnabled);
-        m_questList->addItem(header);
-
-        for (Quest* quest : lockedQuests) {
-            if (quest) {
-                QString itemText = QString("??? %1").arg(quest->title);
-                QListWidgetItem *item = new QListWidgetItem(itemText);
-                item->setData(Qt::UserRole, QVariant::fromValue(static_cast<void*>(quest)));
-                item->setForeground(QBrush(Theme::MUTED_FOREGROUND));
-                m_questList->addItem(item);
-            }
-        }
+    if (m_questModel->questManager() != questManager) {
+        m_questModel->setQuestManager(questManager, player);
     }
 }
 
-void QuestLogPage::handleQuestClicked(QListWidgetItem *item)
+void QuestLogPage::handleQuestClicked(const QModelIndex &index)
 {
-    if (!item) return;
+    if (!index.isValid()) return;
 
-    // Get quest from item data
-    Quest *quest = static_cast<Quest*>(item->data(Qt::UserRole).value<void*>());
+    // Header rows carry no quest
+    Quest *quest = m_questModel->questAt(index.row());
     if (!quest) return;
 
     m_selectedQuest = quest;
@@ -313,8 +162,8 @@ void QuestLogPage::handleAcceptQuest()
 
     if (m_selectedQuest->isAvailable()) {
         emit questAccepted(m_selectedQuest->questId);
-        // Refresh the quest list
-        updateQuests(m_questManager, m_currentPlayer);
+        // The model moves the row itself; the details still describe the old status
+        clearDetails();
     }
 }
 
@@ -323,29 +172,14 @@ void QuestLogPage::handleBackClicked()
     emit backRequested();
 }
 
-void QuestLogPage::clearQuests()
+void QuestLogPage::clearDetails()
 {
-    m_questList->clear();
+    m_questList->clearSelection();
     m_questDetails->setHtml("<p style='color: " + Theme::MUTED_FOREGROUND.name() + ";'>Select a quest to view details.</p>");
     m_acceptButton->setVisible(false);
     m_selectedQuest = nullptr;
 }
 
-QString QuestLogPage::getStatusBadge(const Quest* quest) const
-{
-    if (!quest) return "";
-
-    if (quest->isActive()) {
-        return QString("[%1/%2]").arg(quest->getProgress()).arg(quest->getTotalObjectives());
-    } else if (quest->isComplete()) {
-        return "[✓]";
-    } else if (quest->isAvailable()) {
-        return "[!]";
-    } else {
-        return "[🔒]";
-    }
-}
-
 QString QuestLogPage::getObjectiveText(const QuestObjective &obj) const
 {
     QString text = obj.description;
@@ -378,13 +212,11 @@ void QuestLogPage::keyPressEvent(QKeyEvent *event)
         case Qt::Key_7:
         case Qt::Key_8:
         case Qt::Key_9: {
-            int index = event->key() - Qt::Key_1;  // 0-8
-            if (index < m_questList->count()) {
-                QListWidgetItem *item = m_questList->item(index);
-                if (item && item->flags() & Qt::ItemIsSelectable) {
-                    m_questList->setCurrentItem(item);
-                    handleQuestClicked(item);
-                }
+            int row = event->key() - Qt::Key_1;  // 0-8
+            QModelIndex index = m_questModel->index(row);
+            if (index.isValid() && (m_questModel->flags(index) & Qt::ItemIsSelectable)) {
+                m_questList->setCurrentIndex(index);
+                handleQuestClicked(index);
             }
             break;
         }
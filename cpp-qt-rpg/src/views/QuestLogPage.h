@@ -3,20 +3,30 @@
 
 #include <QWidget>
 #include <QLabel>
-#include <QListWidget>
+#include <QListView>
 #include <QTextEdit>
 #include <QPushButton>
 #include "../models/Quest.h"
 #include "../game/QuestManager.h"
 #include "../models/Player.h"
+#include "../components/QuestListModel.h"
+#include "../diagnostics/AllocationTracker.h"
 
 class QuestLogPage : public QWidget
 {
     Q_OBJECT
 
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.pages")
     explicit QuestLogPage(QWidget *parent = nullptr);
+    // Shows a model owned elsewhere, so the page can be destroyed and rebuilt
+    // while other views keep using the model
+    explicit QuestLogPage(QuestListModel *questModel, QWidget *parent = nullptr);
+    // Attaches the quest model to a manager; the list then follows the manager's
+    // signals, so calling this again with the same manager is cheap
     void updateQuests(QuestManager* questManager, Player* player);
+    // Live model shared with other quest views (e.g. the combat page tracker)
+    QuestListModel* questModel() const { return m_questModel; }
 
 signals:
     void backRequested();
@@ -26,14 +36,13 @@ protected:
     void keyPressEvent(QKeyEvent *event) override;
 
 private slots:
-    void handleQuestClicked(QListWidgetItem *item);
+    void handleQuestClicked(const QModelIndex &index);
     void handleAcceptQuest();
     void handleBackClicked();
 
 private:
     void setupUi();
-    void clearQuests();
-    QString getStatusBadge(const Quest* quest) const;
+    void clearDetails();
     QString getObjectiveText(const QuestObjective &obj) const;
 
     QuestManager* m_questManager;
@@ -41,7 +50,8 @@ private:
     Quest* m_selectedQuest;
 
     QLabel* m_titleLabel;
-    QListWidget* m_questList;
+    QuestListModel* m_questModel;
+    QListView* m_questList;
     QTextEdit* m_questDetails;
     QPushButton* m_backButton;
     QPushButton* m_acceptButton;
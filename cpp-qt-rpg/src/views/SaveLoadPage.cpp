@@ -1,4 +1,5 @@
 #include <QString>
+#include "../diagnostics/Profiler.h"
 #include <QDateTime>
 #include "../persistence/SaveManager.h"
 #include "SaveLoadPage.h"
@@ -73,6 +74,7 @@ void SaveLoadPage::setupUi()
 
 void SaveLoadPage::refreshSaveSlots()
 {
+    PYRPG_PROFILE_SCOPE("SaveLoadPage::refreshSaveSlots");
     // Prevent multiple simultaneous refreshes
     if (m_isRefreshing) {
         return;
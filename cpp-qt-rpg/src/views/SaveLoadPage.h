@@ -2,6 +2,7 @@
 #define SAVELOADPAGE_H
 
 #include <QWidget>
+#include "../diagnostics/AllocationTracker.h"
 
 class QListWidget;
 class QKeyEvent;
@@ -11,6 +12,7 @@ class SaveLoadPage : public QWidget
 {
     Q_OBJECT
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.pages")
     explicit SaveLoadPage(QWidget *parent = nullptr);
     void refreshSaveSlots();
 
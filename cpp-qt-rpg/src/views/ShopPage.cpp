@@ -1,9 +1,13 @@
 #include "ShopPage.h"
+#include "../diagnostics/Profiler.h"
 #include "../models/Player.h"
 #include "../models/Item.h"
 #include "../game/factories/ItemFactory.h"
+#include "../game/ContentDatabase.h"
 #include "../theme/Theme.h"
+#include "../theme/StyleSheet.h"
 #include "../components/ItemSelectionOverlay.h"
+#include "../components/DialogQueue.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QLabel>
@@ -28,9 +32,9 @@ void ShopPage::setupUi()
 
     QHBoxLayout *headerLayout = new QHBoxLayout();
     QLabel *title = new QLabel("Merchant Shop");
-    title->setStyleSheet("font-size: 18px; font-weight: bold;");
+    Theme::setRole(title, "pageTitle");
     m_goldLabel = new QLabel("Gold: 0");
-    m_goldLabel->setStyleSheet("font-size: 16px; font-weight: bold; color: #e5c07b;");
+    Theme::setRole(m_goldLabel, "gold");
     headerLayout->addWidget(title);
     headerLayout->addStretch();
     headerLayout->addWidget(m_goldLabel);
@@ -38,9 +42,8 @@ void ShopPage::setupUi()
 
     QScrollArea *scrollArea = new QScrollArea();
     scrollArea->setWidgetResizable(true);
-    scrollArea->setStyleSheet(QString("QScrollArea { border: none; background-color: %1; }").arg(Theme::BACKGROUND.name()));
+    Theme::setRole(scrollArea, "pageScroll");
     QWidget *scrollContent = new QWidget();
-    scrollContent->setStyleSheet(QString("background-color: %1;").arg(Theme::BACKGROUND.name()));
     m_shopGridLayout = new QGridLayout(scrollContent);
     m_shopGridLayout->setSpacing(Theme::SPACING_MD);
     scrollArea->setWidget(scrollContent);
@@ -61,42 +64,92 @@ void ShopPage::setupUi()
 
 void ShopPage::updateShop(Player *player)
 {
+    PYRPG_PROFILE_SCOPE("ShopPage::updateShop");
 m_currentPlayer = player;
-m_shopItems.clear();
-    m_itemCards.clear();
 m_selectedIndex = 0;
-    clearShop();
 
     if (!player) return;
 
-m_goldLabel->setText(QString("Gold: %1").arg(player->gold));
+    reconcileCatalog();
+    refreshPlayerState();
+    updateSelectionDisplay();
+}
 
-// Get shop items from ItemFactory
-QMap<QString, Item*> shopItemsMap = ItemFactory::getShopItems();
+void ShopPage::reconcileCatalog()
+{
+    // Get shop items from ItemFactory; the catalog only changes on a content
+    // reload, so after the first visit this finds every card already in place
+    const QMap<QString, Item*> shopItemsMap = ItemFactory::getShopItems();
+    const int contentRevision = ContentDatabase::instance().revision();
+
+    QStringList order;
+    bool layoutChanged = false;
+    for (auto it = shopItemsMap.cbegin(); it != shopItemsMap.cend(); ++it) {
+        Item *item = it.value();
+        if (!item) continue;
+
+        const QString &id = it.key();
+        // Calculate price (base value * 1.5 for shop markup)
+        int price = static_cast<int>(item->value * 1.5);
+
+        auto existing = m_cards.find(id);
+        if (existing != m_cards.end() && existing->item == item && existing->price == price
+            && existing->contentRevision == contentRevision) {
+            order.append(id);
+            continue;
+        }
+        if (existing != m_cards.end()) {
+            delete existing->widget;
+            m_cards.erase(existing);
+        }
 
-    // Populate shop grid
-int row = 0, col = 0;
-const int columns = 4;
+        ShopCard card;
+        card.item = item;
+        card.price = price;
+        card.contentRevision = contentRevision;
+        card.widget = createShopItemCard(item, price, &card.buyButton);
+        m_cards.insert(id, card);
+        order.append(id);
+        layoutChanged = true;
+    }
 
-for (Item *item : shopItemsMap.values()) {
-if (!item) continue;
+    // Drop cards for items that left the catalog
+    for (auto it = m_cards.begin(); it != m_cards.end();) {
+        if (!order.contains(it.key())) {
+            delete it->widget;
+            it = m_cards.erase(it);
+            layoutChanged = true;
+        } else {
+            ++it;
+        }
+    }
+
+    if (!layoutChanged && order == m_cardOrder) return;
+
+    // Re-seat the cards in the grid; widgets are reused, only positions change
+    while (m_shopGridLayout->count() > 0) {
+        delete m_shopGridLayout->takeAt(0);
+    }
+    const int columns = 4;
+    for (int i = 0; i < order.size(); ++i) {
+        m_shopGridLayout->addWidget(m_cards.value(order[i]).widget, i / columns, i % columns);
+    }
+    m_cardOrder = order;
+}
 
-// Calculate price (base value * 1.5 for shop markup)
-int price = static_cast<int>(item->value * 1.5);
+void ShopPage::refreshPlayerState()
+{
+    if (!m_currentPlayer) return;
 
-m_shopItems.append(qMakePair(item, price));
-QWidget *itemCard = createShopItemCard(item, price);
-m_itemCards.append(itemCard);
-m_shopGridLayout->addWidget(itemCard, row, col);
+    m_goldLabel->setText(QString("Gold: %1").arg(m_currentPlayer->gold));
 
-    col++;
-        if (col >= columns) {
-            col = 0;
-            row++;
+    // Disable buttons the player can't afford
+    for (const ShopCard &card : std::as_const(m_cards)) {
+        bool affordable = m_currentPlayer->gold >= card.price;
+        if (card.buyButton->isEnabled() != affordable) {
+            card.buyButton->setEnabled(affordable);
         }
     }
-
-    updateSelectionDisplay();
 }
 
 void ShopPage::updateSelectionDisplay()
@@ -104,36 +157,13 @@ void ShopPage::updateSelectionDisplay()
     // TODO: Add visual selection indicator (border, highlight, etc.)
     // For now, just ensure index is valid
     if (m_selectedIndex < 0) m_selectedIndex = 0;
-    if (m_selectedIndex >= m_shopItems.size() && m_shopItems.size() > 0) m_selectedIndex = m_shopItems.size() - 1;
+    if (m_selectedIndex >= m_cardOrder.size() && m_cardOrder.size() > 0) m_selectedIndex = m_cardOrder.size() - 1;
 }
 
-void ShopPage::clearShop()
-{
-    while (m_shopGridLayout->count() > 0) {
-        QLayoutItem *item = m_shopGridLayout->takeAt(0);
-        if (item->widget()) {
-            delete item->widget();
-        }
-        delete item;
-    }
-}
-
-QWidget* ShopPage::createShopItemCard(Item *item, int price)
+QWidget* ShopPage::createShopItemCard(Item *item, int price, QPushButton **buyButton)
 {
     QFrame *card = new QFrame();
-    card->setStyleSheet(QString(
-        "QFrame {"
-        "    background-color: %1;"
-        "    border: 2px solid %2;"
-        "    border-radius: 8px;"
-        "    padding: 8px;"
-        "}"
-        "QFrame:hover {"
-        "    border-color: %3;"
-        "}"
-    ).arg(Theme::CARD.name())
-     .arg(Theme::BORDER.name())
-     .arg(Theme::PRIMARY.name()));
+    Theme::setRole(card, "shopCard");
     card->setMinimumSize(150, 140);
     card->setCursor(Qt::PointingHandCursor);
 
@@ -141,13 +171,13 @@ QWidget* ShopPage::createShopItemCard(Item *item, int price)
 
     // Item name
     QLabel *nameLabel = new QLabel(item->name);
-    nameLabel->setStyleSheet("font-weight: bold; font-size: 13px;");
+    Theme::setRole(nameLabel, "shopItemName");
     nameLabel->setWordWrap(true);
     layout->addWidget(nameLabel);
 
     // Item type
     QLabel *typeLabel = new QLabel(item->itemType);
-    typeLabel->setStyleSheet(QString("color: %1; font-size: 11px;").arg(Theme::MUTED_FOREGROUND.name()));
+    Theme::setRole(typeLabel, "shopItemType");
     layout->addWidget(typeLabel);
 
     // Stats
@@ -158,46 +188,30 @@ QWidget* ShopPage::createShopItemCard(Item *item, int price)
 
     if (!statsText.isEmpty()) {
         QLabel *statsLabel = new QLabel(statsText);
-        statsLabel->setStyleSheet(QString("color: %1; font-size: 10px;").arg(Theme::ACCENT.name()));
+        Theme::setRole(statsLabel, "shopItemStats");
         statsLabel->setWordWrap(true);
         layout->addWidget(statsLabel);
     }
 
     // Price
     QLabel *priceLabel = new QLabel(QString("💰 %1 Gold").arg(price));
-    priceLabel->setStyleSheet("font-size: 12px; font-weight: bold; color: #e5c07b;");
+    Theme::setRole(priceLabel, "shopItemPrice");
     layout->addWidget(priceLabel);
 
     layout->addStretch();
 
     // Buy button
     QPushButton *buyBtn = new QPushButton("Buy");
+    buyBtn->setObjectName(QString("buyButton_%1").arg(item->name));
     buyBtn->setMinimumHeight(30);
-    buyBtn->setStyleSheet(QString(
-        "QPushButton {"
-        "    background-color: %1;"
-        "    color: %2;"
-        "    font-size: 11px;"
-        "    border-radius: 4px;"
-        "}"
-        "QPushButton:hover { background-color: %3; }"
-        "QPushButton:disabled { background-color: %4; color: %5; }"
-    ).arg(Theme::PRIMARY.name())
-     .arg(Theme::PRIMARY_FOREGROUND.name())
-     .arg(Theme::PRIMARY.lighter(110).name())
-     .arg(Theme::MUTED.name())
-     .arg(Theme::MUTED_FOREGROUND.name()));
-
-    // Disable button if player can't afford
-    if (m_currentPlayer && m_currentPlayer->gold < price) {
-        buyBtn->setEnabled(false);
-    }
+    Theme::setRole(buyBtn, "buyButton");
 
     connect(buyBtn, &QPushButton::clicked, [this, item, price]() {
         handleBuyClicked(item, price);
     });
     layout->addWidget(buyBtn);
 
+    *buyButton = buyBtn;
     return card;
 }
 
@@ -232,8 +246,8 @@ void ShopPage::handleBuyClicked(Item *item, int price)
     QMessageBox::information(this, "Purchase Successful",
         QString("You bought %1 for %2 gold!").arg(item->name).arg(price));
 
-    // Refresh shop display
-    updateShop(m_currentPlayer);
+    // Only gold changed; the catalog cards stay as they are
+    refreshPlayerState();
 }
 
 void ShopPage::handleSellClicked()
@@ -259,7 +273,8 @@ void ShopPage::handleSellClicked()
     connect(sellDialog, &ItemSelectionOverlay::itemSelected,
             this, &ShopPage::onItemSelectedForSell);
 
-    sellDialog->exec();
+    // Shown over the window without blocking; the queue deletes it once closed
+    DialogQueue::forWindow(this)->enqueue(sellDialog);
 }
 
 void ShopPage::onItemSelectedForSell(Item *item)
@@ -285,8 +300,8 @@ void ShopPage::onItemSelectedForSell(Item *item)
         QMessageBox::information(this, "Item Sold",
             QString("You sold %1 for %2 gold!").arg(item->name).arg(sellPrice));
 
-        // Refresh shop display
-        updateShop(m_currentPlayer);
+        // Only gold changed; the catalog cards stay as they are
+        refreshPlayerState();
 
         // Clean up - delete the item
         delete item;
@@ -311,7 +326,7 @@ void ShopPage::keyPressEvent(QKeyEvent *event)
             event->accept();
             break;
         case Qt::Key_Down:
-            if (m_selectedIndex + 4 < m_shopItems.size()) {
+            if (m_selectedIndex + 4 < m_cardOrder.size()) {
                 m_selectedIndex += 4;
                 updateSelectionDisplay();
             }
@@ -325,7 +340,7 @@ void ShopPage::keyPressEvent(QKeyEvent *event)
             event->accept();
             break;
         case Qt::Key_Right:
-            if (m_selectedIndex + 1 < m_shopItems.size()) {
+            if (m_selectedIndex + 1 < m_cardOrder.size()) {
                 m_selectedIndex++;
                 updateSelectionDisplay();
             }
@@ -333,9 +348,9 @@ void ShopPage::keyPressEvent(QKeyEvent *event)
             break;
         case Qt::Key_Return:
         case Qt::Key_Enter:
-            if (m_selectedIndex >= 0 && m_selectedIndex < m_shopItems.size()) {
-                auto [item, price] = m_shopItems[m_selectedIndex];
-                handleBuyClicked(item, price);
+            if (m_selectedIndex >= 0 && m_selectedIndex < m_cardOrder.size()) {
+                const ShopCard card = m_cards.value(m_cardOrder[m_selectedIndex]);
+                handleBuyClicked(card.item, card.price);
             }
             event->accept();
             break;
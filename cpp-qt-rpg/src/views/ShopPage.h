@@ -2,6 +2,9 @@
 #define SHOPPAGE_H
 
 #include <QWidget>
+#include <QHash>
+#include <QStringList>
+#include "../diagnostics/AllocationTracker.h"
 
 class QLabel;
 class QKeyEvent;
@@ -14,6 +17,7 @@ class ShopPage : public QWidget
 {
     Q_OBJECT
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.pages")
     explicit ShopPage(QWidget *parent = nullptr);
 
     void updateShop(Player *player);
@@ -28,9 +32,22 @@ protected:
     void keyPressEvent(QKeyEvent *event) override;
 
 private:
+    // Widgets for one catalog entry, kept across visits
+    struct ShopCard
+    {
+        QWidget *widget;
+        QPushButton *buyButton;
+        Item *item;
+        int price;
+        int contentRevision;  // ContentDatabase::revision() the card was built from
+    };
+
     void setupUi();
-    void clearShop();
-    QWidget* createShopItemCard(Item *item, int price);
+    // Creates or drops cards only where the catalog differs from the cards on screen
+    void reconcileCatalog();
+    // Gold label and Buy-button affordability; cheap enough to run after every trade
+    void refreshPlayerState();
+    QWidget* createShopItemCard(Item *item, int price, QPushButton **buyButton);
     void handleBuyClicked(Item *item, int price);
     void handleSellClicked();
     void onItemSelectedForSell(Item *item);
@@ -42,8 +59,8 @@ private:
     QPushButton *m_leaveButton;
     Player *m_currentPlayer;
 
-    QList<QPair<Item*, int>> m_shopItems;  // item and price
-    QList<QWidget*> m_itemCards;
+    QHash<QString, ShopCard> m_cards;  // keyed by catalog item id
+    QStringList m_cardOrder;           // ids in grid order
     int m_selectedIndex;
 };
 
@@ -1,4 +1,5 @@
 #include "StatsPage.h"
+#include "../diagnostics/Profiler.h"
 #include "../models/Player.h"
 #include "../theme/Theme.h"
 #include <QHBoxLayout>
@@ -120,6 +121,7 @@ QWidget* StatsPage::createStatRow(const QString &name, const QString &descriptio
 
 void StatsPage::updateStats(Player *player)
 {
+    PYRPG_PROFILE_SCOPE("StatsPage::updateStats");
     if (!player) return;
 
     m_currentPlayer = player;
@@ -2,6 +2,7 @@
 #define STATSPAGE_H
 
 #include <QWidget>
+#include "../diagnostics/AllocationTracker.h"
 
 class QLabel;
 class QProgressBar;
@@ -12,6 +13,7 @@ class StatsPage : public QWidget
 {
     Q_OBJECT
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.pages")
     explicit StatsPage(QWidget *parent = nullptr);
     void updateStats(Player *player);
 
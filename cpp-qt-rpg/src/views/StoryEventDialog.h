@@ -10,12 +10,14 @@
 #include <QKeyEvent>
 #include <QDateTime>
 #include <QSettings>
+#include "../diagnostics/AllocationTracker.h"
 
 class StoryEventDialog : public QDialog
 {
     Q_OBJECT
 
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.dialogs")
     explicit StoryEventDialog(const StoryEvent &event, QWidget *parent = nullptr);
 
 protected:
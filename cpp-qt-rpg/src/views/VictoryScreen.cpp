@@ -1,6 +1,7 @@
 #include "VictoryScreen.h"
 #include "../theme/Theme.h"
 #include "../components/ParticleSystem.h"
+#include "../components/AnimationSpeed.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QGridLayout>
@@ -9,7 +10,6 @@
 #include <QFont>
 #include <QGraphicsDropShadowEffect>
 #include <QKeyEvent>
-#include <QTimer>
 
 VictoryScreen::VictoryScreen(int finalLevel, int playtime, int kills, int deaths,
                              int gold, int quests, QWidget *parent)
@@ -38,16 +38,16 @@ VictoryScreen::VictoryScreen(int finalLevel, int playtime, int kills, int deaths
     m_particleSystem->raise();
 
     // Trigger celebratory particle effects after a short delay
-    QTimer::singleShot(300, [this]() {
+    AnimationSpeed::instance().runAfter(300, this, [this]() {
         if (m_particleSystem) {
             QPoint centerPos = rect().center();
             m_particleSystem->victoryExplosion(centerPos);
 
             // Trigger additional bursts for extra celebration
-            QTimer::singleShot(600, [this, centerPos]() {
+            AnimationSpeed::instance().runAfter(600, this, [this, centerPos]() {
                 m_particleSystem->goldRewardBurst(centerPos + QPoint(0, -100));
             });
-            QTimer::singleShot(1000, [this, centerPos]() {
+            AnimationSpeed::instance().runAfter(1000, this, [this, centerPos]() {
                 m_particleSystem->createBurst(centerPos + QPoint(0, 100), 12, "star", "#9b59b6", false);
             });
         }
@@ -2,6 +2,7 @@
 #define VICTORYSCREEN_H
 
 #include <QDialog>
+#include "../diagnostics/AllocationTracker.h"
 
 class QLabel;
 class QPushButton;
@@ -13,6 +14,7 @@ class VictoryScreen : public QDialog
     Q_OBJECT
 
 public:
+    PYRPG_TRACK_ALLOCATIONS("widgets.pages")
     explicit VictoryScreen(int finalLevel, int playtime, int kills, int deaths,
                           int gold, int quests, QWidget *parent = nullptr);
 
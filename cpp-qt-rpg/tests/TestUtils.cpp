@@ -1,6 +1,7 @@
 #include "TestUtils.h"
 #include <QDebug>
 #include <QSignalSpy>
+#include <QStringList>
 
 // Include model headers
 #include "models/Player.h"
@@ -78,6 +79,10 @@ PlayerBuilder::PlayerBuilder()
     , m_health(100)
     , m_maxHealth(100)
     , m_experience(0)
+    , m_syntheticItemCount(0)
+    , m_syntheticQuestCount(0)
+    , m_syntheticQuestTarget("Synthetic Beast")
+    , m_syntheticLoreCount(0)
 {
 }
 
@@ -130,6 +135,22 @@ PlayerBuilder& PlayerBuilder::withSkills(const QList<Skill*>& skills) {
     return *this;
 }
 
+PlayerBuilder& PlayerBuilder::withSyntheticInventory(int itemCount) {
+    m_syntheticItemCount = itemCount;
+    return *this;
+}
+
+PlayerBuilder& PlayerBuilder::withSyntheticQuests(int activeQuestCount, const QString& targetId) {
+    m_syntheticQuestCount = activeQuestCount;
+    m_syntheticQuestTarget = targetId;
+    return *this;
+}
+
+PlayerBuilder& PlayerBuilder::withSyntheticLore(int entryCount) {
+    m_syntheticLoreCount = entryCount;
+    return *this;
+}
+
 Player* PlayerBuilder::build() {
     Player* player = new Player(m_name, m_characterClass);
     player->level = m_level;
@@ -151,6 +172,42 @@ Player* PlayerBuilder::build() {
         }
     }
 
+    // Synthetic data: deterministic, varied enough to exercise every serialized field
+    static const QStringList rarities = {"common", "uncommon", "rare", "epic", "legendary"};
+    static const QStringList slots = {"weapon", "armor", "accessory", ""};
+    player->inventory.reserve(player->inventory.size() + m_syntheticItemCount);
+    for (int i = 0; i < m_syntheticItemCount; ++i) {
+        QString slot = slots[i % slots.size()];
+        player->inventory.append(new Item(
+            QString("Synthetic Item %1").arg(i),
+            slot.isEmpty() ? "consumable" : slot,
+            rarities[i % rarities.size()],
+            slot,
+            i % 17, i % 13,
+            slot.isEmpty() ? "heal" : "",
+            i % 50, 10 + i % 500,
+            QString("Generated item number %1 for scale testing.").arg(i)));
+    }
+
+    for (int i = 0; i < m_syntheticQuestCount; ++i) {
+        Quest* quest = new Quest(QString("synthetic_quest_%1").arg(i),
+                                 QString("Synthetic Quest %1").arg(i),
+                                 "Generated quest for scale testing.", "active");
+        QuestObjective objective;
+        objective.type = "kill_enemies";
+        objective.description = QString("Defeat %1").arg(m_syntheticQuestTarget);
+        objective.targetId = m_syntheticQuestTarget;
+        objective.required = 1000000;  // Never completes during a run
+        quest->objectives.append(objective);
+        quest->rewards.experience = 10;
+        quest->rewards.gold = 10;
+        player->quests.append(quest);
+    }
+
+    for (int i = 0; i < m_syntheticLoreCount; ++i) {
+        player->unlockedLoreEntries.append(QString("synthetic_lore_%1").arg(i));
+    }
+
     return player;
 }
 
@@ -257,6 +314,20 @@ Player* TestFixtures::createLowHealthWarrior() {
         .build();
 }
 
+Player* TestFixtures::createLargeSyntheticPlayer(int itemCount, int questCount) {
+    return PlayerBuilder()
+        .withName("SyntheticHero")
+        .withClass("Warrior")
+        .withLevel(30)
+        .withGold(100000)
+        .withHealth(500)
+        .withMaxHealth(500)
+        .withSyntheticInventory(itemCount)
+        .withSyntheticQuests(questCount)
+        .withSyntheticLore(questCount)
+        .build();
+}
+
 Monster* TestFixtures::createWeakGoblin() {
     return MonsterBuilder()
         .withName("Weak Goblin")
@@ -86,6 +86,11 @@ public:
     PlayerBuilder& withItems(const QList<Item*>& items);
     PlayerBuilder& withSkills(const QList<Skill*>& skills);
 
+    // Synthetic scale data (for benchmarks and stress tests)
+    PlayerBuilder& withSyntheticInventory(int itemCount);
+    PlayerBuilder& withSyntheticQuests(int activeQuestCount, const QString& targetId = "Synthetic Beast");
+    PlayerBuilder& withSyntheticLore(int entryCount);
+
     Player* build();
 
 private:
@@ -98,6 +103,10 @@ private:
     int m_experience;
     QList<Item*> m_items;
     QList<Skill*> m_skills;
+    int m_syntheticItemCount;
+    int m_syntheticQuestCount;
+    QString m_syntheticQuestTarget;
+    int m_syntheticLoreCount;
 };
 
 // Fluent builder for Monster objects
@@ -135,6 +144,7 @@ public:
     static Player* createBasicWarrior();
     static Player* createHighLevelWarrior();
     static Player* createLowHealthWarrior();
+    static Player* createLargeSyntheticPlayer(int itemCount = 10000, int questCount = 1000);
 
     // Monster fixtures
     static Monster* createWeakGoblin();
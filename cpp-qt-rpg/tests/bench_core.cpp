@@ -0,0 +1,235 @@
+#include <QtTest/QtTest>
+#include <QLoggingCategory>
+#include "TestUtils.h"
+#include "game/Game.h"
+#include "game/QuestManager.h"
+#include "game/CodexManager.h"
+#include "game/SearchIndex.h"
+#include "game/factories/ItemFactory.h"
+#include "game/factories/MonsterFactory.h"
+#include "game/factories/QuestFactory.h"
+#include "game/factories/SkillFactory.h"
+
+/**
+ * Benchmarks for engine hot paths.
+ *
+ * Run with QtTest's machine-readable loggers to compare runs, e.g.:
+ *   bench_core -o bench_core.xml,xml -o -,txt
+ *   bench_core -o bench_core.csv,csv
+ * (the bench_core_report target writes bench_core.xml and bench_core.csv)
+ */
+class BenchCore : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void benchCalculateDamage();
+    void benchCombatRound();
+    void benchQuestOnCombatEnd_data();
+    void benchQuestOnCombatEnd();
+    void benchCodexOnEnemyKilled();
+    void benchPlayerSave_data();
+    void benchPlayerSave();
+    void benchPlayerLoad_data();
+    void benchPlayerLoad();
+    void benchMonsterFactorySpawn();
+    void benchFinalBossSpawn();
+    void benchItemFactoryRandomItem();
+    void benchSkillFactoryStartingSkills();
+    void benchQuestFactoryAllMainQuests();
+    void benchSearchIndexPrefixQuery();
+
+private:
+    void addInventorySizes();
+};
+
+void BenchCore::initTestCase()
+{
+    // Managers log every event with qDebug; keep it out of the measurements
+    QLoggingCategory::setFilterRules("*.debug=false");
+}
+
+void BenchCore::addInventorySizes()
+{
+    QTest::addColumn<int>("itemCount");
+    QTest::newRow("100 items") << 100;
+    QTest::newRow("1000 items") << 1000;
+    QTest::newRow("10000 items") << 10000;
+}
+
+void BenchCore::benchCalculateDamage()
+{
+    Game game;
+    volatile int sink = 0;
+
+    QBENCHMARK {
+        sink = sink + game.calculateDamage(50, 10, 12, false);
+    }
+}
+
+void BenchCore::benchCombatRound()
+{
+    Game game;
+    Player* player = TestFixtures::createHighLevelWarrior();
+    Monster* monster = MonsterBuilder()
+        .withName("Training Dummy")
+        .withLevel(10)
+        .withHealth(1000000000)
+        .withMaxHealth(1000000000)
+        .build();
+    game.setPlayerForTesting(player);        // Owned by game from here on
+    game.setCurrentMonsterForTesting(monster);
+    game.setCombatActiveForTesting(true);
+
+    QBENCHMARK {
+        game.playerAttack();
+        game.monsterAttack();
+        // Keep the fight going so every iteration measures a full round
+        player->health = player->maxHealth;
+        monster->health = monster->maxHealth;
+    }
+}
+
+void BenchCore::benchQuestOnCombatEnd_data()
+{
+    QTest::addColumn<int>("questCount");
+    QTest::newRow("10 active quests") << 10;
+    QTest::newRow("100 active quests") << 100;
+    QTest::newRow("1000 active quests") << 1000;
+}
+
+void BenchCore::benchQuestOnCombatEnd()
+{
+    QFETCH(int, questCount);
+
+    Player* player = PlayerBuilder()
+        .withSyntheticQuests(questCount, "Goblin")
+        .build();
+    QuestManager questManager(player);
+
+    QBENCHMARK {
+        questManager.onCombatEnd(ContentId("Goblin"));
+    }
+
+    delete player;
+}
+
+void BenchCore::benchCodexOnEnemyKilled()
+{
+    Player* player = TestFixtures::createBasicWarrior();
+    CodexManager codexManager(player);
+    codexManager.loadLoreEntries();
+
+    QBENCHMARK {
+        codexManager.onEnemyKilled(ContentId("Goblin"));
+    }
+
+    delete player;
+}
+
+void BenchCore::benchPlayerSave_data()
+{
+    addInventorySizes();
+}
+
+void BenchCore::benchPlayerSave()
+{
+    QFETCH(int, itemCount);
+
+    Player* player = TestFixtures::createLargeSyntheticPlayer(itemCount, 100);
+
+    QBENCHMARK {
+        QByteArray data;
+        QDataStream out(&data, QIODevice::WriteOnly);
+        out.setVersion(QDataStream::Qt_6_0);
+        out << *player;
+    }
+
+    delete player;
+}
+
+void BenchCore::benchPlayerLoad_data()
+{
+    addInventorySizes();
+}
+
+void BenchCore::benchPlayerLoad()
+{
+    QFETCH(int, itemCount);
+
+    Player* source = TestFixtures::createLargeSyntheticPlayer(itemCount, 100);
+    QByteArray data;
+    {
+        QDataStream out(&data, QIODevice::WriteOnly);
+        out.setVersion(QDataStream::Qt_6_0);
+        out << *source;
+    }
+    delete source;
+
+    QBENCHMARK {
+        QDataStream in(data);
+        in.setVersion(QDataStream::Qt_6_0);
+        Player loaded("");
+        in >> loaded;
+    }
+}
+
+void BenchCore::benchMonsterFactorySpawn()
+{
+    QBENCHMARK {
+        delete MonsterFactory::createRandomMonster(10);
+    }
+}
+
+void BenchCore::benchFinalBossSpawn()
+{
+    QBENCHMARK {
+        delete MonsterFactory::createFinalBoss(20);
+    }
+}
+
+void BenchCore::benchItemFactoryRandomItem()
+{
+    QBENCHMARK {
+        delete ItemFactory::generateRandomItem(10);
+    }
+}
+
+void BenchCore::benchSkillFactoryStartingSkills()
+{
+    QBENCHMARK {
+        QList<Skill*> skills = SkillFactory::getStartingSkills("Mage");
+        qDeleteAll(skills);
+    }
+}
+
+void BenchCore::benchQuestFactoryAllMainQuests()
+{
+    QBENCHMARK {
+        QList<Quest*> quests = QuestFactory::getAllMainQuests();
+        qDeleteAll(quests);
+    }
+}
+
+void BenchCore::benchSearchIndexPrefixQuery()
+{
+    // Large synthetic catalog: 20k documents over a few thousand distinct terms
+    SearchIndex index;
+    for (int i = 0; i < 20000; ++i) {
+        index.addDocument({SearchDocument::Lore, ContentId(QString::number(i)),
+                           QString("Entry %1 of the shadow chronicle").arg(i),
+                           QString("The ancient war left ruin %1 near keep %2 and tower %3.")
+                               .arg(i % 997).arg(i % 313).arg(i % 71)});
+    }
+    index.search("warm", 1);  // Builds the sorted term list outside the measurement
+
+    QBENCHMARK {
+        QList<int> results = index.search("tower 7", 50);
+        Q_UNUSED(results);
+    }
+}
+
+QTEST_GUILESS_MAIN(BenchCore)
+#include "bench_core.moc"
@@ -0,0 +1,110 @@
+#include <QtTest/QtTest>
+#include <QApplication>
+#include <QLabel>
+#include <QLoggingCategory>
+#include <QVBoxLayout>
+#include <functional>
+#include <memory>
+#include "theme/StyleSheet.h"
+#include "theme/Theme.h"
+#include "views/InventoryPage.h"
+#include "views/MainMenu.h"
+#include "views/NewGameView.h"
+#include "views/ShopPage.h"
+
+/**
+ * Benchmarks for theming and page construction.
+ *
+ * Widgets are polished (ensurePolished) inside the measured block so stylesheet
+ * matching is included, as it is when a page is first shown. Run the same way
+ * as bench_core, e.g.:
+ *   bench_ui -o bench_ui.xml,xml -o -,txt
+ * (the bench_ui_report target writes bench_ui.xml and bench_ui.csv)
+ */
+class BenchUi : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void benchApplyApplicationTheme();
+    void benchLabelStyling_data();
+    void benchLabelStyling();
+    void benchPageConstruction_data();
+    void benchPageConstruction();
+};
+
+using PageFactory = std::function<QWidget *()>;
+Q_DECLARE_METATYPE(PageFactory)
+
+void BenchUi::initTestCase()
+{
+    QLoggingCategory::setFilterRules("*.debug=false");
+    Theme::applyApplicationTheme(*qApp);
+}
+
+void BenchUi::benchApplyApplicationTheme()
+{
+    // Clearing first so every iteration re-parses the sheet, as at startup
+    QBENCHMARK {
+        qApp->setStyleSheet(QString());
+        Theme::applyApplicationTheme(*qApp);
+    }
+}
+
+void BenchUi::benchLabelStyling_data()
+{
+    QTest::addColumn<bool>("perWidgetStyleSheet");
+    QTest::addColumn<int>("labelCount");
+
+    // Before: each widget parsed its own sheet; after: one application rule per role
+    QTest::newRow("per-widget stylesheet, 200 labels") << true << 200;
+    QTest::newRow("application rule by role, 200 labels") << false << 200;
+}
+
+void BenchUi::benchLabelStyling()
+{
+    QFETCH(bool, perWidgetStyleSheet);
+    QFETCH(int, labelCount);
+
+    const QString styleSheet = QString("color: %1; font-size: 18px; font-weight: bold;").arg(Theme::GOLD.name());
+
+    QBENCHMARK {
+        QWidget page;
+        QVBoxLayout *layout = new QVBoxLayout(&page);
+        for (int i = 0; i < labelCount; ++i) {
+            QLabel *label = new QLabel(QString("Gold: %1").arg(i));
+            if (perWidgetStyleSheet) {
+                label->setStyleSheet(styleSheet);
+            } else {
+                Theme::setRole(label, "gold");
+            }
+            layout->addWidget(label);
+        }
+        page.ensurePolished();
+    }
+}
+
+void BenchUi::benchPageConstruction_data()
+{
+    QTest::addColumn<PageFactory>("factory");
+
+    QTest::newRow("InventoryPage") << PageFactory([]() -> QWidget * { return new InventoryPage(); });
+    QTest::newRow("ShopPage") << PageFactory([]() -> QWidget * { return new ShopPage(); });
+    QTest::newRow("MainMenu") << PageFactory([]() -> QWidget * { return new MainMenu(); });
+    QTest::newRow("NewGameView") << PageFactory([]() -> QWidget * { return new NewGameView(); });
+}
+
+void BenchUi::benchPageConstruction()
+{
+    QFETCH(PageFactory, factory);
+
+    QBENCHMARK {
+        std::unique_ptr<QWidget> page(factory());
+        page->ensurePolished();
+    }
+}
+
+QTEST_MAIN(BenchUi)
+#include "bench_ui.moc"
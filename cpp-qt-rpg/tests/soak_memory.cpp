@@ -0,0 +1,123 @@
+#include <QtTest/QtTest>
+#include <QLoggingCategory>
+#include <QFile>
+#include "diagnostics/AllocationTracker.h"
+#include "game/Game.h"
+#include "models/Player.h"
+#include "models/Item.h"
+
+/**
+ * Memory soak test: plays a long run of auto-resolved combat turns and checks
+ * that live tracked allocations (see AllocationTracker.h) stay flat.
+ *
+ * Built with PYRPG_ENABLE_ALLOCATION_TRACKING. Defaults to 1,000,000 turns;
+ * set PYRPG_SOAK_TURNS to shorten local runs.
+ */
+class SoakMemory : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void testLongSessionMemoryIsFlat();
+
+private:
+    static const int WARMUP_TURNS = 20000;
+    static const int INVENTORY_CAP = 20;   // The soak player "sells" loot beyond this
+    static const qint64 LIVE_COUNT_SLACK = 64;
+    static const qint64 RSS_SLACK_BYTES = 16 * 1024 * 1024;
+
+    static QMap<QString, qint64> liveCounts();
+    static qint64 residentBytes();
+    static void playTurn(Game &game);
+};
+
+void SoakMemory::initTestCase()
+{
+    QVERIFY2(AllocationTracker::isEnabled(), "soak_memory must be built with PYRPG_ENABLE_ALLOCATION_TRACKING");
+    QLoggingCategory::setFilterRules("*.debug=false");
+}
+
+QMap<QString, qint64> SoakMemory::liveCounts()
+{
+    QMap<QString, qint64> counts;
+    for (const AllocationSnapshot &snapshot : AllocationTracker::instance().snapshots()) {
+        counts.insert(snapshot.name, snapshot.liveCount);
+    }
+    return counts;
+}
+
+// Resident set size on Linux; 0 where /proc is unavailable
+qint64 SoakMemory::residentBytes()
+{
+    QFile statm("/proc/self/statm");
+    if (!statm.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+    QList<QByteArray> fields = statm.readAll().split(' ');
+    if (fields.size() < 2) {
+        return 0;
+    }
+    return fields.at(1).toLongLong() * 4096;
+}
+
+void SoakMemory::playTurn(Game &game)
+{
+    Player *player = game.getPlayer();
+
+    if (!game.isInCombat()) {
+        while (player->inventory.size() > INVENTORY_CAP) {
+            delete player->inventory.takeLast();
+        }
+        game.startCombat();
+    }
+
+    game.playerAttack();
+    if (game.isInCombat()) {
+        game.monsterAttack();
+    }
+
+    // Auto-resolve: the soak player never dies
+    player->health = player->maxHealth;
+    player->mana = player->maxMana;
+}
+
+void SoakMemory::testLongSessionMemoryIsFlat()
+{
+    int turns = 1000000;
+    if (qEnvironmentVariableIsSet("PYRPG_SOAK_TURNS")) {
+        turns = qMax(WARMUP_TURNS * 2, qEnvironmentVariableIntValue("PYRPG_SOAK_TURNS"));
+    }
+
+    Game game;
+    game.newGame("Soak", "Warrior");
+
+    for (int turn = 0; turn < WARMUP_TURNS; ++turn) {
+        playTurn(game);
+    }
+    const QMap<QString, qint64> baselineCounts = liveCounts();
+    const qint64 baselineRss = residentBytes();
+
+    for (int turn = WARMUP_TURNS; turn < turns; ++turn) {
+        playTurn(game);
+    }
+    const QMap<QString, qint64> finalCounts = liveCounts();
+    const qint64 finalRss = residentBytes();
+
+    qInfo().noquote() << "\n" << AllocationTracker::instance().report();
+    qInfo() << "RSS after warm-up:" << baselineRss << "bytes, after" << turns << "turns:" << finalRss << "bytes";
+
+    for (auto it = finalCounts.cbegin(); it != finalCounts.cend(); ++it) {
+        qint64 baseline = baselineCounts.value(it.key(), 0);
+        QVERIFY2(it.value() <= baseline + LIVE_COUNT_SLACK,
+                 qPrintable(QString("%1 grew from %2 to %3 live objects")
+                                .arg(it.key()).arg(baseline).arg(it.value())));
+    }
+    if (baselineRss > 0 && finalRss > 0) {
+        QVERIFY2(finalRss - baselineRss <= RSS_SLACK_BYTES,
+                 qPrintable(QString("RSS grew by %1 bytes").arg(finalRss - baselineRss)));
+    }
+}
+
+QTEST_GUILESS_MAIN(SoakMemory)
+#include "soak_memory.moc"
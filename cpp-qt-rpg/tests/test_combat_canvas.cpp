@@ -0,0 +1,152 @@
+#include <QtTest>
+#include "components/CombatCanvas.h"
+#include "components/CombatTimeline.h"
+#include "components/AnimationSpeed.h"
+
+class TestCombatCanvas : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testTimelineTracksAndCues();
+    void testTimelineCallbacksMayAddTracks();
+    void testHealthChangesAnimate();
+    void testNewEncounterDoesNotAnimate();
+    void testFrameClockStopsWhenIdle();
+    void testInstantSpeedCompletesSynchronously();
+};
+
+void TestCombatCanvas::testTimelineTracksAndCues()
+{
+    CombatTimeline timeline;
+    QList<qreal> values;
+    bool finished = false;
+    bool cued = false;
+    timeline.addTrack(100, 200, QEasingCurve::Linear, [&values](qreal progress) {
+        values.append(progress);
+    }, [&finished]() { finished = true; });
+    timeline.addCue(150, [&cued]() { cued = true; });
+
+    // Nothing starts before its time on the clock
+    timeline.advance(50);
+    QVERIFY(values.isEmpty());
+    QVERIFY(!cued);
+
+    timeline.advance(100);  // t = 150
+    QCOMPARE(values.size(), 1);
+    QCOMPARE(values.last(), 0.25);
+    QVERIFY(cued);
+    QVERIFY(!finished);
+
+    timeline.advance(500);  // Past the end: one final apply(1.0), then the completion
+    QCOMPARE(values.last(), 1.0);
+    QVERIFY(finished);
+    QVERIFY(timeline.isIdle());
+    QCOMPARE(timeline.now(), qint64(650));
+}
+
+void TestCombatCanvas::testTimelineCallbacksMayAddTracks()
+{
+    CombatTimeline timeline;
+    QStringList order;
+    timeline.addCue(0, [&]() {
+        order.append("first");
+        timeline.addCue(timeline.now() + 10, [&order]() { order.append("second"); });
+    });
+
+    timeline.advance(1);
+    QCOMPARE(order, QStringList({"first"}));
+    QCOMPARE(timeline.trackCount(), 1);
+    timeline.advance(10);
+    QCOMPARE(order, QStringList({"first", "second"}));
+    QVERIFY(timeline.isIdle());
+}
+
+void TestCombatCanvas::testHealthChangesAnimate()
+{
+    CombatCanvas canvas;
+    canvas.resize(600, 300);
+    canvas.setCombatMode(true);
+    canvas.setHero(":/assets/warrior.png", 100, 100, 50, 50);
+    canvas.setEnemy(":/assets/goblin.png", "Goblin (Level 1)", 40, 40);
+    QCOMPARE(canvas.floatingTextCount(), 0);
+
+    // A hit floats a damage number and slides the bar instead of jumping
+    canvas.setEnemy(":/assets/goblin.png", "Goblin (Level 1)", 25, 40);
+    QCOMPARE(canvas.floatingTextCount(), 1);
+    QVERIFY(canvas.isAnimating());
+    QCOMPARE(canvas.displayedHealth(CombatCanvas::Enemy), 40.0);
+
+    QTRY_COMPARE(canvas.displayedHealth(CombatCanvas::Enemy), 25.0);
+    QTRY_COMPARE(canvas.floatingTextCount(), 0);
+}
+
+void TestCombatCanvas::testNewEncounterDoesNotAnimate()
+{
+    CombatCanvas canvas;
+    canvas.setCombatMode(true);
+    canvas.setEnemy(":/assets/goblin.png", "Goblin (Level 1)", 0, 40);
+
+    // Same kind of monster in the next fight starts at full health without a "+40"
+    canvas.setCombatMode(false);
+    canvas.setCombatMode(true);
+    canvas.setEnemy(":/assets/goblin.png", "Goblin (Level 1)", 40, 40);
+    QCOMPARE(canvas.floatingTextCount(), 0);
+    QCOMPARE(canvas.displayedHealth(CombatCanvas::Enemy), 40.0);
+}
+
+void TestCombatCanvas::testFrameClockStopsWhenIdle()
+{
+    CombatCanvas canvas;
+    canvas.resize(600, 300);
+    QVERIFY(!canvas.isAnimating());
+
+    bool done = false;
+    canvas.addTrack(canvas.now(), 50, QEasingCurve::InOutQuad, [&canvas](qreal progress) {
+        canvas.setLunge(CombatCanvas::Hero, progress);
+    }, [&done]() { done = true; });
+    canvas.burst(CombatCanvas::Enemy, 5, "spark", "#e74c3c");
+    QCOMPARE(canvas.activeParticleCount(), 5);
+    QVERIFY(canvas.isAnimating());
+
+    QTRY_VERIFY(done);
+    QTRY_VERIFY(!canvas.isAnimating());
+    QCOMPARE(canvas.activeParticleCount(), 0);
+}
+
+void TestCombatCanvas::testInstantSpeedCompletesSynchronously()
+{
+    AnimationSpeed &speed = AnimationSpeed::instance();
+    AnimationSpeed::Speed previous = speed.speed();
+    speed.setSpeed(AnimationSpeed::Instant);
+
+    CombatCanvas canvas;
+    canvas.setCombatMode(true);
+    canvas.setEnemy(":/assets/goblin.png", "Goblin (Level 1)", 40, 40);
+
+    // A chained attack runs to its end in order before addTrack() returns
+    QStringList order;
+    const qint64 start = canvas.now();
+    canvas.addTrack(start, 300, QEasingCurve::InOutQuad, [&canvas](qreal progress) {
+        canvas.setLunge(CombatCanvas::Hero, progress);
+    }, [&]() {
+        order.append("lunge");
+        canvas.addCue(canvas.now() + 100, [&order]() { order.append("return"); });
+    });
+    QCOMPARE(order, QStringList({"lunge", "return"}));
+    QCOMPARE(canvas.now(), start + 400);
+    QCOMPARE(canvas.displayedHealth(CombatCanvas::Enemy), 40.0);
+
+    // Cosmetic effects are skipped and bars jump to their value
+    canvas.burst(CombatCanvas::Enemy, 5, "spark", "#e74c3c");
+    canvas.setEnemy(":/assets/goblin.png", "Goblin (Level 1)", 25, 40);
+    QCOMPARE(canvas.activeParticleCount(), 0);
+    QCOMPARE(canvas.floatingTextCount(), 0);
+    QCOMPARE(canvas.displayedHealth(CombatCanvas::Enemy), 25.0);
+    QVERIFY(!canvas.isAnimating());
+
+    speed.setSpeed(previous);
+}
+
+QTEST_MAIN(TestCombatCanvas)
+#include "test_combat_canvas.moc"
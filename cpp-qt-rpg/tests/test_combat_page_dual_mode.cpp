@@ -2,6 +2,8 @@
 #include "../src/views/CombatPage.h"
 #include "../src/models/Player.h"
 #include "../src/models/Monster.h"
+#include "../src/components/SpriteCache.h"
+#include "../src/components/LogDisplay.h"
 
 class TestCombatPageDualMode : public QObject
 {
@@ -18,6 +20,8 @@ private slots:
     void testNonCombatModeShowsWelcomeMessage();
     void testCombatSignals();
     void testCombatButtonsCreated();
+    void testCombatTurnsReuseCachedSprites();
+    void testBattleLogIsBoundedRing();
 
 private:
     CombatPage *m_combatPage;
@@ -108,5 +112,51 @@ void TestCombatPageDualMode::testCombatButtonsCreated()
     QVERIFY(m_combatPage != nullptr);
 }
 
+void TestCombatPageDualMode::testCombatTurnsReuseCachedSprites()
+{
+    Player player("Hero", "Warrior");
+    Monster monster("Goblin", 1, "goblin");
+    m_combatPage->setCombatMode(true);
+
+    // First update decodes (or records as missing) each sprite once
+    m_combatPage->updateCombatState(&player, &monster, "Combat started!");
+    int decoded = SpriteCache::instance().decodedAssetCount();
+    int variants = SpriteCache::instance().variantCount();
+
+    // Later turns must not decode or scale anything
+    for (int turn = 0; turn < 10; ++turn) {
+        monster.health -= 1;
+        m_combatPage->updateCombatState(&player, &monster, QString("Turn %1").arg(turn));
+    }
+    QCOMPARE(SpriteCache::instance().decodedAssetCount(), decoded);
+    QCOMPARE(SpriteCache::instance().variantCount(), variants);
+}
+
+void TestCombatPageDualMode::testBattleLogIsBoundedRing()
+{
+    LogDisplay log(3);
+    log.resize(300, 200);
+    for (int i = 1; i <= 5; ++i) {
+        log.addEntry(QString("Line %1").arg(i), "combat");
+    }
+
+    // Only the newest entries survive, oldest first
+    QCOMPARE(log.getEntryCount(), 3);
+    QCOMPARE(log.messages(), QStringList({"Line 3", "Line 4", "Line 5"}));
+
+    log.clearEntries();
+    QCOMPARE(log.getEntryCount(), 0);
+    log.addEntry("Fresh start");
+    QCOMPARE(log.messages(), QStringList({"Fresh start"}));
+
+    // The combat page's log resets on mode switches instead of growing forever
+    m_combatPage->setCombatMode(true);
+    LogDisplay *battleLog = m_combatPage->findChild<LogDisplay*>();
+    QVERIFY(battleLog != nullptr);
+    QCOMPARE(battleLog->getEntryCount(), 1);
+    m_combatPage->addLogEntry("Received 5 gold!", "success");
+    QCOMPARE(battleLog->getEntryCount(), 2);
+}
+
 QTEST_MAIN(TestCombatPageDualMode)
 #include "test_combat_page_dual_mode.moc"
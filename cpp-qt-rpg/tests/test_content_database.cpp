@@ -0,0 +1,190 @@
+#include <QtTest>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include "game/ContentDatabase.h"
+#include "game/ContentWatcher.h"
+
+class TestContentDatabase : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void cleanup();
+    void testBundledContentIsValid();
+    void testBrokenOverrideIsRejected_data();
+    void testBrokenOverrideIsRejected();
+    void testOverrideAppliesInPlace();
+    void testWatcherReportsChanges();
+
+private:
+    static QJsonObject bundled(const QString &fileName);
+    static bool write(const QString &path, const QByteArray &data);
+};
+
+QJsonObject TestContentDatabase::bundled(const QString &fileName)
+{
+    QFile file(":/content/" + fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QJsonObject();
+    }
+    return QJsonDocument::fromJson(file.readAll()).object();
+}
+
+bool TestContentDatabase::write(const QString &path, const QByteArray &data)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    return file.write(data) == data.size();
+}
+
+void TestContentDatabase::cleanup()
+{
+    // Back to the bundled content for the next test
+    ContentDatabase &content = ContentDatabase::instance();
+    if (!content.overrideDirectory().isEmpty()) {
+        content.setOverrideDirectory(QString());
+        QVERIFY(content.reload());
+    }
+}
+
+void TestContentDatabase::testBundledContentIsValid()
+{
+    QStringList errors;
+    QVERIFY2(ContentDatabase::validate(QString(), &errors), qPrintable(errors.join('\n')));
+    QVERIFY(errors.isEmpty());
+
+    for (const QString &fileName : ContentDatabase::fileNames()) {
+        QVERIFY2(QFile::exists(":/content/" + fileName), qPrintable(fileName));
+    }
+
+    const ContentDatabase &content = ContentDatabase::instance();
+    QVERIFY(content.item("Magic Sword"));
+    QVERIFY(!content.shopItems().isEmpty());
+    QVERIFY(content.monster("goblin"));
+    QVERIFY(content.defaultBoss());
+    QVERIFY(!content.quests().isEmpty());
+    QVERIFY(content.dialogue("elder_intro"));
+    QVERIFY(!content.storyEvents().isEmpty());
+    QVERIFY(!content.loreEntries().isEmpty());
+}
+
+void TestContentDatabase::testBrokenOverrideIsRejected_data()
+{
+    QTest::addColumn<QString>("fileName");
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<QString>("expectedError");
+
+    QTest::newRow("bad JSON") << "items.json" << QByteArray("{\"items\": [") << "items.json";
+
+    QJsonObject lore = bundled("lore.json");
+    QJsonArray entries = lore.value("lore").toArray();
+    QJsonObject entry = entries.first().toObject();
+    entry.insert("titel", "Misspelt");
+    entries.replace(0, entry);
+    lore.insert("lore", entries);
+    QTest::newRow("unknown field") << "lore.json" << QJsonDocument(lore).toJson() << "unknown field \"titel\"";
+
+    QJsonObject dialogues = bundled("dialogues.json");
+    QJsonArray trees = dialogues.value("dialogues").toArray();
+    QJsonObject tree = trees.first().toObject();
+    QJsonArray nodes = tree.value("nodes").toArray();
+    QJsonObject node = nodes.first().toObject();
+    QJsonArray choices = node.value("choices").toArray();
+    QJsonObject choice = choices.first().toObject();
+    choice.insert("targetNodeId", "nowhere");
+    choices.replace(0, choice);
+    node.insert("choices", choices);
+    nodes.replace(0, node);
+    tree.insert("nodes", nodes);
+    trees.replace(0, tree);
+    dialogues.insert("dialogues", trees);
+    QTest::newRow("dangling node") << "dialogues.json" << QJsonDocument(dialogues).toJson() << "missing node \"nowhere\"";
+}
+
+void TestContentDatabase::testBrokenOverrideIsRejected()
+{
+    QFETCH(QString, fileName);
+    QFETCH(QByteArray, data);
+    QFETCH(QString, expectedError);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QVERIFY(write(dir.filePath(fileName), data));
+
+    ContentDatabase &content = ContentDatabase::instance();
+    int revision = content.revision();
+    LoreEntry *entry = content.loreEntries().first();
+    QString title = entry->title;
+
+    content.setOverrideDirectory(dir.path());
+    QStringList errors;
+    QVERIFY(!content.reload(&errors));
+    QVERIFY(!errors.isEmpty());
+    QVERIFY2(errors.join('\n').contains(expectedError), qPrintable(errors.join('\n')));
+
+    // The current content is kept
+    QCOMPARE(content.revision(), revision);
+    QCOMPARE(content.loreEntries().first(), entry);
+    QCOMPARE(entry->title, title);
+}
+
+void TestContentDatabase::testOverrideAppliesInPlace()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    QJsonObject lore = bundled("lore.json");
+    QJsonArray entries = lore.value("lore").toArray();
+    QJsonObject first = entries.first().toObject();
+    QString entryId = first.value("id").toString();
+    first.insert("title", "Retitled");
+    entries.replace(0, first);
+    lore.insert("lore", entries);
+    QVERIFY(write(dir.filePath("lore.json"), QJsonDocument(lore).toJson()));
+
+    ContentDatabase &content = ContentDatabase::instance();
+    LoreEntry *entry = content.loreEntry(entryId);
+    QVERIFY(entry);
+    int revision = content.revision();
+
+    content.setOverrideDirectory(dir.path());
+    QStringList errors;
+    QVERIFY2(content.reload(&errors), qPrintable(errors.join('\n')));
+    QVERIFY(content.revision() > revision);
+
+    // Same object, new text; the files not overridden come from the bundle
+    QCOMPARE(content.loreEntry(entryId), entry);
+    QCOMPARE(entry->title, QString("Retitled"));
+    QVERIFY(content.dialogue("elder_intro"));
+}
+
+void TestContentDatabase::testWatcherReportsChanges()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QString path = dir.filePath("lore.json");
+    QVERIFY(write(path, QJsonDocument(bundled("lore.json")).toJson()));
+
+    ContentWatcher watcher(dir.path());
+    watcher.setDebounceMs(50);
+    QSignalSpy changedSpy(&watcher, &ContentWatcher::contentChanged);
+
+    QVERIFY(write(path, QJsonDocument(bundled("lore.json")).toJson(QJsonDocument::Compact)));
+    QVERIFY(changedSpy.wait(5000));
+
+    // A burst of edits is reported once
+    changedSpy.clear();
+    QVERIFY(write(path, QJsonDocument(bundled("lore.json")).toJson()));
+    QVERIFY(write(dir.filePath("items.json"), QJsonDocument(bundled("items.json")).toJson()));
+    QVERIFY(changedSpy.wait(5000));
+    QTest::qWait(200);
+    QCOMPARE(changedSpy.count(), 1);
+}
+
+QTEST_MAIN(TestContentDatabase)
+#include "test_content_database.moc"
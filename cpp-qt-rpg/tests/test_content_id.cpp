@@ -0,0 +1,90 @@
+#include <QTest>
+#include <QObject>
+#include <QThread>
+#include <QVariant>
+#include "game/ContentId.h"
+
+class TestContentId : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testInterning();
+    void testFolding();
+    void testFindDoesNotIntern();
+    void testVariantConversion();
+    void testConcurrentInterning();
+};
+
+void TestContentId::testInterning()
+{
+    ContentId quest("main_quest_01");
+    QVERIFY(quest.isValid());
+    QCOMPARE(ContentId(QString("main_quest_01")), quest);
+    QVERIFY(ContentId("main_quest_02") != quest);
+    QCOMPARE(quest.toString(), QString("main_quest_01"));
+    QVERIFY(int(quest.value()) < ContentId::count());
+
+    // The empty string is the invalid id
+    QVERIFY(!ContentId().isValid());
+    QCOMPARE(ContentId(QString()), ContentId());
+    QCOMPARE(ContentId("").value(), 0u);
+    QVERIFY(ContentId().toString().isNull());
+}
+
+void TestContentId::testFolding()
+{
+    ContentId wolf("Shadow Wolf");
+    QCOMPARE(wolf.folded(), ContentId("shadow wolf"));
+    QCOMPARE(ContentId("SHADOW WOLF").folded(), wolf.folded());
+    QCOMPARE(wolf.folded().folded(), wolf.folded());
+    QVERIFY(wolf != wolf.folded());
+    QCOMPARE(ContentId("goblin").folded(), ContentId("goblin"));
+}
+
+void TestContentId::testFindDoesNotIntern()
+{
+    int count = ContentId::count();
+    QVERIFY(!ContentId::find("never interned anywhere").isValid());
+    QCOMPARE(ContentId::count(), count);
+
+    ContentId golem("Stone Golem");
+    QCOMPARE(ContentId::find("Stone Golem"), golem);
+}
+
+void TestContentId::testVariantConversion()
+{
+    // Signal arguments reach QSignalSpy as QVariants
+    QVariant variant = QVariant::fromValue(ContentId("bestiary_goblin"));
+    QCOMPARE(variant.toString(), QString("bestiary_goblin"));
+}
+
+void TestContentId::testConcurrentInterning()
+{
+    const int names = 2000;
+    QList<QThread*> threads;
+    QList<QList<ContentId>> ids(4);
+    for (int t = 0; t < ids.size(); ++t) {
+        threads.append(QThread::create([&ids, t, names]() {
+            for (int i = 0; i < names; ++i) {
+                ids[t].append(ContentId(QString("concurrent_%1").arg(i)));
+            }
+        }));
+        threads.last()->start();
+    }
+    for (QThread *thread : threads) {
+        QVERIFY(thread->wait(10000));
+    }
+    qDeleteAll(threads);
+
+    // Every thread got the same id for the same string
+    for (int i = 0; i < names; ++i) {
+        for (int t = 1; t < ids.size(); ++t) {
+            QCOMPARE(ids[t][i], ids[0][i]);
+        }
+        QCOMPARE(ids[0][i].toString(), QString("concurrent_%1").arg(i));
+    }
+}
+
+QTEST_MAIN(TestContentId)
+#include "test_content_id.moc"
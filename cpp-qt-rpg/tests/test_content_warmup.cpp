@@ -0,0 +1,89 @@
+#include <QtTest>
+#include <QSignalSpy>
+#include "game/ContentWarmup.h"
+#include "game/factories/QuestFactory.h"
+#include "game/factories/LoreFactory.h"
+#include "components/SpriteCache.h"
+#include "components/SpriteManifest.h"
+#include "game/ContentDatabase.h"
+
+class TestContentWarmup : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testSpritesHandedToCache();
+    void testPrescaledSpritesFromManifest();
+    void testQuestCopiesAreIndependent();
+};
+
+void TestContentWarmup::testSpritesHandedToCache()
+{
+    SpriteCache::instance().clear();
+
+    ContentWarmup warmup;
+    QSignalSpy finishedSpy(&warmup, &ContentWarmup::finished);
+    warmup.start({{":/assets/warrior.png", QSize(100, 100)},
+                  {":/assets/missing.png", QSize(100, 100)}}, 1.0);
+    QVERIFY(warmup.isRunning());
+    QVERIFY(finishedSpy.wait(10000));
+    QVERIFY(warmup.isFinished());
+    QVERIFY(!warmup.isRunning());
+
+    // The warrior comes pre-scaled from the build, so only the missing asset is
+    // decoded (as a null entry); both variants are served without scaling again
+    SpriteCache &cache = SpriteCache::instance();
+    QCOMPARE(cache.decodedAssetCount(), 1);
+    QCOMPARE(cache.variantCount(), 2);
+    QPixmap sprite = cache.pixmap(":/assets/warrior.png", QSize(100, 100), 1.0);
+    QVERIFY(!sprite.isNull());
+    QVERIFY(sprite.width() <= 100 && sprite.height() <= 100);
+    QCOMPARE(cache.variantCount(), 2);
+
+    // The catalogs are already built
+    QVERIFY(!LoreFactory::getAllLoreEntries().isEmpty());
+}
+
+void TestContentWarmup::testPrescaledSpritesFromManifest()
+{
+    QVERIFY(QFile::exists(":/sprites/manifest.json"));
+
+    QImage standard = SpriteCache::prescaledImage(":/assets/warrior.png", QSize(100, 100), 1.0);
+    QVERIFY(!standard.isNull());
+    QVERIFY(standard.width() <= 100 && standard.height() <= 100);
+
+    // High-DPI screens get the 2x variant at physical size
+    QImage retina = SpriteCache::prescaledImage(":/assets/warrior.png", QSize(100, 100), 2.0);
+    QVERIFY(!retina.isNull());
+    QVERIFY(retina.width() > 100 || retina.height() > 100);
+    QVERIFY(retina.width() <= 200 && retina.height() <= 200);
+
+    // Sizes and assets outside the manifest fall back to the source
+    QVERIFY(SpriteCache::prescaledImage(":/assets/warrior.png", QSize(64, 64), 1.0).isNull());
+    QVERIFY(SpriteCache::prescaledImage(":/assets/missing.png", QSize(100, 100), 1.0).isNull());
+    QVERIFY(SpriteManifest::canDraw(":/assets/warrior.png"));
+    QVERIFY(!SpriteManifest::canDraw(":/assets/missing.png"));
+
+    // Every bundled monster sprite is listed, so content loads without sprite warnings
+    QStringList errors, warnings;
+    QVERIFY(ContentDatabase::validate(QString(), &errors, &warnings));
+    QVERIFY2(!warnings.join('\n').contains("spriteType"), qPrintable(warnings.join('\n')));
+}
+
+void TestContentWarmup::testQuestCopiesAreIndependent()
+{
+    QList<Quest*> first = QuestFactory::getAllMainQuests();
+    QList<Quest*> second = QuestFactory::getAllMainQuests();
+    QCOMPARE(first.size(), QuestFactory::getMainQuestTemplates().size());
+    QVERIFY(!first.isEmpty());
+
+    first.first()->status = "active";
+    QCOMPARE(second.first()->status, QuestFactory::getMainQuestTemplates().first().status);
+    QVERIFY(first.first() != second.first());
+
+    qDeleteAll(first);
+    qDeleteAll(second);
+}
+
+QTEST_MAIN(TestContentWarmup)
+#include "test_content_warmup.moc"
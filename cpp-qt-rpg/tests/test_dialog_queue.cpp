@@ -0,0 +1,117 @@
+#include <QtTest>
+#include <QDialog>
+#include <QPointer>
+#include <QSignalSpy>
+#include <QTimer>
+#include "components/DialogQueue.h"
+
+class TestDialogQueue : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testDialogsShownInOrder();
+    void testFollowUpWaitsBehindPending();
+    void testTimersKeepRunning();
+    void testOneQueuePerWindow();
+};
+
+void TestDialogQueue::testDialogsShownInOrder()
+{
+    QWidget window;
+    window.resize(800, 600);
+    window.show();
+    DialogQueue *queue = DialogQueue::forWindow(&window);
+
+    QList<int> results;
+    QPointer<QDialog> first = new QDialog();
+    QPointer<QDialog> second = new QDialog();
+    queue->enqueue(first, [&results](int result) { results.append(result); });
+    queue->enqueue(second, [&results](int result) { results.append(result); });
+
+    // Only the head is up; the dialog is embedded in the window, not a window itself
+    QCOMPARE(queue->currentDialog(), first.data());
+    QCOMPARE(queue->pendingCount(), 1);
+    QVERIFY(queue->isVisible());
+    QVERIFY(first->isVisible());
+    QVERIFY(!first->isWindow());
+    QVERIFY(!second->isVisible());
+
+    first->accept();
+    QCOMPARE(results, QList<int>({QDialog::Accepted}));
+    QCOMPARE(queue->currentDialog(), second.data());
+    QVERIFY(second->isVisible());
+
+    QSignalSpy drainedSpy(queue, &DialogQueue::drained);
+    second->reject();
+    QCOMPARE(results, QList<int>({QDialog::Accepted, QDialog::Rejected}));
+    QCOMPARE(drainedSpy.count(), 1);
+    QVERIFY(!queue->isActive());
+    QVERIFY(!queue->isVisible());
+
+    // Finished dialogs are deleted once control returns to the event loop
+    QTRY_VERIFY(first.isNull() && second.isNull());
+}
+
+void TestDialogQueue::testFollowUpWaitsBehindPending()
+{
+    QWidget window;
+    DialogQueue *queue = DialogQueue::forWindow(&window);
+
+    QStringList order;
+    QDialog *result = new QDialog();
+    result->setObjectName("result");
+    QDialog *quest = new QDialog();
+    quest->setObjectName("quest");
+    QDialog *story = new QDialog();
+    story->setObjectName("story");
+
+    queue->enqueue(result, [&](int) {
+        order.append("result");
+        // Raised while handling the first dialog; must not jump ahead of "quest"
+        queue->enqueue(story, [&](int) { order.append("story"); });
+    });
+    queue->enqueue(quest, [&](int) { order.append("quest"); });
+
+    result->accept();
+    QCOMPARE(queue->currentDialog()->objectName(), QString("quest"));
+    queue->currentDialog()->accept();
+    QCOMPARE(queue->currentDialog()->objectName(), QString("story"));
+    queue->currentDialog()->accept();
+
+    QCOMPARE(order, QStringList({"result", "quest", "story"}));
+    QVERIFY(!queue->isActive());
+}
+
+void TestDialogQueue::testTimersKeepRunning()
+{
+    QWidget window;
+    window.show();
+    DialogQueue *queue = DialogQueue::forWindow(&window);
+    queue->enqueue(new QDialog());
+    QVERIFY(queue->isActive());
+
+    // enqueue() returned straight away, so the caller's event loop still drives timers
+    QTimer tick;
+    QSignalSpy tickSpy(&tick, &QTimer::timeout);
+    tick.start(10);
+    QTRY_VERIFY(tickSpy.count() >= 3);
+    QVERIFY(queue->isActive());
+
+    queue->currentDialog()->accept();
+}
+
+void TestDialogQueue::testOneQueuePerWindow()
+{
+    QWidget window;
+    QWidget *child = new QWidget(&window);
+    QWidget *grandChild = new QWidget(child);
+
+    DialogQueue *queue = DialogQueue::forWindow(grandChild);
+    QCOMPARE(queue->parentWidget(), &window);
+    QCOMPARE(DialogQueue::forWindow(child), queue);
+    QCOMPARE(DialogQueue::forWindow(&window), queue);
+}
+
+QTEST_MAIN(TestDialogQueue)
+#include "test_dialog_queue.moc"
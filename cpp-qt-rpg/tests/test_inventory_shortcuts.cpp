@@ -1,7 +1,9 @@
 #include <QTest>
 #include <QSignalSpy>
 #include "../src/views/InventoryPage.h"
+#include "../src/components/InventoryModel.h"
 #include "../src/models/Player.h"
+#include "../src/models/Item.h"
 
 class TestInventoryShortcuts : public QObject
 {
@@ -9,6 +11,7 @@ class TestInventoryShortcuts : public QObject
 
 private slots:
     void testESCKeyClosesInventory();
+    void testModelSyncEmitsRowChanges();
     // TODO: Add more tests for arrow navigation when implemented
 };
 
@@ -27,5 +30,54 @@ void TestInventoryShortcuts::testESCKeyClosesInventory()
     QCOMPARE(spy.count(), 1);
 }
 
+void TestInventoryShortcuts::testModelSyncEmitsRowChanges()
+{
+    Player player("Test");
+    Item *potion = new Item("Potion", "consumable", "common", "", 0, 0, "heal", 20);
+    Item *sword = new Item("Sword", "weapon", "common", "weapon", 5);
+    Item *shield = new Item("Shield", "armor", "common", "armor", 0, 3);
+    Item *dagger = new Item("Dagger", "weapon", "common", "weapon", 2);
+    player.inventory = {potion, sword, shield};
+    player.equipment["weapon"] = dagger;
+
+    InventoryModel model;
+    model.setPlayer(&player);
+    QCOMPARE(model.rowCount(), 3);
+
+    QSignalSpy resetSpy(&model, &QAbstractItemModel::modelReset);
+    QSignalSpy removedSpy(&model, &QAbstractItemModel::rowsRemoved);
+    QSignalSpy insertedSpy(&model, &QAbstractItemModel::rowsInserted);
+    QSignalSpy changedSpy(&model, &QAbstractItemModel::dataChanged);
+
+    // Equipping removes the sword's row and appends the dagger, without a reset
+    QVERIFY(player.equipItem(sword));
+    model.sync();
+
+    QCOMPARE(resetSpy.count(), 0);
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(removedSpy.at(0).at(1).toInt(), 1);
+    QCOMPARE(removedSpy.at(0).at(2).toInt(), 1);
+    QCOMPARE(insertedSpy.count(), 1);
+    QCOMPARE(insertedSpy.at(0).at(1).toInt(), 2);
+    QCOMPARE(model.itemAt(0), potion);
+    QCOMPARE(model.itemAt(1), shield);
+    QCOMPARE(model.itemAt(2), dagger);
+
+    // Syncing an unchanged inventory emits nothing
+    model.sync();
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(insertedSpy.count(), 1);
+    QCOMPARE(resetSpy.count(), 0);
+    QCOMPARE(changedSpy.count(), 0);
+
+    // An item edited in place repaints only its own row
+    shield->defenseBonus = 6;
+    model.sync();
+    QCOMPARE(changedSpy.count(), 1);
+    QCOMPARE(changedSpy.at(0).at(0).toModelIndex().row(), 1);
+    QCOMPARE(changedSpy.at(0).at(1).toModelIndex().row(), 1);
+    QCOMPARE(resetSpy.count(), 0);
+}
+
 QTEST_MAIN(TestInventoryShortcuts)
 #include "test_inventory_shortcuts.moc"
@@ -4,6 +4,7 @@
 #include "models/LoreEntry.h"
 #include "game/Game.h"
 #include "game/CodexManager.h"
+#include "game/DialogueManager.h"
 #include "game/factories/LoreFactory.h"
 #include "game/factories/ItemFactory.h"
 
@@ -18,6 +19,7 @@ private slots:
     void testKillCountLoreUnlock();
     void testItemLoreConnection();
     void testDuplicateUnlockPrevention();
+    void testDialogueSearchMatchesShownNodesOnly();
 };
 
 void TestLoreDiscovery::testLoreFactoryCreation()
@@ -67,7 +69,7 @@ void TestLoreDiscovery::testCodexManagerUnlocking()
     QSignalSpy spy(&codexManager, &CodexManager::loreUnlocked);
 
     // Unlock entry
-    codexManager.unlockEntry("bestiary_goblin");
+    codexManager.unlockEntry(ContentId("bestiary_goblin"));
 
     // Verify signal emitted
     QCOMPARE(spy.count(), 1);
@@ -88,13 +90,13 @@ void TestLoreDiscovery::testKillCountLoreUnlock()
     QSignalSpy spy(&codexManager, &CodexManager::loreUnlocked);
 
     // Kill goblins - should unlock on 3rd kill
-    codexManager.onEnemyKilled("Goblin");
+    codexManager.onEnemyKilled(ContentId("Goblin"));
     QCOMPARE(spy.count(), 0);  // Not yet
 
-    codexManager.onEnemyKilled("Goblin");
+    codexManager.onEnemyKilled(ContentId("Goblin"));
     QCOMPARE(spy.count(), 0);  // Still not
 
-    codexManager.onEnemyKilled("Goblin");
+    codexManager.onEnemyKilled(ContentId("Goblin"));
     QCOMPARE(spy.count(), 1);  // Unlocked!
 
     QList<QVariant> arguments = spy.takeFirst();
@@ -139,16 +141,44 @@ void TestLoreDiscovery::testDuplicateUnlockPrevention()
     QSignalSpy spy(&codexManager, &CodexManager::loreUnlocked);
 
     // Unlock once
-    codexManager.unlockEntry("bestiary_goblin");
+    codexManager.unlockEntry(ContentId("bestiary_goblin"));
     QCOMPARE(spy.count(), 1);
 
     // Try to unlock again - should not emit signal
-    codexManager.unlockEntry("bestiary_goblin");
+    codexManager.unlockEntry(ContentId("bestiary_goblin"));
     QCOMPARE(spy.count(), 1);  // Still 1, not 2
 
     // Player should still have it only once
     QCOMPARE(player.getUnlockedLoreEntries().size(), 1);
 }
 
+void TestLoreDiscovery::testDialogueSearchMatchesShownNodesOnly()
+{
+    Game game;
+    game.newGame("TestHero");
+    auto dialogueMatches = [&game](const QString &query) {
+        int matches = 0;
+        for (const SearchDocument &document : game.searchContent(query)) {
+            matches += document.kind == SearchDocument::Dialogue ? 1 : 0;
+        }
+        return matches;
+    };
+    QCOMPARE(dialogueMatches("fortune"), 0);
+
+    // Skip straight from the greeting to accepting the quest, past "explain"
+    DialogueManager *dialogues = game.getDialogueManager();
+    dialogues->startDialogue(ContentId("elder_intro"));
+    dialogues->selectChoice(1);
+    QCOMPARE(dialogues->getCurrentNode()->id, QString("accept_quest"));
+
+    Player *player = game.getPlayer();
+    QVERIFY(player->hasViewedDialogueNode("elder_intro", "greeting"));
+    QVERIFY(player->hasViewedDialogueNode("elder_intro", "accept_quest"));
+    QVERIFY(!player->hasViewedDialogueNode("elder_intro", "explain"));
+
+    QCOMPARE(dialogueMatches("fortune"), 1);      // accept_quest
+    QCOMPARE(dialogueMatches("generations"), 0);  // explain was never shown
+}
+
 QTEST_MAIN(TestLoreDiscovery)
 #include "test_lore_discovery.moc"
@@ -1,9 +1,17 @@
 #include <QTest>
 #include <QSignalSpy>
 #include <QKeyEvent>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
 #include "TestBase.h"
 #include "MainWindow.h"
 #include "components/MenuOverlay.h"
+#include "components/AnimationSpeed.h"
+#include "components/LogDisplay.h"
+#include "game/ContentDatabase.h"
 
 class TestMainWindow : public TestBase
 {
@@ -17,10 +25,13 @@ private slots:
     void testMenuOverlayEdgeCases();
     void testMenuOverlayAnimationState();
     void testMenuOverlayFocusManagement();
+    void testMenuOverlayInstantSpeed();
+    void testMenuOverlayPausesPageUnderneath();
     void testCombatEndedSignalHandling();
     void testGlobalShortcuts();
     void testShortcutCombatDisabled();
     void testShortcutNoConflictWithESC();
+    void testRejectedContentReloadIsLogged();
 };
 
 void TestMainWindow::testWindowTitle()
@@ -153,6 +164,46 @@ void TestMainWindow::testMenuOverlayFocusManagement()
     QVERIFY(!overlay.isVisible());
 }
 
+void TestMainWindow::testMenuOverlayInstantSpeed()
+{
+    AnimationSpeed &speed = AnimationSpeed::instance();
+    AnimationSpeed::Speed previous = speed.speed();
+    speed.setSpeed(AnimationSpeed::Instant);
+
+    MenuOverlay overlay;
+    QSignalSpy spy(&overlay, &MenuOverlay::overlayHidden);
+
+    // No fade to wait for: shown and hidden before the calls return
+    overlay.showOverlay();
+    QCOMPARE(overlay.opacity(), 1.0);
+    overlay.hideOverlay();
+    QVERIFY(!overlay.isVisible());
+    QCOMPARE(spy.count(), 1);
+
+    speed.setSpeed(previous);
+}
+
+void TestMainWindow::testMenuOverlayPausesPageUnderneath()
+{
+    QWidget window;
+    window.resize(800, 600);
+    QWidget *page = new QWidget(&window);
+    page->setGeometry(window.rect());
+    MenuOverlay *overlay = new MenuOverlay(&window);
+    overlay->setGeometry(window.rect());
+    window.show();
+
+    // The page is painted from a snapshot while the menu is up
+    overlay->showOverlay();
+    QVERIFY(overlay->testAttribute(Qt::WA_OpaquePaintEvent));
+    QVERIFY(!page->updatesEnabled());
+
+    overlay->hideOverlay();
+    QTRY_VERIFY(!overlay->isVisible());
+    QVERIFY(page->updatesEnabled());
+    QVERIFY(!overlay->testAttribute(Qt::WA_OpaquePaintEvent));
+}
+
 void TestMainWindow::testCombatEndedSignalHandling()
 {
     MainWindow window;
@@ -226,5 +277,40 @@ void TestMainWindow::testShortcutNoConflictWithESC()
     QVERIFY(window.windowTitle() == "Pyrpg-Qt");
 }
 
+void TestMainWindow::testRejectedContentReloadIsLogged()
+{
+    // A lore entry with a misspelt field; the error quotes the field name
+    QFile bundled(":/content/lore.json");
+    QVERIFY(bundled.open(QIODevice::ReadOnly));
+    QJsonObject lore = QJsonDocument::fromJson(bundled.readAll()).object();
+    QJsonArray entries = lore.value("lore").toArray();
+    QJsonObject entry = entries.first().toObject();
+    entry.insert("titel", "Misspelt");
+    entries.replace(0, entry);
+    lore.insert("lore", entries);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QFile file(dir.filePath("lore.json"));
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QVERIFY(file.write(QJsonDocument(lore).toJson()) > 0);
+    file.close();
+
+    MainWindow window;
+    LogDisplay *log = window.findChild<LogDisplay*>();
+    QVERIFY(log);
+
+    ContentDatabase &content = ContentDatabase::instance();
+    content.setOverrideDirectory(dir.path());
+    QVERIFY(QMetaObject::invokeMethod(&window, "handleContentChanged"));
+    content.setOverrideDirectory(QString());
+
+    // Logged as plain text, quotes and all
+    const QString message = log->messages().value(log->getEntryCount() - 1);
+    QVERIFY2(message.startsWith("Content reload rejected: "), qPrintable(message));
+    QVERIFY2(message.contains("unknown field \"titel\""), qPrintable(message));
+    QVERIFY(!message.contains("&quot;"));
+}
+
 QTEST_MAIN(TestMainWindow)
 #include "test_mainwindow.moc"
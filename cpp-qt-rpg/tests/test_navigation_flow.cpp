@@ -2,6 +2,11 @@
 #include "../src/MainWindow.h"
 #include "../src/views/CombatPage.h"
 #include "../src/components/MenuOverlay.h"
+#include "../src/views/MainMenu.h"
+#include "../src/views/NewGameView.h"
+#include "../src/views/InventoryPage.h"
+#include "../src/views/LoreBookPage.h"
+#include <QStackedWidget>
 
 class TestNavigationFlow : public QObject
 {
@@ -15,6 +20,7 @@ private slots:
     void testExploreSwitchesToCombatMode();
     void testRestWorksInNonCombatMode();
     void testMenuOverlayAccessibleFromCombatPage();
+    void testPagesBuiltOnFirstNavigation();
 
 private:
     MainWindow *m_mainWindow;
@@ -61,5 +67,25 @@ void TestNavigationFlow::testMenuOverlayAccessibleFromCombatPage()
     QVERIFY(m_mainWindow->findChild<MenuOverlay*>() != nullptr);
 }
 
+void TestNavigationFlow::testPagesBuiltOnFirstNavigation()
+{
+    // Only the main menu and the combat hub exist up front, including inside the menu overlay
+    QVERIFY(m_mainWindow->findChild<InventoryPage*>() == nullptr);
+    QVERIFY(m_mainWindow->findChild<LoreBookPage*>() == nullptr);
+    QVERIFY(m_mainWindow->findChild<NewGameView*>() == nullptr);
+
+    MainMenu *mainMenu = m_mainWindow->findChild<MainMenu*>();
+    QVERIFY(mainMenu != nullptr);
+    emit mainMenu->newGameRequested();
+
+    NewGameView *newGameView = m_mainWindow->findChild<NewGameView*>();
+    QVERIFY(newGameView != nullptr);
+    QCOMPARE(qobject_cast<QStackedWidget*>(m_mainWindow->centralWidget())->currentWidget(), static_cast<QWidget*>(newGameView));
+
+    // Navigating again reuses the page
+    emit mainMenu->newGameRequested();
+    QCOMPARE(m_mainWindow->findChildren<NewGameView*>().size(), 1);
+}
+
 QTEST_MAIN(TestNavigationFlow)
 #include "test_navigation_flow.moc"
@@ -0,0 +1,83 @@
+#include <QtTest>
+#include <QStackedWidget>
+#include <QLabel>
+#include <QPointer>
+#include "views/PageRegistry.h"
+
+class TestPageRegistry : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testPageBuiltOnce();
+    void testIdlePagesEvicted();
+    void testUnknownPage();
+};
+
+void TestPageRegistry::testPageBuiltOnce()
+{
+    QStackedWidget stack;
+    PageRegistry registry(&stack);
+    int builds = 0;
+    registry.registerPage(1, [&builds]() -> QWidget* {
+        ++builds;
+        return new QLabel("first");
+    });
+
+    QVERIFY(!registry.isBuilt(1));
+    QCOMPARE(stack.count(), 0);
+
+    QWidget *page = registry.show(1);
+    QVERIFY(page != nullptr);
+    QCOMPARE(registry.page(1), page);
+    QCOMPARE(builds, 1);
+    QCOMPARE(stack.count(), 1);
+    QVERIFY(registry.isCurrent(1));
+}
+
+void TestPageRegistry::testIdlePagesEvicted()
+{
+    QStackedWidget stack;
+    PageRegistry registry(&stack);
+    int builds = 0;
+    registry.registerPage(1, []() -> QWidget* { return new QLabel("hub"); });
+    registry.registerPage(2, [&builds]() -> QWidget* {
+        ++builds;
+        return new QLabel("rare");
+    }, true);
+    registry.registerPage(3, []() -> QWidget* { return new QLabel("current"); }, true);
+
+    registry.page(1);
+    QPointer<QWidget> rare = registry.page(2);
+    registry.show(3);
+
+    QSignalSpy evictedSpy(&registry, &PageRegistry::pageEvicted);
+    QCOMPARE(registry.evictIdlePages(60 * 1000), 0);  // Nothing idle that long
+
+    // Pinned and current pages survive; the idle evictable page goes
+    QCOMPARE(registry.evictIdlePages(0), 1);
+    QCOMPARE(evictedSpy.count(), 1);
+    QCOMPARE(evictedSpy.first().first().toInt(), 2);
+    QVERIFY(registry.isBuilt(1));
+    QVERIFY(!registry.isBuilt(2));
+    QVERIFY(registry.isCurrent(3));
+    QCOMPARE(stack.count(), 2);
+
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    QVERIFY(rare.isNull());
+
+    // The next visit rebuilds it
+    QVERIFY(registry.show(2) != nullptr);
+    QCOMPARE(builds, 2);
+}
+
+void TestPageRegistry::testUnknownPage()
+{
+    QStackedWidget stack;
+    PageRegistry registry(&stack);
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression("no page registered"));
+    QVERIFY(registry.page(42) == nullptr);
+}
+
+QTEST_MAIN(TestPageRegistry)
+#include "test_page_registry.moc"
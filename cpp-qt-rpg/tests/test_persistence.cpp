@@ -18,6 +18,9 @@ private slots:
     void testCharacterClassSerialization();
     void testSkillSerialization();
     void testEquipmentSerialization();
+    void testStreamingFormatCompatibility();
+    void testSaveHistorySnapshots();
+    void testFormatVersionDowngrade();
     void cleanupTestData();
 
 private:
@@ -292,6 +295,148 @@ void TestPersistence::testEquipmentSerialization()
     delete loaded; // player and items cleaned up by TestBase
 }
 
+void TestPersistence::testStreamingFormatCompatibility()
+{
+    Player *player = createTestPlayer("StreamTest");
+    Item *weapon = createTestItem("Iron Sword");
+    if (weapon) player->equipItem(weapon);
+    Item *potion = createTestItem("Health Potion");
+    if (potion) player->inventory.append(potion);
+    player->learnSkill(new Skill("Fireball", "magic", 50, 20, "A powerful fire spell"));
+    player->addQuest(new Quest("test_quest", "Test Quest", "Streamed quest", "active"));
+
+    QByteArray streamed;
+    {
+        QDataStream out(&streamed, QIODevice::WriteOnly);
+        out.setVersion(QDataStream::Qt_6_0);
+        out << *player;
+    }
+
+    // Reference layout: the container-based encoding used by earlier builds
+    QByteArray reference;
+    {
+        QDataStream out(&reference, QIODevice::WriteOnly);
+        out.setVersion(QDataStream::Qt_6_0);
+        out << quint32(5);
+        out << static_cast<const Character&>(*player);
+        out << player->characterClass;
+        out << player->mana << player->maxMana << player->strength << player->dexterity
+            << player->intelligence << player->vitality;
+        out << player->gold << player->experience << player->experienceToLevel
+            << player->skillPoints << player->statPoints;
+
+        QMap<QString, Item> eq;
+        for (auto it = player->equipment.begin(); it != player->equipment.end(); ++it) {
+            if (it.value()) eq[it.key()] = *it.value();
+        }
+        QList<Item> inv;
+        for (Item *item : player->inventory) inv.append(*item);
+        QList<Skill> skillList;
+        for (Skill *skill : player->skills) skillList.append(*skill);
+        QList<Quest> questList;
+        for (Quest *quest : player->quests) questList.append(*quest);
+        out << eq << inv << skillList << questList;
+
+        out << player->viewedDialogueIds << player->viewedEventIds << player->unlockedLoreEntries;
+        out << player->hasDefeatedFinalBoss << player->gameCompletionTime << player->finalGameLevel;
+    }
+
+    QCOMPARE(streamed, reference);
+
+    // Round-trip through the streaming reader
+    Player loaded("");
+    QDataStream in(&streamed, QIODevice::ReadOnly);
+    in.setVersion(QDataStream::Qt_6_0);
+    in >> loaded;
+    QCOMPARE(in.status(), QDataStream::Ok);
+    QCOMPARE(loaded.inventory.size(), player->inventory.size());
+    QCOMPARE(loaded.skills.size(), player->skills.size());
+    QCOMPARE(loaded.quests.size(), 1);
+    QCOMPARE(loaded.quests.first()->questId, QString("test_quest"));
+    if (weapon) {
+        QVERIFY(loaded.equipment["weapon"] != nullptr);
+        QCOMPARE(loaded.equipment["weapon"]->name, weapon->name);
+    }
+}
+
+void TestPersistence::testSaveHistorySnapshots()
+{
+    SaveManager saveManager;
+    cleanupTestSlots();
+    saveManager.pruneSlotHistory(6, 0);
+
+    Player *player = createTestPlayer("HistoryTest", "Warrior", 3, 100);
+    for (int i = 0; i < 5; ++i) {
+        player->unlockLore(QString("lore_entry_%1").arg(i));
+    }
+    QVERIFY(saveManager.saveToSlot(player, 6));
+
+    SaveHistory history(saveManager.getSavesDirectory());
+    qint64 bytesAfterFirst = history.chunkStorageBytes();
+
+    // Only the core section changes; inventory, skills, quests and narrative are shared
+    player->gold = 250;
+    QVERIFY(saveManager.saveToSlot(player, 6));
+    qint64 bytesAfterSecond = history.chunkStorageBytes();
+    QVERIFY(bytesAfterSecond - bytesAfterFirst < bytesAfterFirst);
+
+    QList<SaveSnapshotInfo> snapshots = saveManager.getSlotHistory(6);
+    QCOMPARE(snapshots.size(), 2);
+    QCOMPARE(snapshots.first().characterName, QString("HistoryTest"));
+
+    // Restore the older snapshot over the slot
+    QVERIFY(saveManager.restoreSnapshot(6, snapshots.last().snapshotId));
+    Player *restored = saveManager.loadFromSlot(6);
+    QVERIFY(restored != nullptr);
+    QCOMPARE(restored->gold, 100);
+    QCOMPARE(restored->unlockedLoreEntries.size(), 5);
+    delete restored;
+
+    // Prune keeps the newest snapshot and drops unreferenced chunks
+    QCOMPARE(saveManager.pruneSlotHistory(6, 1), 1);
+    QCOMPARE(saveManager.getSlotHistory(6).size(), 1);
+    QVERIFY(history.chunkStorageBytes() < bytesAfterSecond);
+
+    // Snapshots recorded within the same millisecond still list newest first
+    QList<QByteArray> sections = SaveHistory::serializeSections(player);
+    for (int level = 1; level <= 3; ++level) {
+        QVERIFY(!history.recordSnapshot("OrderTest", level, sections, 6).isEmpty());
+    }
+    snapshots = history.listSnapshots(6);
+    QCOMPARE(snapshots.size(), 4);
+    QCOMPARE(snapshots[0].level, 3);
+    QCOMPARE(snapshots[1].level, 2);
+    QCOMPARE(snapshots[2].level, 1);
+    QCOMPARE(history.snapshotCount(6), 4);
+
+    saveManager.pruneSlotHistory(6, 0);
+}
+
+void TestPersistence::testFormatVersionDowngrade()
+{
+    SaveManager saveManager;
+    Player *player = createTestPlayer("VersionTest", "Mage", 4, 300);
+    player->addQuest(new Quest("test_quest", "Test Quest", "Dropped before v3", "active"));
+    player->unlockLore("lore_entry");
+
+    const QString filePath = "test_version_save.dat";
+    for (quint32 version = 1; version <= Player::CURRENT_SAVE_VERSION; ++version) {
+        QVERIFY(saveManager.saveGame(player, filePath, version));
+        QCOMPARE(saveManager.getPlayerFormatVersion(filePath), version);
+
+        Player *loaded = saveManager.loadGame(filePath);
+        QVERIFY(loaded != nullptr);
+        QCOMPARE(loaded->name, player->name);
+        QCOMPARE(loaded->gold, player->gold);
+        QCOMPARE(loaded->characterClass, version >= 2 ? player->characterClass : QString("Hero"));
+        QCOMPARE(loaded->quests.size(), version >= 3 ? 1 : 0);
+        QCOMPARE(loaded->unlockedLoreEntries.size(), version >= 4 ? 1 : 0);
+        delete loaded;
+    }
+
+    QFile::remove(filePath);
+}
+
 void TestPersistence::cleanupTestData()
 {
     cleanupTestSlots();
@@ -0,0 +1,104 @@
+#include <QTest>
+#include <QObject>
+#include "diagnostics/Profiler.h"
+
+class TestProfiler : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void testBucketsStayWithinBounds();
+    void testPercentilesOfKnownDurations();
+    void testScopeMacroRecords();
+};
+
+namespace {
+ProbeSnapshot snapshotOf(const QString &name)
+{
+    for (const ProbeSnapshot &snapshot : Profiler::instance().probeSnapshots()) {
+        if (snapshot.name == name) {
+            return snapshot;
+        }
+    }
+    return ProbeSnapshot{};
+}
+}
+
+void TestProfiler::init()
+{
+    Profiler::instance().reset();
+}
+
+void TestProfiler::testBucketsStayWithinBounds()
+{
+    // Exact below 4ns, then 4 sub-buckets per power of two: the midpoint is within 1/8
+    for (quint64 ns = 0; ns < 4; ++ns) {
+        QCOMPARE(ProfileProbe::bucketValue(ProfileProbe::bucketIndex(ns)), ns);
+    }
+    int previousIndex = ProfileProbe::bucketIndex(3);
+    for (quint64 ns = 4; ns < 2000000; ns += ns / 16 + 1) {
+        const int index = ProfileProbe::bucketIndex(ns);
+        QVERIFY(index >= previousIndex);
+        QVERIFY(index < ProfileProbe::BUCKET_COUNT);
+        const quint64 value = ProfileProbe::bucketValue(index);
+        const quint64 error = value > ns ? value - ns : ns - value;
+        QVERIFY2(error * 8 <= ns, qPrintable(QString("%1ns -> %2ns").arg(ns).arg(value)));
+        previousIndex = index;
+    }
+    QVERIFY(ProfileProbe::bucketIndex(~quint64(0)) < ProfileProbe::BUCKET_COUNT);
+}
+
+void TestProfiler::testPercentilesOfKnownDurations()
+{
+    ProfileProbe *probe = Profiler::instance().probe("TestProfiler::known");
+    // 1us, 2us, ... 100us: the 50th and 99th samples are 50us and 99us
+    for (int i = 1; i <= 100; ++i) {
+        probe->record(qint64(i) * 1000);
+    }
+
+    const ProbeSnapshot snapshot = snapshotOf("TestProfiler::known");
+    QCOMPARE(snapshot.count, quint64(100));
+    QCOMPARE(snapshot.maxNs, quint64(100000));
+    QCOMPARE(snapshot.meanNs, quint64(50500));
+    QCOMPARE(snapshot.p50Ns, ProfileProbe::bucketValue(ProfileProbe::bucketIndex(50000)));
+    QCOMPARE(snapshot.p99Ns, ProfileProbe::bucketValue(ProfileProbe::bucketIndex(99000)));
+    QVERIFY(snapshot.p50Ns >= 50000 - 50000 / 8 && snapshot.p50Ns <= 50000 + 50000 / 8);
+    QVERIFY(snapshot.p99Ns >= 99000 - 99000 / 8 && snapshot.p99Ns <= 99000 + 99000 / 8);
+
+    // A slow tail moves p99 but not p50
+    probe->reset();
+    for (int i = 0; i < 98; ++i) {
+        probe->record(1000);
+    }
+    probe->record(5000000);
+    probe->record(5000000);
+    QCOMPARE(probe->percentile(0.50), ProfileProbe::bucketValue(ProfileProbe::bucketIndex(1000)));
+    QCOMPARE(probe->percentile(0.99), ProfileProbe::bucketValue(ProfileProbe::bucketIndex(5000000)));
+
+    // Negative durations (clock skew) land in the zero bucket
+    probe->reset();
+    probe->record(-5);
+    QCOMPARE(probe->percentile(0.50), quint64(0));
+}
+
+void TestProfiler::testScopeMacroRecords()
+{
+    QVERIFY(Profiler::isEnabled());
+    for (int i = 0; i < 10; ++i) {
+        PYRPG_PROFILE_SCOPE("TestProfiler::scope");
+        PYRPG_PROFILE_COUNT("TestProfiler.counter", 2);
+    }
+    QCOMPARE(snapshotOf("TestProfiler::scope").count, quint64(10));
+
+    qint64 counterValue = 0;
+    for (const CounterSnapshot &counter : Profiler::instance().counterSnapshots()) {
+        if (counter.name == "TestProfiler.counter") {
+            counterValue = counter.value;
+        }
+    }
+    QCOMPARE(counterValue, qint64(20));
+}
+
+QTEST_MAIN(TestProfiler)
+#include "test_profiler.moc"
@@ -1,5 +1,6 @@
 #include <QtTest>
 #include "../src/game/QuestManager.h"
+#include "../src/components/QuestListModel.h"
 #include "../src/game/factories/MonsterFactory.h"
 #include "../src/models/Player.h"
 #include "../src/models/Quest.h"
@@ -18,6 +19,7 @@ private slots:
     void testQuest1ShadowWolfCompletion();
     void testQuest3ShadowLordCompletion();
     void testQuest6DarkOverlordCompletion();
+    void testQuestListModelFollowsSignals();
 };
 
 void TestQuestSystem::testQuestManagerCreation()
@@ -49,7 +51,7 @@ void TestQuestSystem::testQuestAcceptance()
     QString questId = available.first()->questId;
 
     // Accept quest
-    bool accepted = manager.acceptQuest(questId);
+    bool accepted = manager.acceptQuest(ContentId(questId));
     QVERIFY(accepted);
 
     // Verify it's now active
@@ -112,7 +114,7 @@ void TestQuestSystem::testQuestCompletion()
     }
 
     QString questId = available.first()->questId;
-    manager.acceptQuest(questId);
+    manager.acceptQuest(ContentId(questId));
 
     Quest* playerQuest = player.getQuest(questId);
     QVERIFY(playerQuest != nullptr);
@@ -128,7 +130,7 @@ void TestQuestSystem::testQuestCompletion()
 
     // Complete quest via manager
     QSignalSpy spy(&manager, &QuestManager::questCompleted);
-    manager.completeQuest(questId);
+    manager.completeQuest(ContentId(questId));
 
     // Verify completion signal
     QCOMPARE(spy.count(), 1);
@@ -149,7 +151,7 @@ void TestQuestSystem::testCombatEventHandling()
     manager.loadQuests();
 
     // Accept the first main quest which has Shadow Wolf objective
-    manager.acceptQuest("main_quest_01");
+    manager.acceptQuest(ContentId("main_quest_01"));
 
     Quest* playerQuest = player.getQuest("main_quest_01");
     QVERIFY(playerQuest != nullptr);
@@ -157,13 +159,13 @@ void TestQuestSystem::testCombatEventHandling()
     int initialCurrent = playerQuest->objectives[0].current;
 
     // Simulate combat end
-    manager.onCombatEnd("Shadow Wolf");
+    manager.onCombatEnd(ContentId("Shadow Wolf"));
     QCOMPARE(playerQuest->objectives[0].current, initialCurrent + 1);
 
-    manager.onCombatEnd("Shadow Wolf");
+    manager.onCombatEnd(ContentId("Shadow Wolf"));
     QCOMPARE(playerQuest->objectives[0].current, initialCurrent + 2);
 
-    manager.onCombatEnd("Shadow Wolf");
+    manager.onCombatEnd(ContentId("Shadow Wolf"));
     QCOMPARE(playerQuest->objectives[0].current, initialCurrent + 3);
 }
 
@@ -175,7 +177,7 @@ void TestQuestSystem::testLevelUpEventHandling()
     manager.loadQuests();
 
     // Accept quest with level objective (main_quest_02 requires reaching level 5)
-    bool accepted = manager.acceptQuest("main_quest_02");
+    bool accepted = manager.acceptQuest(ContentId("main_quest_02"));
     if (!accepted) {
         QSKIP("Quest 2 not available");
     }
@@ -216,7 +218,7 @@ void TestQuestSystem::testQuest1ShadowWolfCompletion()
     manager.loadQuests();
 
     // Accept Quest 1
-    manager.acceptQuest("main_quest_01");
+    manager.acceptQuest(ContentId("main_quest_01"));
 
     Quest* playerQuest = player.getQuest("main_quest_01");
     QVERIFY(playerQuest != nullptr);
@@ -232,7 +234,7 @@ void TestQuestSystem::testQuest1ShadowWolfCompletion()
 
     // Simulate defeating 3 Shadow Wolves
     for (int i = 0; i < 3; i++) {
-        manager.onCombatEnd(shadowWolf->name);
+        manager.onCombatEnd(ContentId(shadowWolf->name));
     }
 
     // Verify quest completed
@@ -249,13 +251,13 @@ void TestQuestSystem::testQuest3ShadowLordCompletion()
     manager.loadQuests();
 
     // Complete Quest 2 to unlock Quest 3
-    Quest* quest2 = manager.getQuestById("main_quest_02");
+    Quest* quest2 = manager.getQuestById(ContentId("main_quest_02"));
     if (quest2) {
         quest2->status = "completed";
     }
 
     // Accept Quest 3
-    bool accepted = manager.acceptQuest("main_quest_03");
+    bool accepted = manager.acceptQuest(ContentId("main_quest_03"));
     if (!accepted) {
         QSKIP("Quest 3 not available - prerequisites not met");
     }
@@ -273,7 +275,7 @@ void TestQuestSystem::testQuest3ShadowLordCompletion()
     QVERIFY(shadowLord->enemyType == "boss");
 
     // Simulate defeating Shadow Lord
-    manager.onCombatEnd(shadowLord->name);
+    manager.onCombatEnd(ContentId(shadowLord->name));
 
     // Verify quest completed
     QVERIFY(playerQuest->objectives[0].completed);
@@ -291,14 +293,14 @@ void TestQuestSystem::testQuest6DarkOverlordCompletion()
     // Complete all prerequisite quests to unlock Quest 6
     QStringList prereqs = {"main_quest_01", "main_quest_02", "main_quest_03", "main_quest_04", "main_quest_05"};
     for (const QString& questId : prereqs) {
-        Quest* quest = manager.getQuestById(questId);
+        Quest* quest = manager.getQuestById(ContentId(questId));
         if (quest) {
             quest->status = "completed";
         }
     }
 
     // Accept Quest 6
-    bool accepted = manager.acceptQuest("main_quest_06");
+    bool accepted = manager.acceptQuest(ContentId("main_quest_06"));
     if (!accepted) {
         QSKIP("Quest 6 not available - prerequisites not met");
     }
@@ -316,11 +318,43 @@ void TestQuestSystem::testQuest6DarkOverlordCompletion()
     QVERIFY(darkOverlord->enemyType == "final_boss");
 
     // Simulate defeating Dark Overlord
-    manager.onCombatEnd(darkOverlord->name);
+    manager.onCombatEnd(ContentId(darkOverlord->name));
 
     // Verify quest completed
     QVERIFY(playerQuest->objectives[0].completed);
     delete darkOverlord;
 }
 
+void TestQuestSystem::testQuestListModelFollowsSignals()
+{
+    Player player("Hero", "Warrior");
+    QuestManager manager(&player);
+    manager.loadQuests();  // Auto-accepts the first quest
+
+    QuestListModel model;
+    model.setQuestManager(&manager, &player);
+    QCOMPARE(model.questCount(QuestListModel::ActiveSection), manager.getActiveQuests().size());
+    QVERIFY(model.questCount(QuestListModel::ActiveSection) > 0);
+
+    QString questId = manager.getActiveQuests().first()->questId;
+    Quest *playerQuest = player.getQuest(questId);
+    QVERIFY(playerQuest != nullptr);
 
+    QSignalSpy resetSpy(&model, &QAbstractItemModel::modelReset);
+    QSignalSpy changedSpy(&model, &QAbstractItemModel::dataChanged);
+
+    // Finishing every objective updates the row in place, then moves it to Completed
+    for (int i = 0; i < playerQuest->objectives.size(); ++i) {
+        const QuestObjective &obj = playerQuest->objectives[i];
+        manager.updateQuestProgress(ContentId(questId), i, obj.required - obj.current);
+    }
+
+    QVERIFY(changedSpy.count() > 0);
+    QCOMPARE(resetSpy.count(), 0);
+    int row = model.rowOfQuest(ContentId(questId));
+    QVERIFY(row >= 0);
+    QCOMPARE(model.index(row).data(QuestListModel::SectionRole).toInt(), int(QuestListModel::CompletedSection));
+    QCOMPARE(model.questCount(QuestListModel::CompletedSection), manager.getCompletedQuests().size());
+    QCOMPARE(model.questCount(QuestListModel::AvailableSection), manager.getAvailableQuests().size());
+    QCOMPARE(model.questCount(QuestListModel::LockedSection), manager.getLockedQuests().size());
+}
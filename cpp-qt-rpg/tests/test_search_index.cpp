@@ -0,0 +1,68 @@
+#include <QTest>
+#include <QObject>
+#include "game/SearchIndex.h"
+
+class TestSearchIndex : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testTokenize();
+    void testPrefixMatching();
+    void testAllWordsMustMatch();
+    void testTitleMatchesRankFirst();
+    void testFilterHidesDocuments();
+};
+
+void TestSearchIndex::testTokenize()
+{
+    QCOMPARE(SearchIndex::tokenize("The Shadow-Wolf's den, 3rd floor"),
+             QStringList({"the", "shadow", "wolf", "s", "den", "3rd", "floor"}));
+    QVERIFY(SearchIndex::tokenize("  ...  ").isEmpty());
+}
+
+void TestSearchIndex::testPrefixMatching()
+{
+    SearchIndex index;
+    int wolf = index.addDocument({SearchDocument::Lore, ContentId("bestiary_wolf"), "Shadow Wolf", "Hunts in packs."});
+    index.addDocument({SearchDocument::Item, ContentId("Iron Sword"), "Iron Sword", "A plain blade."});
+
+    QCOMPARE(index.search("sha", 10), QList<int>({wolf}));
+    QCOMPARE(index.search("PACK", 10), QList<int>({wolf}));
+    QVERIFY(index.search("dragon", 10).isEmpty());
+    QVERIFY(index.search("", 10).isEmpty());
+}
+
+void TestSearchIndex::testAllWordsMustMatch()
+{
+    SearchIndex index;
+    index.addDocument({SearchDocument::Lore, ContentId("a"), "Ancient War", "The kingdoms burned."});
+    int both = index.addDocument({SearchDocument::Lore, ContentId("b"), "Ancient Tome", "Written before the war."});
+
+    QCOMPARE(index.search("anc tome", 10), QList<int>({both}));
+    QCOMPARE(index.search("war anc", 10).size(), 2);
+}
+
+void TestSearchIndex::testTitleMatchesRankFirst()
+{
+    SearchIndex index;
+    int bodyOnly = index.addDocument({SearchDocument::Quest, ContentId("q1"), "Clear the Road", "Wolves block the road."});
+    int title = index.addDocument({SearchDocument::Lore, ContentId("l1"), "Wolves of the North", "Grey and patient."});
+
+    QCOMPARE(index.search("wolves", 10), QList<int>({title, bodyOnly}));
+}
+
+void TestSearchIndex::testFilterHidesDocuments()
+{
+    SearchIndex index;
+    index.addDocument({SearchDocument::Dialogue, ContentId("elder_intro"), "Village Elder", "The shadows grow."});
+    int lore = index.addDocument({SearchDocument::Lore, ContentId("world_shadow"), "The Shadow", "An old darkness."});
+
+    QList<int> results = index.search("shadow", 10, [](const SearchDocument &document) {
+        return document.kind != SearchDocument::Dialogue;
+    });
+    QCOMPARE(results, QList<int>({lore}));
+}
+
+QTEST_MAIN(TestSearchIndex)
+#include "test_search_index.moc"
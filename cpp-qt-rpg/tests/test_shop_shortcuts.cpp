@@ -4,6 +4,7 @@
 #include "../src/models/Player.h"
 #include "../src/models/Item.h"
 #include "../src/game/factories/ItemFactory.h"
+#include <QPushButton>
 
 class TestShopShortcuts : public QObject
 {
@@ -13,6 +14,7 @@ private slots:
     void testESCKeyLeavesShop();
     void testSellButtonExists();
     void testItemSoldSignal();
+    void testUpdateReusesCardsAndTogglesAffordability();
     // TODO: Add more tests for arrow navigation when implemented
 };
 
@@ -53,5 +55,23 @@ void TestShopShortcuts::testItemSoldSignal()
     QVERIFY(spy1.isValid());
 }
 
+void TestShopShortcuts::testUpdateReusesCardsAndTogglesAffordability()
+{
+    ShopPage page;
+    Player player("Test");
+    player.gold = 0;
+    page.updateShop(&player);
+
+    QPushButton *potionButton = page.findChild<QPushButton*>("buyButton_Health Potion");
+    QVERIFY(potionButton);
+    QVERIFY(!potionButton->isEnabled());
+
+    // A later visit with more gold keeps the same widgets and only flips affordability
+    player.gold = 10000;
+    page.updateShop(&player);
+    QCOMPARE(page.findChild<QPushButton*>("buyButton_Health Potion"), potionButton);
+    QVERIFY(potionButton->isEnabled());
+}
+
 QTEST_MAIN(TestShopShortcuts)
 #include "test_shop_shortcuts.moc"
@@ -0,0 +1,64 @@
+#include <QtTest>
+#include <QApplication>
+#include "theme/StyleSheet.h"
+#include "theme/Theme.h"
+#include "components/ValidationLabel.h"
+
+class TestThemeStyleSheet : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void testAllTokensResolved();
+    void testRarityRulesGenerated();
+    void testValidationStateUsesProperty();
+};
+
+void TestThemeStyleSheet::initTestCase()
+{
+    Theme::applyApplicationTheme(*qApp);
+}
+
+void TestThemeStyleSheet::testAllTokensResolved()
+{
+    QString sheet = Theme::applicationStyleSheet();
+    QVERIFY(!sheet.isEmpty());
+    QVERIFY(!sheet.contains('@'));
+    QVERIFY(sheet.contains(QString("QLabel[themeRole=\"gold\"]")));
+    QVERIFY(sheet.contains(Theme::GOLD.name()));
+    QCOMPARE(qApp->styleSheet(), sheet);
+    QCOMPARE(qApp->palette().color(QPalette::Window), Theme::BACKGROUND);
+}
+
+void TestThemeStyleSheet::testRarityRulesGenerated()
+{
+    QString sheet = Theme::applicationStyleSheet();
+    for (const QString &rarity : {"common", "uncommon", "rare", "epic", "legendary"}) {
+        QVERIFY2(sheet.contains(QString("ItemCard[rarity=\"%1\"]").arg(rarity)), qPrintable(rarity));
+    }
+}
+
+void TestThemeStyleSheet::testValidationStateUsesProperty()
+{
+    ValidationLabel label;
+    QVERIFY(label.isHidden());
+
+    label.showError("Name is required");
+    QCOMPARE(label.property("validation").toString(), QString("error"));
+    QCOMPARE(label.text(), QString("❌ Name is required"));
+    QVERIFY(!label.isHidden());
+
+    label.showSuccess("Looks good");
+    QCOMPARE(label.property("validation").toString(), QString("success"));
+
+    // State changes never install a per-widget stylesheet
+    QVERIFY(label.styleSheet().isEmpty());
+
+    label.clearValidation();
+    QVERIFY(label.isHidden());
+    QVERIFY(label.property("validation").toString().isEmpty());
+}
+
+QTEST_MAIN(TestThemeStyleSheet)
+#include "test_theme_stylesheet.moc"
@@ -0,0 +1,144 @@
+#include <QTest>
+#include <QObject>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSet>
+#include <QTemporaryDir>
+#include <QThread>
+#include "diagnostics/Tracer.h"
+
+class TestTracer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+    void testRingWrapsAround();
+    void testClearKeepsWriting();
+    void testConcurrentWritersAndChromeTrace();
+};
+
+namespace {
+const char *QUOTED_CATEGORY = "test \"quoted\" \\ category";
+}
+
+void TestTracer::init()
+{
+    Tracer::instance().setEnabled(true);  // Starting a capture clears earlier events
+}
+
+void TestTracer::cleanup()
+{
+    Tracer::instance().setEnabled(false);
+}
+
+void TestTracer::testRingWrapsAround()
+{
+    const int extra = 100;
+    QThread *thread = QThread::create([extra]() {
+        Tracer &tracer = Tracer::instance();
+        for (int i = 0; i < TraceBuffer::CAPACITY + extra; ++i) {
+            tracer.instant("fill", "test");
+        }
+        tracer.instant("last", "test");
+    });
+    thread->start();
+    QVERIFY(thread->wait(10000));
+
+    // Only the most recent CAPACITY events survive, oldest first
+    const QList<TraceEvent> events = Tracer::instance().recentThreadEvents(thread, TraceBuffer::CAPACITY);
+    QCOMPARE(events.size(), TraceBuffer::CAPACITY);
+    QCOMPARE(QByteArray(events.last().name), QByteArray("last"));
+    for (int i = 1; i < events.size(); ++i) {
+        QVERIFY(events[i - 1].timestampNs <= events[i].timestampNs);
+    }
+    delete thread;
+}
+
+void TestTracer::testClearKeepsWriting()
+{
+    Tracer &tracer = Tracer::instance();
+    tracer.instant("before", "test");
+    tracer.clear();
+    QVERIFY(tracer.recentThreadEvents(QThread::currentThread(), 10).isEmpty());
+
+    // The writer carries on from its own index; only the new event is visible
+    tracer.instant("after", "test");
+    const QList<TraceEvent> events = tracer.recentThreadEvents(QThread::currentThread(), 10);
+    QCOMPARE(events.size(), 1);
+    QCOMPARE(QByteArray(events.first().name), QByteArray("after"));
+}
+
+void TestTracer::testConcurrentWritersAndChromeTrace()
+{
+    // Enough events to wrap each buffer several times while the reader copies
+    const int pairs = TraceBuffer::CAPACITY * 2;
+    QList<QThread*> writers;
+    for (int t = 0; t < 2; ++t) {
+        writers.append(QThread::create([pairs]() {
+            Tracer &tracer = Tracer::instance();
+            for (int i = 0; i < pairs; ++i) {
+                tracer.begin("work", QUOTED_CATEGORY);
+                tracer.end("work", QUOTED_CATEGORY);
+            }
+        }));
+        writers.last()->setObjectName(QString("writer %1").arg(t));
+        writers.last()->start();
+    }
+
+    // Every event a reader sees is whole: a name and category that were written together
+    int snapshots = 0;
+    bool writing = true;
+    while (writing) {
+        writing = false;
+        for (QThread *writer : std::as_const(writers)) {
+            writing = writing || !writer->isFinished();
+        }
+        for (const ThreadTraceEvent &event : Tracer::instance().recentEvents(1024)) {
+            if (QByteArray(event.event.category) == QUOTED_CATEGORY) {
+                QCOMPARE(QByteArray(event.event.name), QByteArray("work"));
+                QVERIFY(event.event.phase == 'B' || event.event.phase == 'E');
+            }
+        }
+        ++snapshots;
+    }
+    QVERIFY(snapshots > 0);
+    for (QThread *writer : std::as_const(writers)) {
+        QVERIFY(writer->wait(10000));
+    }
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.filePath("trace.json");
+    QVERIFY(Tracer::instance().writeChromeTrace(path));
+
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QJsonParseError error;
+    QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &error);
+    QVERIFY2(error.error == QJsonParseError::NoError, qPrintable(error.errorString()));
+
+    // The category survives escaping, and each writer has its own named track
+    QSet<int> workThreads;
+    QSet<QString> threadNames;
+    for (const QJsonValue &value : document.object().value("traceEvents").toArray()) {
+        const QJsonObject event = value.toObject();
+        if (event.value("ph").toString() == "M") {
+            threadNames.insert(event.value("args").toObject().value("name").toString());
+        } else if (event.value("name").toString() == "work") {
+            QCOMPARE(event.value("cat").toString(), QString::fromUtf8(QUOTED_CATEGORY));
+            workThreads.insert(event.value("tid").toInt());
+        }
+    }
+    QCOMPARE(workThreads.size(), 2);
+    QVERIFY(threadNames.contains("writer 0"));
+    QVERIFY(threadNames.contains("writer 1"));
+
+    qDeleteAll(writers);
+}
+
+QTEST_MAIN(TestTracer)
+#include "test_tracer.moc"